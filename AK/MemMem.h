@@ -40,6 +40,56 @@ constexpr void const* bitap_bitwise(void const* haystack, size_t haystack_length
 
     return nullptr;
 }
+
+// Looks for `byte` a machine word at a time, using the "determine if a word has a zero byte" trick on the word XOR'ed with `byte` in every lane.
+// NOTE: This doesn't use SIMD intrinsics, as the kernel uses AK (and memmem) as well.
+inline u8 const* find_byte(u8 const* haystack, size_t haystack_length, u8 byte)
+{
+    constexpr FlatPtr low_bits = explode_byte(0x01);
+    constexpr FlatPtr high_bits = explode_byte(0x80);
+    auto const pattern = explode_byte(byte);
+
+    size_t i = 0;
+    for (; i + sizeof(FlatPtr) <= haystack_length; i += sizeof(FlatPtr)) {
+        FlatPtr word;
+        __builtin_memcpy(&word, haystack + i, sizeof(word));
+        word ^= pattern;
+        if (((word - low_bits) & ~word & high_bits) != 0)
+            break;
+    }
+
+    for (; i < haystack_length; ++i) {
+        if (haystack[i] == byte)
+            return haystack + i;
+    }
+    return nullptr;
+}
+
+// Skips to the occurrences of the needle's first byte, and only compares the rest of the needle there.
+// Returns an empty optional if the first byte turned out to be too common for that to pay off, with `position` set to
+// the first position that wasn't checked yet.
+inline Optional<size_t> memmem_by_first_byte(u8 const* haystack, size_t haystack_length, u8 const* needle, size_t needle_length, size_t& position, bool& gave_up)
+{
+    auto last_start = haystack_length - needle_length;
+    size_t false_candidates = 0;
+
+    while (position <= last_start) {
+        auto const* candidate = find_byte(haystack + position, last_start - position + 1, needle[0]);
+        if (!candidate)
+            return {};
+
+        position = static_cast<size_t>(candidate - haystack);
+        if (__builtin_memcmp(candidate + 1, needle + 1, needle_length - 1) == 0)
+            return position;
+        ++position;
+
+        if (++false_candidates > 16 && false_candidates * 16 > position) {
+            gave_up = true;
+            return {};
+        }
+    }
+    return {};
+}
 }
 
 template<typename HaystackIterT>
@@ -116,7 +166,14 @@ inline Optional<size_t> memmem_optional(void const* haystack, size_t haystack_le
     }
 
     if (needle_length < 32) {
-        auto const* ptr = Detail::bitap_bitwise(haystack, haystack_length, needle, needle_length);
+        size_t position = 0;
+        bool gave_up = false;
+        auto result = Detail::memmem_by_first_byte((u8 const*)haystack, haystack_length, (u8 const*)needle, needle_length, position, gave_up);
+        if (!gave_up)
+            return result;
+
+        // The first byte of the needle is common in this haystack, so use bitap for the rest of it.
+        auto const* ptr = Detail::bitap_bitwise((u8 const*)haystack + position, haystack_length - position, needle, needle_length);
         if (ptr)
             return static_cast<size_t>((FlatPtr)ptr - (FlatPtr)haystack);
         return {};
@@ -20,6 +20,7 @@
 #include <LibCore/System.h>
 #include <LibCore/SystemServerTakeover.h>
 #include <LibIPC/ConnectionFromClient.h>
+#include <LibJS/Bytecode/CodeCache.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibMain/Main.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -80,6 +81,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.parse(arguments);
 
     JS::Bytecode::Interpreter::set_enabled(use_javascript_bytecode);
+    // Reloading a page runs the same scripts again, so keep their parse trees and bytecode around.
+    JS::Bytecode::CodeCache::the().set_enabled(use_javascript_bytecode);
 
     VERIFY(webcontent_fd_passing_socket >= 0);
 
@@ -84,6 +84,7 @@ set(IRQ_DEBUG ON)
 set(ISO9660_DEBUG ON)
 set(ISO9660_VERY_DEBUG ON)
 set(ITEM_RECTS_DEBUG ON)
+set(JIT_DEBUG ON)
 set(JOB_DEBUG ON)
 set(JPEG_DEBUG ON)
 set(JS_BYTECODE_DEBUG ON)
@@ -36,6 +36,37 @@ TEST_CASE(bitap)
     EXPECT_NE(result, nullptr);
 }
 
+TEST_CASE(memmem_long_haystack)
+{
+    auto haystack = DeprecatedString::formatted("{}needle{}", DeprecatedString::repeated('x', 1000), DeprecatedString::repeated('y', 13));
+
+    EXPECT_EQ(AK::memmem_optional(haystack.characters(), haystack.length(), "needle", 6), 1000u);
+    EXPECT_EQ(AK::memmem_optional(haystack.characters(), haystack.length(), "n", 1), 1000u);
+    EXPECT_EQ(AK::memmem_optional(haystack.characters(), haystack.length(), "ey", 2), 1005u);
+    EXPECT_EQ(AK::memmem_optional(haystack.characters(), haystack.length(), "yy", 2), 1006u);
+    EXPECT_EQ(AK::memmem_optional(haystack.characters(), haystack.length(), "y", 1), 1006u);
+    EXPECT(!AK::memmem_optional(haystack.characters(), haystack.length(), "needles", 7).has_value());
+    EXPECT(!AK::memmem_optional(haystack.characters(), haystack.length(), "z", 1).has_value());
+
+    // The last byte isn't part of a whole word.
+    auto ends_with_needle = DeprecatedString::formatted("{}z", DeprecatedString::repeated('x', 1001));
+    EXPECT_EQ(AK::memmem_optional(ends_with_needle.characters(), ends_with_needle.length(), "z", 1), 1001u);
+    EXPECT_EQ(AK::memmem_optional(ends_with_needle.characters(), ends_with_needle.length(), "xz", 2), 1000u);
+}
+
+TEST_CASE(memmem_common_first_byte)
+{
+    // Every position starts a false candidate here, which makes memmem fall back to bitap.
+    auto haystack = DeprecatedString::formatted("{}b", DeprecatedString::repeated('a', 1000));
+
+    EXPECT_EQ(AK::memmem_optional(haystack.characters(), haystack.length(), "aab", 3), 998u);
+    EXPECT(!AK::memmem_optional(haystack.characters(), haystack.length(), "aac", 3).has_value());
+
+    Array<u8, 4> high_bytes { 0x80, 0xff, 0x80, 0x7f };
+    Array<u8, 2> needle { 0x80, 0x7f };
+    EXPECT_EQ(AK::memmem_optional(high_bytes.data(), high_bytes.size(), needle.data(), needle.size()), 2u);
+}
+
 TEST_CASE(kmp_one_chunk)
 {
     Array<u8, 8> haystack { 1, 0, 1, 2, 3, 4, 5, 0 };
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Profiler.h>
+#include <LibJS/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static JS::Value run(JS::Interpreter& interpreter, StringView source)
+{
+    auto script = MUST(JS::Script::parse(source, interpreter.realm(), "test.js"sv));
+    return MUST(interpreter.vm().bytecode_interpreter().run(*script));
+}
+
+struct ProfilerTest {
+    ProfilerTest()
+        : vm(MUST(JS::VM::create()))
+        , interpreter(JS::Interpreter::create<JS::GlobalObject>(*vm))
+    {
+        JS::Bytecode::Interpreter::set_enabled(true);
+        JS::Bytecode::Profiler::the().reset();
+        JS::Bytecode::Profiler::the().set_enabled(true);
+    }
+
+    ~ProfilerTest()
+    {
+        JS::Bytecode::Profiler::the().set_enabled(false);
+        JS::Bytecode::Profiler::the().set_sampling_interval({});
+        JS::Bytecode::Profiler::the().reset();
+        JS::Bytecode::Interpreter::set_enabled(false);
+    }
+
+    NonnullRefPtr<JS::VM> vm;
+    NonnullOwnPtr<JS::Interpreter> interpreter;
+};
+
+TEST_CASE(counts_instructions_and_invocations)
+{
+    ProfilerTest test;
+    auto& profiler = JS::Bytecode::Profiler::the();
+
+    auto result = run(*test.interpreter, "function add(a, b) { return a + b; } let sum = 0; for (let i = 0; i < 10; ++i) sum = add(sum, i); sum"sv);
+    EXPECT_EQ(result.as_i32(), 45);
+
+    EXPECT_EQ(profiler.invocation_counts().get("add"sv), 10u);
+    EXPECT_EQ(profiler.statistics_for(JS::Bytecode::Instruction::Type::Call).count, 10u);
+    EXPECT(profiler.statistics_for(JS::Bytecode::Instruction::Type::Add).count >= 10u);
+    EXPECT_EQ(profiler.statistics_for(JS::Bytecode::Instruction::Type::NewClass).count, 0u);
+}
+
+TEST_CASE(nothing_is_recorded_while_disabled)
+{
+    ProfilerTest test;
+    auto& profiler = JS::Bytecode::Profiler::the();
+    profiler.set_enabled(false);
+
+    (void)run(*test.interpreter, "function f() {} f();"sv);
+
+    EXPECT(profiler.invocation_counts().is_empty());
+    EXPECT_EQ(profiler.statistics_for(JS::Bytecode::Instruction::Type::Call).count, 0u);
+}
+
+TEST_CASE(samples_are_written_as_folded_stacks)
+{
+    ProfilerTest test;
+    auto& profiler = JS::Bytecode::Profiler::the();
+    profiler.set_sampling_interval(Duration::from_microseconds(10));
+
+    (void)run(*test.interpreter, "function inner() { let x = 0; for (let i = 0; i < 1000; ++i) x += i; return x; } function outer() { return inner(); } for (let i = 0; i < 100; ++i) outer();"sv);
+
+    EXPECT(!profiler.samples().is_empty());
+    bool found_inner_stack = false;
+    for (auto const& sample : profiler.samples()) {
+        if (sample.key.ends_with(";(global);outer;inner"sv))
+            found_inner_stack = true;
+    }
+    EXPECT(found_inner_stack);
+
+    AllocatingMemoryStream stream;
+    MUST(profiler.write_folded_stacks(stream));
+    auto buffer = MUST(stream.read_until_eof());
+    auto lines = StringView { buffer }.split_view('\n');
+    EXPECT_EQ(lines.size(), profiler.samples().size());
+    for (auto line : lines) {
+        auto count = line.substring_view(line.find_last(' ').value() + 1).to_uint();
+        EXPECT(count.has_value());
+        EXPECT(count.value() > 0);
+    }
+}
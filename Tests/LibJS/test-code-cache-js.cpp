@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/CodeCache.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static JS::NonnullGCPtr<JS::Script> parse(JS::Interpreter& interpreter, StringView source, StringView filename = "test.js"sv)
+{
+    auto script_or_error = JS::Script::parse(source, interpreter.realm(), filename);
+    VERIFY(!script_or_error.is_error());
+    return script_or_error.release_value();
+}
+
+static JS::Value run(JS::Interpreter& interpreter, StringView source)
+{
+    auto script = parse(interpreter, source);
+    return MUST(interpreter.vm().bytecode_interpreter().run(*script));
+}
+
+struct CodeCacheTest {
+    CodeCacheTest()
+        : vm(MUST(JS::VM::create()))
+        , interpreter(JS::Interpreter::create<JS::GlobalObject>(*vm))
+    {
+        JS::Bytecode::Interpreter::set_enabled(true);
+        JS::Bytecode::CodeCache::the().set_enabled(true);
+    }
+
+    ~CodeCacheTest()
+    {
+        JS::Bytecode::CodeCache::the().set_enabled(false);
+        JS::Bytecode::Interpreter::set_enabled(false);
+    }
+
+    NonnullRefPtr<JS::VM> vm;
+    NonnullOwnPtr<JS::Interpreter> interpreter;
+};
+
+TEST_CASE(same_source_text_reuses_parse_tree)
+{
+    CodeCacheTest test;
+    auto& interpreter = test.interpreter;
+
+    auto script = parse(*interpreter, "var x = 1;"sv);
+    EXPECT_EQ(&parse(*interpreter, "var x = 1;"sv)->parse_node(), &script->parse_node());
+    EXPECT_NE(&parse(*interpreter, "var x = 2;"sv)->parse_node(), &script->parse_node());
+    EXPECT_NE(&parse(*interpreter, "var x = 1;"sv, "other.js"sv)->parse_node(), &script->parse_node());
+}
+
+TEST_CASE(same_source_text_reuses_executable)
+{
+    CodeCacheTest test;
+    auto& interpreter = test.interpreter;
+
+    auto source = "var counter = typeof counter === 'undefined' ? 1 : counter + 1; counter"sv;
+    EXPECT_EQ(run(*interpreter, source).as_i32(), 1);
+
+    auto script = parse(*interpreter, source);
+    auto entry = JS::Bytecode::CodeCache::the().entry_for(script->parse_node());
+    EXPECT(entry);
+    EXPECT(entry->executable);
+    auto* executable = entry->executable.ptr();
+
+    EXPECT_EQ(run(*interpreter, source).as_i32(), 2);
+    EXPECT_EQ(entry->executable.ptr(), executable);
+}
+
+TEST_CASE(cached_executable_runs_in_another_realm)
+{
+    CodeCacheTest test;
+    auto& interpreter = test.interpreter;
+
+    auto source = "var counter = typeof counter === 'undefined' ? 1 : counter + 1; { let y = counter; y }"sv;
+    EXPECT_EQ(run(*interpreter, source).as_i32(), 1);
+    EXPECT_EQ(run(*interpreter, source).as_i32(), 2);
+
+    auto other_interpreter = JS::Interpreter::create<JS::GlobalObject>(*test.vm);
+    EXPECT_EQ(run(*other_interpreter, source).as_i32(), 1);
+}
+
+TEST_CASE(not_used_by_ast_interpreter)
+{
+    CodeCacheTest test;
+    auto& interpreter = test.interpreter;
+    JS::Bytecode::Interpreter::set_enabled(false);
+
+    auto script = parse(*interpreter, "var x = 1;"sv);
+    EXPECT_NE(&parse(*interpreter, "var x = 1;"sv)->parse_node(), &script->parse_node());
+    EXPECT_EQ(JS::Bytecode::CodeCache::the().size(), 0u);
+}
+
+TEST_CASE(least_recently_used_entries_are_evicted)
+{
+    CodeCacheTest test;
+    auto& interpreter = test.interpreter;
+
+    auto first_script = parse(*interpreter, "0"sv);
+    auto second_script = parse(*interpreter, "1"sv);
+    for (size_t i = 2; i < 100; ++i) {
+        (void)parse(*interpreter, DeprecatedString::number(i));
+        // Keep using the first script, so it stays in the cache.
+        EXPECT_EQ(&parse(*interpreter, "0"sv)->parse_node(), &first_script->parse_node());
+    }
+    EXPECT_EQ(JS::Bytecode::CodeCache::the().size(), 64u);
+    EXPECT_NE(&parse(*interpreter, "1"sv)->parse_node(), &second_script->parse_node());
+}
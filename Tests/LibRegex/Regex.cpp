@@ -1155,3 +1155,234 @@ TEST_CASE(inversion_state_in_char_class)
         EXPECT_EQ(result.capture_group_matches.first()[1].view.to_deprecated_string(), "}"sv);
     }
 }
+
+TEST_CASE(lazy_dfa_eligibility)
+{
+    Array tests {
+        Tuple { "(a|b)*c"sv, true },
+        Tuple { "^[a-z]+@[a-z]+\\.com$"sv, true },
+        Tuple { "\\bfoo{2,3}\\b"sv, true },
+        Tuple { "(a)\\1"sv, false },
+        Tuple { "a(?=b)"sv, false },
+        Tuple { "a(?!b)"sv, false },
+        Tuple { "(?<=a)b"sv, false },
+    };
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.get<0>());
+        EXPECT_EQ(re.parser_result.error, regex::Error::NoError);
+        EXPECT_EQ(static_cast<bool>(re.lazy_dfa), test.get<1>());
+    }
+}
+
+TEST_CASE(lazy_dfa_rejects_without_backtracking)
+{
+    // Without the DFA, each of these takes exponential time to fail.
+    auto subject = DeprecatedString::repeated('a', 64);
+    {
+        Regex<ECMA262> re("(a|aa)*c"sv);
+        EXPECT_EQ(re.match(subject).success, false);
+        EXPECT_EQ(re.search(subject).success, false);
+    }
+    {
+        Regex<PosixExtended> re("(a|aa)*c"sv);
+        EXPECT_EQ(re.search(subject).success, false);
+    }
+}
+
+TEST_CASE(lazy_dfa_matches)
+{
+    {
+        Regex<ECMA262> re("(a|b)*c"sv, ECMAScriptFlags::Global);
+        auto result = re.match("xxababcxxaacxbx"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view, "ababc"sv);
+        EXPECT_EQ(result.matches[0].global_offset, 2u);
+        EXPECT_EQ(result.matches[1].view, "aac"sv);
+        EXPECT_EQ(result.capture_group_matches[1][0].view, "a"sv);
+    }
+    {
+        Regex<ECMA262> re("\\bfo{2,3}\\b"sv, ECMAScriptFlags::Global);
+        auto result = re.match("fo foo food fooo foooo"sv);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view, "foo"sv);
+        EXPECT_EQ(result.matches[1].view, "fooo"sv);
+    }
+    {
+        Regex<ECMA262> re("^ab+c$"sv, ECMAScriptFlags::Insensitive);
+        EXPECT_EQ(re.has_match("ABBBC"sv), true);
+        EXPECT_EQ(re.has_match("ABBBC!"sv), false);
+        EXPECT_EQ(re.has_match("AC"sv), false);
+    }
+    {
+        Regex<PosixExtended> re("hello world"sv, PosixFlags::Insensitive);
+        RegexResult result;
+        EXPECT_EQ(re.search("say Hello World!"sv, result), true);
+        EXPECT_EQ(result.matches[0].view, "Hello World"sv);
+        EXPECT_EQ(re.search("say Hello Word!"sv, result), false);
+    }
+    {
+        // Non-ASCII input isn't cached in the DFA, but has to give the same result.
+        Regex<ECMA262> re("[\\u00e4\\u00f6\\u00fc]+x"sv, ECMAScriptFlags::Unicode);
+        Array<u32, 6> code_points { 'a', 0xe4, 0xf6, 0xfc, 'x', 'y' };
+        auto result = re.search(Utf32View { code_points.data(), code_points.size() });
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches[0].global_offset, 1u);
+        EXPECT_EQ(result.matches[0].view.length(), 4u);
+    }
+}
+
+TEST_CASE(optimizer_literals_and_starting_ranges)
+{
+    {
+        Regex<PosixExtended> re("ERROR: .*timeout"sv);
+        auto const& data = re.parser_result.optimization_data;
+        EXPECT_EQ(data.literal_prefix, "ERROR: "sv);
+        EXPECT_EQ(data.required_literal, "timeout"sv);
+        EXPECT(data.starting_ranges.has_value());
+    }
+    {
+        Regex<ECMA262> re("(foo|bar)baz"sv);
+        auto const& data = re.parser_result.optimization_data;
+        EXPECT(!data.literal_prefix.has_value());
+        EXPECT_EQ(data.required_literal, "baz"sv);
+        EXPECT_EQ(data.starting_ranges->size(), 2u);
+    }
+    {
+        Regex<ECMA262> re("(x)?abc\\d"sv);
+        auto const& data = re.parser_result.optimization_data;
+        EXPECT(!data.literal_prefix.has_value());
+        EXPECT_EQ(data.required_literal, "abc"sv);
+        EXPECT_EQ(data.starting_ranges->size(), 2u);
+    }
+    {
+        // These can match the empty string, or anything at all.
+        Regex<ECMA262> re("a*"sv);
+        EXPECT(!re.parser_result.optimization_data.literal_prefix.has_value());
+        EXPECT(!re.parser_result.optimization_data.starting_ranges.has_value());
+        Regex<ECMA262> re2(".b"sv);
+        EXPECT_EQ(re2.parser_result.optimization_data.required_literal, "b"sv);
+        EXPECT(!re2.parser_result.optimization_data.starting_ranges.has_value());
+    }
+    {
+        // Negative lookahead has to fail, so its contents aren't required.
+        Regex<ECMA262> re("(?!abc)a"sv);
+        EXPECT(!re.parser_result.optimization_data.required_literal.has_value());
+        EXPECT(!re.parser_result.optimization_data.literal_prefix.has_value());
+    }
+}
+
+TEST_CASE(optimizer_literal_prefilter_matches)
+{
+    {
+        Regex<PosixExtended> re("ERROR: .*timeout"sv);
+        EXPECT_EQ(re.match("12:00 ERROR: upstream timeout"sv, PosixFlags::Global).success, true);
+        EXPECT_EQ(re.match("12:00 ERROR: upstream timed out"sv, PosixFlags::Global).success, false);
+        EXPECT_EQ(re.match("12:00 WARNING: upstream timeout"sv, PosixFlags::Global).success, false);
+        EXPECT_EQ(re.match("ERROR: timeout ERROR: timeout"sv, PosixFlags::Global).matches.size(), 1u);
+    }
+    {
+        Regex<ECMA262> re("ab(c|d)"sv, ECMAScriptFlags::Global);
+        auto result = re.match("xxabxabcxxabdab"sv);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].global_offset, 5u);
+        EXPECT_EQ(result.matches[1].global_offset, 10u);
+        EXPECT_EQ(result.capture_group_matches[1][0].view, "d"sv);
+    }
+    {
+        // Literals aren't used for case-insensitive matches, but the starting characters are.
+        Regex<ECMA262> re("abc"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+        auto result = re.match("xAbCxabc"sv);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view, "AbC"sv);
+        Regex<ECMA262> re2("[k-m]\\d"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+        EXPECT_EQ(re2.match("a1 K2 l3"sv).matches.size(), 2u);
+    }
+    {
+        // "ab" must not be found in the middle of the code units here.
+        Array<u16, 5> code_units { 0x6100, 0x6200, 0, 'a', 'b' };
+        Regex<ECMA262> re("ab"sv, ECMAScriptFlags::Global);
+        auto result = re.match(Utf16View { code_units.span() });
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches[0].global_offset, 3u);
+    }
+    {
+        Array<u32, 6> code_points { 0x61000000, 0x62, 'x', 'a', 'b', 'y' };
+        Regex<ECMA262> re("aby"sv, ECMAScriptFlags::Global);
+        auto result = re.match(Utf32View { code_points.data(), code_points.size() });
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches[0].global_offset, 3u);
+    }
+}
+
+TEST_CASE(compiled_pattern_cache)
+{
+    {
+        // The same pattern with other options must not reuse the bytecode.
+        Regex<ECMA262> re("a(?<word>b+)c"sv);
+        Regex<ECMA262> re_insensitive("a(?<word>b+)c"sv, ECMAScriptFlags::Insensitive);
+        EXPECT_EQ(re.match("ABBC"sv).success, false);
+        EXPECT_EQ(re_insensitive.match("ABBC"sv).success, true);
+    }
+    {
+        // Named groups refer to the pattern string, which has to outlive the Regex objects it was compiled for.
+        Regex<ECMA262> re("a(?<word>b+)c"sv);
+        auto result = re.match("abbbc"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.capture_group_matches[0][0].view, "bbb"sv);
+        EXPECT_EQ(result.capture_group_matches[0][0].capture_group_name, "word"sv);
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        Regex<ECMA262> re("a(b"sv);
+        EXPECT_EQ(re.parser_result.error, regex::Error::MismatchingParen);
+    }
+    {
+        // Overflow the cache, then compile the first patterns again.
+        for (size_t i = 0; i < 100; ++i) {
+            Regex<PosixExtended> re(DeprecatedString::formatted("x{}y", i));
+            EXPECT_EQ(re.match(DeprecatedString::formatted("ax{}yb", i), PosixFlags::Global).success, true);
+        }
+        Regex<PosixExtended> re("x0y"sv);
+        EXPECT_EQ(re.match("x0y"sv).success, true);
+        EXPECT_EQ(re.match("x1y"sv).success, false);
+    }
+}
+
+static DeprecatedString make_log(size_t line_count)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < line_count; ++i) {
+        if (i % 100 == 99)
+            builder.appendff("2023-05-01 12:{:02}:{:02} ERROR: request {} failed: upstream timeout\n", i / 60 % 60, i % 60, i);
+        else
+            builder.appendff("2023-05-01 12:{:02}:{:02} INFO: request {} served in {}ms by worker {}\n", i / 60 % 60, i % 60, i, i % 997, i % 8);
+    }
+    return builder.to_deprecated_string();
+}
+
+// Built on first use, so that runs which don't get to the benchmarks don't pay for it.
+static DeprecatedString const& benchmark_log()
+{
+    static auto log = make_log(100'000);
+    return log;
+}
+
+BENCHMARK_CASE(grep_log_lines)
+{
+    // Like grep, match every line on its own.
+    Regex<PosixExtended> re("ERROR: .*timeout"sv);
+    size_t matching_lines = 0;
+    for (auto line : benchmark_log().view().lines()) {
+        if (re.match(line, PosixFlags::Global).success)
+            ++matching_lines;
+    }
+    EXPECT_EQ(matching_lines, 1000u);
+}
+
+BENCHMARK_CASE(search_whole_log)
+{
+    Regex<ECMA262> re("failed: (\\w+) timeout"sv, ECMAScriptFlags::Global);
+    auto result = re.match(benchmark_log().view());
+    EXPECT_EQ(result.matches.size(), 1000u);
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <unistd.h>
+
+#include <AK/ScopeGuard.h>
+#include <AK/StringBuilder.h>
+#include <LibSQL/AST/Parser.h>
+#include <LibSQL/Database.h>
+#include <LibSQL/Result.h>
+#include <LibSQL/ResultSet.h>
+#include <LibTest/TestCase.h>
+
+namespace {
+
+constexpr char const* db_name = "/tmp/benchmark-join.db";
+constexpr size_t row_count = 1000;
+constexpr size_t query_count = 5;
+
+SQL::ResultSet execute(NonnullRefPtr<SQL::Database> database, StringView sql)
+{
+    auto parser = SQL::AST::Parser(SQL::AST::Lexer(sql));
+    auto statement = parser.next_statement();
+    VERIFY(!parser.has_errors());
+
+    return MUST(statement->execute(move(database)));
+}
+
+NonnullRefPtr<SQL::Database> create_tables(bool with_indexes)
+{
+    unlink(db_name);
+
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+
+    execute(database, "CREATE SCHEMA TestSchema;"sv);
+    execute(database, "CREATE TABLE TestSchema.TestTable1 ( TextColumn1 text, IntColumn integer );"sv);
+    execute(database, "CREATE TABLE TestSchema.TestTable2 ( TextColumn2 text, IntColumn integer );"sv);
+
+    if (with_indexes) {
+        execute(database, "CREATE INDEX TestSchema.TestIndex1 ON TestTable1 ( IntColumn );"sv);
+        execute(database, "CREATE INDEX TestSchema.TestIndex2 ON TestTable2 ( IntColumn );"sv);
+    }
+
+    for (auto table : { "TestTable1"sv, "TestTable2"sv }) {
+        StringBuilder builder;
+        builder.appendff("INSERT INTO TestSchema.{} VALUES ", table);
+
+        for (size_t i = 0; i < row_count; ++i) {
+            if (i != 0)
+                builder.append(", "sv);
+            builder.appendff("( 'T{}', {} )", i, (i * 7919) % row_count);
+        }
+
+        builder.append(';');
+        execute(database, builder.string_view());
+    }
+
+    return database;
+}
+
+void run_join(NonnullRefPtr<SQL::Database> database, StringView sql)
+{
+    for (size_t i = 0; i < query_count; ++i) {
+        auto result = execute(database, sql);
+        EXPECT_EQ(result.size(), row_count);
+    }
+}
+
+}
+
+// The join condition is an arithmetic expression here, so it can only be evaluated as a filter
+// on the cartesian product of both tables.
+BENCHMARK_CASE(nested_loop_join)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = create_tables(false);
+
+    run_join(database, "SELECT * FROM TestSchema.TestTable1, TestSchema.TestTable2 WHERE (TestTable1.IntColumn + 0) = TestTable2.IntColumn;"sv);
+}
+
+BENCHMARK_CASE(hash_join)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = create_tables(false);
+
+    run_join(database, "SELECT * FROM TestSchema.TestTable1, TestSchema.TestTable2 WHERE TestTable1.IntColumn = TestTable2.IntColumn;"sv);
+}
+
+BENCHMARK_CASE(merge_join)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = create_tables(true);
+
+    run_join(database, "SELECT * FROM TestSchema.TestTable1, TestSchema.TestTable2 WHERE TestTable1.IntColumn = TestTable2.IntColumn;"sv);
+}
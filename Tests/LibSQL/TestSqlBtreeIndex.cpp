@@ -317,3 +317,75 @@ TEST_CASE(btree_scan_50_keys)
 {
     insert_into_and_scan_btree(50);
 }
+
+TEST_CASE(btree_insert_sorted_builds_tree_bottom_up)
+{
+    ScopeGuard guard([]() { unlink("/tmp/test.db"); });
+    constexpr int num_keys = 10000;
+    {
+        auto heap = SQL::Heap::construct("/tmp/test.db");
+        TRY_OR_FAIL(heap->open());
+        SQL::Serializer serializer(heap);
+        auto btree = setup_btree(serializer);
+
+        // Every third key is left out, so that it can be inserted into the finished tree.
+        Vector<SQL::Key> sorted_keys;
+        for (auto ix = 0; ix < num_keys; ix++) {
+            if (ix % 3 == 0)
+                continue;
+            SQL::Key k(btree->descriptor());
+            k[0] = ix;
+            k.set_block_index(ix + 1);
+            sorted_keys.append(move(k));
+        }
+        EXPECT(btree->insert_sorted(move(sorted_keys)));
+
+        for (auto ix = 0; ix < num_keys; ix += 3) {
+            SQL::Key k(btree->descriptor());
+            k[0] = ix;
+            k.set_block_index(ix + 1);
+            EXPECT(btree->insert(k));
+        }
+
+        SQL::Key duplicate(btree->descriptor());
+        duplicate[0] = 1;
+        EXPECT(!btree->insert(duplicate));
+    }
+
+    {
+        auto heap = SQL::Heap::construct("/tmp/test.db");
+        TRY_OR_FAIL(heap->open());
+        SQL::Serializer serializer(heap);
+        auto btree = setup_btree(serializer);
+
+        for (auto ix = 0; ix < num_keys; ix++) {
+            SQL::Key k(btree->descriptor());
+            k[0] = ix;
+            auto pointer_opt = btree->get(k);
+            EXPECT(pointer_opt.has_value());
+            EXPECT_EQ(pointer_opt.value_or(0), static_cast<u32>(ix + 1));
+        }
+
+        int count = 0;
+        for (auto iter = btree->begin(); !iter.is_end(); iter++, count++)
+            EXPECT_EQ((*iter)[0].to_int<i32>(), count);
+        EXPECT_EQ(count, num_keys);
+    }
+}
+
+TEST_CASE(btree_insert_sorted_rejects_duplicates_in_unique_tree)
+{
+    ScopeGuard guard([]() { unlink("/tmp/test.db"); });
+    auto heap = SQL::Heap::construct("/tmp/test.db");
+    TRY_OR_FAIL(heap->open());
+    SQL::Serializer serializer(heap);
+    auto btree = setup_btree(serializer);
+
+    Vector<SQL::Key> sorted_keys;
+    for (auto value : { 1, 2, 2, 3 }) {
+        SQL::Key k(btree->descriptor());
+        k[0] = value;
+        sorted_keys.append(move(k));
+    }
+    EXPECT(!btree->insert_sorted(move(sorted_keys)));
+}
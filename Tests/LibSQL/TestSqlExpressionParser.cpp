@@ -306,6 +306,33 @@ TEST_CASE(cast_expression)
     validate("CAST (15 AS varchar(255))"sv, "VARCHAR"sv);
 }
 
+TEST_CASE(aggregate_expression)
+{
+    EXPECT(parse("COUNT("sv).is_error());
+    EXPECT(parse("COUNT()"sv).is_error());
+    EXPECT(parse("SUM(*)"sv).is_error());
+    EXPECT(parse("SUM(15"sv).is_error());
+    EXPECT(parse("MEDIAN(15)"sv).is_error());
+
+    auto validate = [](StringView sql, SQL::AST::AggregateFunction expected_function, bool expect_argument) {
+        auto expression = TRY_OR_FAIL(parse(sql));
+        EXPECT(is<SQL::AST::AggregateExpression>(*expression));
+
+        const auto& aggregate = static_cast<const SQL::AST::AggregateExpression&>(*expression);
+        EXPECT_EQ(aggregate.function(), expected_function);
+        EXPECT_EQ(!aggregate.argument().is_null(), expect_argument);
+        if (expect_argument)
+            EXPECT(!is<SQL::AST::ErrorExpression>(*aggregate.argument()));
+    };
+
+    validate("COUNT(*)"sv, SQL::AST::AggregateFunction::Count, false);
+    validate("count(column_name)"sv, SQL::AST::AggregateFunction::Count, true);
+    validate("SUM(a + b)"sv, SQL::AST::AggregateFunction::Sum, true);
+    validate("MIN(table_name.column_name)"sv, SQL::AST::AggregateFunction::Min, true);
+    validate("MAX(15)"sv, SQL::AST::AggregateFunction::Max, true);
+    validate("Avg(column_name)"sv, SQL::AST::AggregateFunction::Avg, true);
+}
+
 TEST_CASE(case_expression)
 {
     EXPECT(parse("CASE"sv).is_error());
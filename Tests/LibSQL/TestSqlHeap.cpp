@@ -192,3 +192,202 @@ TEST_CASE(heap_free_storage)
     auto new_heap_size = MUST(heap->file_size_in_bytes());
     EXPECT(new_heap_size <= heap_size);
 }
+
+TEST_CASE(heap_cache_evicts_dirty_blocks)
+{
+    ScopeGuard guard([]() { MUST(Core::System::unlink(db_path)); });
+
+    StringBuilder builder;
+    MUST(builder.try_append_repeated('x', SQL::Block::DATA_SIZE * 16));
+    auto long_string = builder.string_view();
+
+    SQL::Block::Index storage_block_id;
+    {
+        auto heap = create_heap();
+        MUST(heap->set_cache_capacity(4));
+        storage_block_id = heap->request_new_block_index();
+
+        // The storage does not fit in the cache, so dirty blocks have to be written to the file
+        TRY_OR_FAIL(heap->write_storage(storage_block_id, long_string.bytes()));
+        EXPECT(heap->cache_statistics().evictions > 0);
+
+        auto stored_long_string = TRY_OR_FAIL(heap->read_storage(storage_block_id));
+        EXPECT_EQ(long_string.bytes(), stored_long_string.bytes());
+        MUST(heap->flush());
+    }
+
+    // Read back after reopening the file
+    auto heap = create_heap();
+    auto stored_long_string = TRY_OR_FAIL(heap->read_storage(storage_block_id));
+    EXPECT_EQ(long_string.bytes(), stored_long_string.bytes());
+}
+
+TEST_CASE(heap_cache_reads_ahead_sequential_blocks)
+{
+    ScopeGuard guard([]() { MUST(Core::System::unlink(db_path)); });
+
+    Vector<SQL::Block::Index> block_ids;
+    {
+        auto heap = create_heap();
+        for (auto i = 0; i < 32; ++i) {
+            auto block_id = heap->request_new_block_index();
+            TRY_OR_FAIL(heap->write_storage(block_id, DeprecatedString::formatted("block {}", i).bytes()));
+            block_ids.append(block_id);
+        }
+        MUST(heap->flush());
+    }
+
+    auto heap = create_heap();
+    auto const& statistics = heap->cache_statistics();
+    auto misses_after_open = statistics.misses;
+
+    for (size_t i = 0; i < block_ids.size(); ++i) {
+        auto data = TRY_OR_FAIL(heap->read_storage(block_ids[i]));
+        EXPECT_EQ(StringView { data }, DeprecatedString::formatted("block {}", i));
+    }
+
+    EXPECT(statistics.blocks_read_ahead > 0);
+    EXPECT(statistics.hits > 0);
+    EXPECT(statistics.misses - misses_after_open < block_ids.size() / 2);
+
+    // Blocks which are already cached are not read again
+    auto misses = statistics.misses;
+    TRY_OR_FAIL(heap->read_storage(block_ids.last()));
+    EXPECT_EQ(statistics.misses, misses);
+}
+
+TEST_CASE(heap_cache_keeps_pinned_blocks)
+{
+    ScopeGuard guard([]() { MUST(Core::System::unlink(db_path)); });
+    auto heap = create_heap();
+
+    Vector<SQL::Block::Index> block_ids;
+    for (auto i = 0; i < 16; ++i) {
+        auto block_id = heap->request_new_block_index();
+        TRY_OR_FAIL(heap->write_storage(block_id, DeprecatedString::formatted("block {}", i).bytes()));
+        block_ids.append(block_id);
+    }
+    MUST(heap->flush());
+    MUST(heap->set_cache_capacity(2));
+
+    MUST(heap->pin_block(block_ids.first()));
+    for (auto block_id : block_ids)
+        TRY_OR_FAIL(heap->read_storage(block_id));
+
+    auto hits = heap->cache_statistics().hits;
+    TRY_OR_FAIL(heap->read_storage(block_ids.first()));
+    EXPECT_EQ(heap->cache_statistics().hits, hits + 1);
+    heap->unpin_block(block_ids.first());
+}
+
+static constexpr auto wal_path = "/tmp/test.db-wal"sv;
+static constexpr auto crashed_db_path = "/tmp/test-crashed.db"sv;
+static constexpr auto crashed_wal_path = "/tmp/test-crashed.db-wal"sv;
+
+static void copy_file(StringView from, StringView to, size_t bytes_to_drop = 0)
+{
+    auto source = MUST(Core::File::open(from, Core::File::OpenMode::Read));
+    auto contents = MUST(source->read_until_eof());
+    auto destination = MUST(Core::File::open(to, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    MUST(destination->write_until_depleted(contents.bytes().slice(0, contents.size() - bytes_to_drop)));
+}
+
+// Overwrites the same storage in two transactions, and keeps a copy of the heap file and its
+// write-ahead log as they were before the heap was closed.
+static SQL::Block::Index write_two_transactions_and_crash(StringView first_contents, StringView second_contents)
+{
+    auto heap = create_heap();
+    auto storage_block_id = heap->request_new_block_index();
+
+    MUST(heap->write_storage(storage_block_id, first_contents.bytes()));
+    MUST(heap->flush());
+    MUST(heap->write_storage(storage_block_id, second_contents.bytes()));
+    MUST(heap->flush());
+
+    copy_file(db_path, crashed_db_path);
+    copy_file(wal_path, crashed_wal_path);
+    return storage_block_id;
+}
+
+TEST_CASE(heap_recovers_committed_transactions_from_write_ahead_log)
+{
+    ScopeGuard guard([]() {
+        MUST(Core::System::unlink(db_path));
+        MUST(Core::System::unlink(crashed_db_path));
+    });
+
+    StringBuilder builder;
+    MUST(builder.try_append_repeated('x', SQL::Block::DATA_SIZE * 2));
+    auto first_contents = builder.to_deprecated_string();
+    builder.clear();
+    MUST(builder.try_append_repeated('y', SQL::Block::DATA_SIZE * 2));
+    auto second_contents = builder.to_deprecated_string();
+
+    auto storage_block_id = write_two_transactions_and_crash(first_contents, second_contents);
+
+    auto heap = MUST(SQL::Heap::try_create(crashed_db_path));
+    MUST(heap->open());
+    auto stored_contents = TRY_OR_FAIL(heap->read_storage(storage_block_id));
+    EXPECT_EQ(second_contents.bytes(), stored_contents.bytes());
+}
+
+TEST_CASE(heap_discards_partially_written_transaction)
+{
+    ScopeGuard guard([]() {
+        MUST(Core::System::unlink(db_path));
+        MUST(Core::System::unlink(crashed_db_path));
+    });
+
+    StringBuilder builder;
+    MUST(builder.try_append_repeated('x', SQL::Block::DATA_SIZE * 2));
+    auto first_contents = builder.to_deprecated_string();
+    builder.clear();
+    MUST(builder.try_append_repeated('y', SQL::Block::DATA_SIZE * 2));
+    auto second_contents = builder.to_deprecated_string();
+
+    auto storage_block_id = write_two_transactions_and_crash(first_contents, second_contents);
+
+    // Simulate a crash while the commit record of the second transaction was being written
+    copy_file(crashed_wal_path, crashed_wal_path, 1);
+
+    auto heap = MUST(SQL::Heap::try_create(crashed_db_path));
+    MUST(heap->open());
+    auto stored_contents = TRY_OR_FAIL(heap->read_storage(storage_block_id));
+    EXPECT_EQ(first_contents.bytes(), stored_contents.bytes());
+}
+
+TEST_CASE(heap_checkpoint_empties_write_ahead_log)
+{
+    ScopeGuard guard([]() { MUST(Core::System::unlink(db_path)); });
+    auto heap = create_heap();
+    auto storage_block_id = heap->request_new_block_index();
+
+    StringBuilder builder;
+    MUST(builder.try_append_repeated('x', SQL::Block::DATA_SIZE * 4));
+    auto long_string = builder.string_view();
+    TRY_OR_FAIL(heap->write_storage(storage_block_id, long_string.bytes()));
+    MUST(heap->flush());
+    EXPECT(MUST(Core::System::stat(wal_path)).st_size > 0);
+
+    MUST(heap->checkpoint());
+    EXPECT_EQ(MUST(Core::System::stat(wal_path)).st_size, 0);
+    EXPECT(MUST(heap->file_size_in_bytes()) >= 5 * SQL::Block::SIZE);
+
+    auto stored_long_string = TRY_OR_FAIL(heap->read_storage(storage_block_id));
+    EXPECT_EQ(long_string.bytes(), stored_long_string.bytes());
+}
+
+TEST_CASE(heap_does_not_create_write_ahead_log_for_invalid_file)
+{
+    ScopeGuard guard([]() { MUST(Core::System::unlink(db_path)); });
+    {
+        StringBuilder builder;
+        MUST(builder.try_append_repeated('x', SQL::Block::SIZE));
+        auto file = MUST(Core::File::open(db_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        MUST(file->write_until_depleted(builder.string_view().bytes()));
+    }
+
+    auto heap = MUST(SQL::Heap::try_create(db_path));
+    EXPECT(heap->open().is_error());
+    EXPECT(Core::System::stat(wal_path).is_error());
+}
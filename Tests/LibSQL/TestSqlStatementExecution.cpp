@@ -7,8 +7,11 @@
 
 #include <unistd.h>
 
+#include <AK/AnyOf.h>
+#include <AK/HashMap.h>
 #include <AK/QuickSort.h>
 #include <AK/ScopeGuard.h>
+#include <AK/StringBuilder.h>
 #include <LibSQL/AST/Parser.h>
 #include <LibSQL/Database.h>
 #include <LibSQL/Result.h>
@@ -384,6 +387,39 @@ TEST_CASE(select_inner_join)
     EXPECT_EQ(result[0].row[2].to_deprecated_string(), "Test_12");
 }
 
+TEST_CASE(select_join_with_filters_and_limit)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    create_two_tables(database);
+
+    for (auto count = 0; count < 20; ++count) {
+        auto result = execute(database, DeprecatedString::formatted("INSERT INTO TestSchema.TestTable1 VALUES ( 'T1_{}', {} );", count, count));
+        EXPECT_EQ(result.size(), 1u);
+        result = execute(database, DeprecatedString::formatted("INSERT INTO TestSchema.TestTable2 VALUES ( 'T2_{}', {} );", count, count % 5));
+        EXPECT_EQ(result.size(), 1u);
+    }
+
+    auto result = execute(database,
+        "SELECT TestTable1.IntColumn, TestTable2.IntColumn "
+        "FROM TestSchema.TestTable1, TestSchema.TestTable2 "
+        "WHERE (TestTable1.IntColumn < 10) AND (TestTable2.IntColumn = 3) AND ((TestTable1.IntColumn + TestTable2.IntColumn) > 10);");
+    EXPECT_EQ(result.size(), 8u);
+    for (auto& row : result) {
+        EXPECT(row.row[0].to_int<i32>().value() > 7);
+        EXPECT_EQ(row.row[1].to_int<i32>(), 3);
+    }
+
+    result = execute(database, "SELECT * FROM TestSchema.TestTable1, TestSchema.TestTable2 WHERE (TestTable2.IntColumn = 0) LIMIT 5 OFFSET 2;");
+    EXPECT_EQ(result.size(), 5u);
+    for (auto& row : result)
+        EXPECT_EQ(row.row[3].to_int<i32>(), 0);
+
+    result = execute(database, "SELECT TextColumn1 FROM TestSchema.TestTable1, TestSchema.TestTable2 WHERE (1 = 0);");
+    EXPECT(result.is_empty());
+}
+
 TEST_CASE(select_with_like)
 {
     ScopeGuard guard([]() { unlink(db_name); });
@@ -1060,4 +1096,586 @@ TEST_CASE(update_all_rows)
     }
 }
 
+void create_indexed_table(NonnullRefPtr<SQL::Database> database, size_t row_count)
+{
+    create_table(database);
+    auto result = execute(database, "CREATE INDEX TestSchema.TestIndex ON TestTable ( IntColumn );");
+    EXPECT_EQ(result.command(), SQL::SQLCommand::Create);
+
+    for (size_t count = 0; count < row_count; ++count) {
+        result = execute(database, DeprecatedString::formatted("INSERT INTO TestSchema.TestTable VALUES ( 'T{}', {} );", count, (count * 7) % row_count));
+        EXPECT_EQ(result.size(), 1u);
+    }
+}
+
+bool plan_contains(NonnullRefPtr<SQL::Database> database, DeprecatedString const& sql, StringView operator_description)
+{
+    auto result = execute(database, DeprecatedString::formatted("EXPLAIN {}", sql));
+    EXPECT_EQ(result.command(), SQL::SQLCommand::Explain);
+
+    return any_of(result, [&](auto const& row) { return row.row[0].to_deprecated_string().contains(operator_description); });
+}
+
+TEST_CASE(select_using_index)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    create_indexed_table(database, 20);
+
+    auto result = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable WHERE IntColumn = 7;");
+    EXPECT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0].row[0], "T1"sv);
+    EXPECT_EQ(result[0].row[1], 7);
+
+    result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE (IntColumn >= 5) AND (IntColumn < 10);");
+    EXPECT_EQ(result.size(), 5u);
+    for (size_t i = 0; i < result.size(); ++i)
+        EXPECT_EQ(result[i].row[0], 5 + i);
+
+    result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE IntColumn BETWEEN 3 AND 6;");
+    EXPECT_EQ(result.size(), 4u);
+    for (size_t i = 0; i < result.size(); ++i)
+        EXPECT_EQ(result[i].row[0], 3 + i);
+
+    result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE 12 < IntColumn;");
+    EXPECT_EQ(result.size(), 7u);
+    for (size_t i = 0; i < result.size(); ++i)
+        EXPECT_EQ(result[i].row[0], 13 + i);
+
+    result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE (IntColumn > 15) AND (TextColumn = 'T3');");
+    EXPECT_EQ(result.size(), 0u);
+
+    result = execute(database, "SELECT TextColumn FROM TestSchema.TestTable WHERE IntColumn = ?;", placeholders(14));
+    EXPECT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0].row[0], "T2"sv);
+
+    result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE IntColumn = 42;");
+    EXPECT(result.is_empty());
+}
+
+TEST_CASE(explain_index_selection)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    create_indexed_table(database, 10);
+
+    EXPECT(plan_contains(database, "SELECT * FROM TestSchema.TestTable WHERE IntColumn = 3;", "IndexScan TESTSCHEMA.TESTTABLE USING TESTINDEX (INTCOLUMN = 3)"sv));
+    EXPECT(plan_contains(database, "SELECT * FROM TestSchema.TestTable WHERE (IntColumn > 3) AND (IntColumn <= 5);", "(INTCOLUMN > 3 AND INTCOLUMN <= 5)"sv));
+    EXPECT(plan_contains(database, "SELECT * FROM TestSchema.TestTable WHERE IntColumn BETWEEN 3 AND 5;", "(INTCOLUMN >= 3 AND INTCOLUMN <= 5)"sv));
+    EXPECT(plan_contains(database, "SELECT * FROM TestSchema.TestTable WHERE TextColumn = 'T3';", "TableScan TESTSCHEMA.TESTTABLE"sv));
+    EXPECT(plan_contains(database, "SELECT * FROM TestSchema.TestTable WHERE IntColumn != 3;", "TableScan"sv));
+    EXPECT(plan_contains(database, "SELECT * FROM TestSchema.TestTable WHERE IntColumn = 3.5;", "TableScan"sv));
+    EXPECT(plan_contains(database, "DELETE FROM TestSchema.TestTable WHERE IntColumn = 3;", "IndexScan"sv));
+    EXPECT(plan_contains(database, "UPDATE TestSchema.TestTable SET TextColumn = 'x' WHERE IntColumn < 3;", "IndexScan"sv));
+
+    auto result = try_execute(database, "EXPLAIN INSERT INTO TestSchema.TestTable VALUES ( 'T', 1 );");
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.error().error(), SQL::SQLErrorCode::NotYetImplemented);
+}
+
+TEST_CASE(unique_index)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    create_table(database);
+
+    execute(database, "INSERT INTO TestSchema.TestTable VALUES ( 'T1', 1 ), ( 'T2', 2 ), ( 'T3', 2 );");
+
+    auto result = try_execute(database, "CREATE UNIQUE INDEX TestSchema.TestIndex ON TestTable ( IntColumn );");
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.error().error(), SQL::SQLErrorCode::UniqueConstraintViolated);
+
+    execute(database, "CREATE UNIQUE INDEX TestSchema.TestIndex ON TestTable ( TextColumn );");
+
+    result = try_execute(database, "CREATE INDEX TestSchema.TestIndex ON TestTable ( IntColumn );");
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.error().error(), SQL::SQLErrorCode::IndexExists);
+    execute(database, "CREATE INDEX IF NOT EXISTS TestSchema.TestIndex ON TestTable ( IntColumn );");
+
+    result = try_execute(database, "INSERT INTO TestSchema.TestTable VALUES ( 'T1', 4 );");
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.error().error(), SQL::SQLErrorCode::UniqueConstraintViolated);
+
+    result = try_execute(database, "UPDATE TestSchema.TestTable SET TextColumn = 'T1' WHERE IntColumn = 1;");
+    EXPECT(!result.is_error());
+
+    result = try_execute(database, "UPDATE TestSchema.TestTable SET TextColumn = 'T2' WHERE IntColumn = 1;");
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.error().error(), SQL::SQLErrorCode::UniqueConstraintViolated);
+
+    execute(database, "DELETE FROM TestSchema.TestTable WHERE TextColumn = 'T2';");
+    execute(database, "INSERT INTO TestSchema.TestTable VALUES ( 'T2', 5 );");
+
+    auto rows = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE TextColumn = 'T2';");
+    EXPECT_EQ(rows.size(), 1u);
+    EXPECT_EQ(rows[0].row[0], 5);
+}
+
+TEST_CASE(index_maintained_by_delete_and_update)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    {
+        auto database = SQL::Database::construct(db_name);
+        MUST(database->open());
+        create_indexed_table(database, 100);
+
+        auto result = execute(database, "DELETE FROM TestSchema.TestTable WHERE (IntColumn >= 10) AND (IntColumn < 20);");
+        EXPECT_EQ(result.size(), 10u);
+
+        result = execute(database, "UPDATE TestSchema.TestTable SET IntColumn = 1000 WHERE IntColumn < 5;");
+        EXPECT_EQ(result.size(), 5u);
+
+        result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE IntColumn < 30;");
+        EXPECT_EQ(result.size(), 15u);
+        for (size_t i = 0; i < 5; ++i)
+            EXPECT_EQ(result[i].row[0], 5 + i);
+        for (size_t i = 5; i < result.size(); ++i)
+            EXPECT_EQ(result[i].row[0], 15 + i);
+    }
+    {
+        auto database = SQL::Database::construct(db_name);
+        MUST(database->open());
+
+        auto result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE IntColumn = 1000;");
+        EXPECT_EQ(result.size(), 5u);
+
+        result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE IntColumn BETWEEN 0 AND 19;");
+        EXPECT_EQ(result.size(), 5u);
+
+        result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable;");
+        EXPECT_EQ(result.size(), 90u);
+
+        EXPECT(plan_contains(database, "SELECT * FROM TestSchema.TestTable WHERE IntColumn = 3;", "IndexScan"sv));
+    }
+}
+
+TEST_CASE(insert_multiple_rows_into_indexed_table)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    constexpr size_t row_count = 2000;
+    {
+        auto database = SQL::Database::construct(db_name);
+        MUST(database->open());
+        create_table(database);
+        execute(database, "CREATE UNIQUE INDEX TestSchema.TestIndex ON TestTable ( TextColumn );");
+
+        StringBuilder builder;
+        builder.append("INSERT INTO TestSchema.TestTable VALUES "sv);
+        for (size_t count = 0; count < row_count; ++count)
+            builder.appendff("{}( 'T{}', {} )", count > 0 ? ", "sv : ""sv, count, (count * 7) % row_count);
+        builder.append(';');
+
+        auto result = execute(database, builder.to_deprecated_string());
+        EXPECT_EQ(result.size(), row_count);
+
+        // The index on IntColumn is built from the rows which are already stored.
+        execute(database, "CREATE INDEX TestSchema.TestIndex2 ON TestTable ( IntColumn );");
+    }
+    {
+        auto database = SQL::Database::construct(db_name);
+        MUST(database->open());
+
+        auto result = execute(database, "SELECT TextColumn FROM TestSchema.TestTable WHERE IntColumn = 14;");
+        EXPECT_EQ(result.size(), 1u);
+        EXPECT_EQ(result[0].row[0], "T2"sv);
+
+        result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE TextColumn = 'T1999';");
+        EXPECT_EQ(result.size(), 1u);
+        EXPECT_EQ(result[0].row[0], (1999 * 7) % row_count);
+
+        result = execute(database, "SELECT IntColumn FROM TestSchema.TestTable WHERE IntColumn BETWEEN 100 AND 199;");
+        EXPECT_EQ(result.size(), 100u);
+        for (size_t i = 0; i < result.size(); ++i)
+            EXPECT_EQ(result[i].row[0], 100 + i);
+
+        // Rows are scanned from the most recently inserted one.
+        result = execute(database, "SELECT TextColumn FROM TestSchema.TestTable;");
+        EXPECT_EQ(result.size(), row_count);
+        EXPECT_EQ(result[0].row[0], "T1999"sv);
+        EXPECT_EQ(result[row_count - 1].row[0], "T0"sv);
+
+        // A constraint violation by any row of the statement stores none of its rows.
+        auto failed = try_execute(database, "INSERT INTO TestSchema.TestTable VALUES ( 'X1', 1 ), ( 'X2', 2 ), ( 'X1', 3 );");
+        EXPECT(failed.is_error());
+        EXPECT_EQ(failed.error().error(), SQL::SQLErrorCode::UniqueConstraintViolated);
+
+        failed = try_execute(database, "INSERT INTO TestSchema.TestTable VALUES ( 'X1', 1 ), ( 'T5', 2 );");
+        EXPECT(failed.is_error());
+        EXPECT_EQ(failed.error().error(), SQL::SQLErrorCode::UniqueConstraintViolated);
+
+        result = execute(database, "SELECT TextColumn FROM TestSchema.TestTable WHERE TextColumn = 'X1';");
+        EXPECT(result.is_empty());
+    }
+}
+
+TEST_CASE(primary_key)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    create_schema(database);
+
+    auto result = try_execute(database, "CREATE TABLE TestSchema.TestTable ( IntColumn integer PRIMARY KEY, OtherColumn integer PRIMARY KEY );");
+    EXPECT(result.is_error());
+
+    execute(database, "CREATE TABLE TestSchema.TestTable ( IntColumn integer PRIMARY KEY, TextColumn text );");
+    execute(database, "CREATE TABLE IF NOT EXISTS TestSchema.TestTable ( IntColumn integer PRIMARY KEY, TextColumn text );");
+    execute(database, "INSERT INTO TestSchema.TestTable VALUES ( 1, 'T1' ), ( 2, 'T2' );");
+
+    result = try_execute(database, "INSERT INTO TestSchema.TestTable VALUES ( 1, 'T3' );");
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.error().error(), SQL::SQLErrorCode::UniqueConstraintViolated);
+
+    auto rows = execute(database, "SELECT TextColumn FROM TestSchema.TestTable WHERE IntColumn = 2;");
+    EXPECT_EQ(rows.size(), 1u);
+    EXPECT_EQ(rows[0].row[0], "T2"sv);
+
+    EXPECT(plan_contains(database, "SELECT * FROM TestSchema.TestTable WHERE IntColumn = 2;", "USING TESTTABLE_PRIMARY_KEY"sv));
+}
+
+void populate_two_tables_for_join(NonnullRefPtr<SQL::Database> database, size_t outer_row_count, size_t inner_row_count)
+{
+    for (size_t count = 0; count < outer_row_count; ++count)
+        execute(database, DeprecatedString::formatted("INSERT INTO TestSchema.TestTable1 VALUES ( 'T1_{}', {} );", count, count % 10));
+    for (size_t count = 0; count < inner_row_count; ++count)
+        execute(database, DeprecatedString::formatted("INSERT INTO TestSchema.TestTable2 VALUES ( 'T2_{}', {} );", count, count));
+
+    execute(database, "INSERT INTO TestSchema.TestTable1 ( TextColumn1 ) VALUES ( 'T1_NULL' );");
+    execute(database, "INSERT INTO TestSchema.TestTable2 ( TextColumn2 ) VALUES ( 'T2_NULL' );");
+}
+
+void expect_equi_join_result(SQL::ResultSet const& result, size_t outer_row_count, size_t inner_row_count)
+{
+    size_t expected_row_count = 0;
+    for (size_t count = 0; count < outer_row_count; ++count) {
+        if ((count % 10) < inner_row_count)
+            ++expected_row_count;
+    }
+
+    EXPECT_EQ(result.size(), expected_row_count);
+
+    for (auto const& row : result) {
+        EXPECT_EQ(row.row[0], row.row[1]);
+        EXPECT_EQ(row.row[3].to_deprecated_string(), DeprecatedString::formatted("T2_{}", row.row[1]));
+    }
+
+    for (size_t i = 1; i < result.size(); ++i)
+        EXPECT(result[i - 1].row[0].compare(result[i].row[0]) <= 0);
+}
+
+TEST_CASE(select_hash_join)
+{
+    constexpr auto join_query = "SELECT TestTable1.IntColumn, TestTable2.IntColumn, TextColumn1, TextColumn2 "
+                                "FROM TestSchema.TestTable1, TestSchema.TestTable2 "
+                                "WHERE TestTable1.IntColumn = TestTable2.IntColumn ORDER BY TestTable1.IntColumn;"sv;
+
+    // The hash table is built from the smaller input, which is the inner input here...
+    {
+        ScopeGuard guard([]() { unlink(db_name); });
+        auto database = SQL::Database::construct(db_name);
+        MUST(database->open());
+        create_two_tables(database);
+        populate_two_tables_for_join(database, 30, 5);
+
+        EXPECT(plan_contains(database, join_query, "HashJoin ON TESTTABLE1.INTCOLUMN = TESTTABLE2.INTCOLUMN"sv));
+        expect_equi_join_result(execute(database, join_query), 30, 5);
+    }
+
+    // ...and the outer input here.
+    {
+        ScopeGuard guard([]() { unlink(db_name); });
+        auto database = SQL::Database::construct(db_name);
+        MUST(database->open());
+        create_two_tables(database);
+        populate_two_tables_for_join(database, 4, 20);
+
+        expect_equi_join_result(execute(database, join_query), 4, 20);
+    }
+
+    // The join condition may name the inner table first, and other join predicates still apply.
+    {
+        ScopeGuard guard([]() { unlink(db_name); });
+        auto database = SQL::Database::construct(db_name);
+        MUST(database->open());
+        create_two_tables(database);
+        populate_two_tables_for_join(database, 30, 5);
+
+        auto result = execute(database,
+            "SELECT TestTable1.IntColumn, TestTable2.IntColumn, TextColumn1, TextColumn2 "
+            "FROM TestSchema.TestTable1, TestSchema.TestTable2 "
+            "WHERE (TestTable2.IntColumn = TestTable1.IntColumn) AND (TextColumn1 != TextColumn2) AND (TestTable1.IntColumn < 3);");
+        EXPECT_EQ(result.size(), 9u);
+
+        auto empty_result = execute(database,
+            "SELECT * FROM TestSchema.TestTable1, TestSchema.TestTable2 "
+            "WHERE (TestTable1.IntColumn = TestTable2.IntColumn) AND (TestTable2.IntColumn > 100);");
+        EXPECT(empty_result.is_empty());
+    }
+}
+
+TEST_CASE(select_merge_join)
+{
+    constexpr auto join_query = "SELECT TestTable1.IntColumn, TestTable2.IntColumn, TextColumn1, TextColumn2 "
+                                "FROM TestSchema.TestTable1, TestSchema.TestTable2 "
+                                "WHERE TestTable1.IntColumn = TestTable2.IntColumn;"sv;
+
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    create_two_tables(database);
+    execute(database, "CREATE INDEX TestSchema.TestIndex1 ON TestTable1 ( IntColumn );");
+    execute(database, "CREATE INDEX TestSchema.TestIndex2 ON TestTable2 ( IntColumn );");
+    populate_two_tables_for_join(database, 30, 5);
+
+    EXPECT(plan_contains(database, join_query, "MergeJoin ON TESTTABLE1.INTCOLUMN = TESTTABLE2.INTCOLUMN"sv));
+    expect_equi_join_result(execute(database, join_query), 30, 5);
+
+    auto result = execute(database,
+        "SELECT TestTable1.IntColumn, TestTable2.IntColumn, TextColumn1, TextColumn2 "
+        "FROM TestSchema.TestTable1, TestSchema.TestTable2 "
+        "WHERE (TestTable1.IntColumn = TestTable2.IntColumn) AND (TestTable2.IntColumn BETWEEN 1 AND 2);");
+    EXPECT_EQ(result.size(), 6u);
+    for (auto const& row : result)
+        EXPECT(row.row[0] == 1 || row.row[0] == 2);
+}
+
+void insert_unordered_rows(NonnullRefPtr<SQL::Database> database, size_t row_count)
+{
+    create_table(database);
+    for (size_t count = 0; count < row_count; ++count) {
+        auto result = execute(database,
+            DeprecatedString::formatted("INSERT INTO TestSchema.TestTable ( TextColumn, IntColumn ) VALUES ( 'Test_{}', {} );", count, (count * 37) % 50));
+        EXPECT_EQ(result.size(), 1u);
+    }
+}
+
+void expect_sorted_by_int_column(NonnullRefPtr<SQL::Database> database, SQL::ResultSet const& result, size_t offset)
+{
+    // Rows with equal IntColumn values are expected in the order in which they are read from the table.
+    HashMap<DeprecatedString, size_t> scan_positions;
+    auto unordered = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable;");
+    for (size_t i = 0; i < unordered.size(); ++i)
+        scan_positions.set(unordered[i].row[0].to_deprecated_string(), i);
+
+    for (size_t i = 1; i < result.size(); ++i) {
+        auto previous = result[i - 1].row[1].to_int<i32>().value();
+        auto current = result[i].row[1].to_int<i32>().value();
+        EXPECT(previous <= current);
+
+        if (previous == current)
+            EXPECT(scan_positions.get(result[i - 1].row[0].to_deprecated_string()).value() < scan_positions.get(result[i].row[0].to_deprecated_string()).value());
+    }
+
+    if (!result.is_empty())
+        EXPECT_EQ(result[0].row[1].to_int<i32>().value(), static_cast<i32>(offset / 4));
+}
+
+TEST_CASE(select_with_order_spilling_to_disk)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    insert_unordered_rows(database, 200);
+
+    // Force the sort to write a sorted run to disk every few rows.
+    database->set_sort_memory_budget(256);
+
+    auto result = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable ORDER BY IntColumn;");
+    EXPECT_EQ(result.size(), 200u);
+    expect_sorted_by_int_column(database, result, 0);
+
+    result = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable ORDER BY IntColumn DESC, TextColumn;");
+    EXPECT_EQ(result.size(), 200u);
+    for (size_t i = 1; i < result.size(); ++i) {
+        auto previous = result[i - 1].row[1].to_int<i32>().value();
+        auto current = result[i].row[1].to_int<i32>().value();
+        EXPECT(previous > current || (previous == current && result[i - 1].row[0].to_deprecated_string() < result[i].row[0].to_deprecated_string()));
+    }
+
+    result = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable WHERE IntColumn = 50 ORDER BY IntColumn;");
+    EXPECT(result.is_empty());
+}
+
+TEST_CASE(select_with_order_and_limit_uses_top_n)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    insert_unordered_rows(database, 200);
+
+    EXPECT(plan_contains(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable ORDER BY IntColumn LIMIT 10 OFFSET 5;", "TopN 15"sv));
+    EXPECT(plan_contains(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable ORDER BY IntColumn;", "Sort"sv));
+
+    auto result = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable ORDER BY IntColumn LIMIT 10 OFFSET 5;");
+    EXPECT_EQ(result.size(), 10u);
+    expect_sorted_by_int_column(database, result, 5);
+
+    // Compare with a sort of all rows, which is limited afterwards.
+    auto all_rows = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable ORDER BY IntColumn;");
+    for (size_t i = 0; i < result.size(); ++i)
+        EXPECT_EQ(result[i].row[0], all_rows[i + 5].row[0]);
+
+    result = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable ORDER BY IntColumn LIMIT 0;");
+    EXPECT(result.is_empty());
+
+    result = execute(database, "SELECT TextColumn, IntColumn FROM TestSchema.TestTable ORDER BY IntColumn LIMIT 500 OFFSET 190;");
+    EXPECT_EQ(result.size(), 10u);
+    EXPECT_EQ(result[9].row[1].to_int<i32>().value(), 49);
+}
+
+TEST_CASE(select_in_batches)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    insert_unordered_rows(database, 1000);
+
+    auto execute_in_batches = [&](StringView sql, Vector<size_t>& batch_sizes, Vector<SQL::Value>& values) {
+        auto parser = SQL::AST::Parser(SQL::AST::Lexer(sql));
+        auto statement = parser.next_statement();
+        EXPECT(!parser.has_errors());
+
+        return statement->execute(database, {}, 256, [&](SQL::ResultSet& batch) -> ErrorOr<void> {
+            EXPECT_EQ(batch.column_names().size(), 1u);
+            batch_sizes.append(batch.size());
+            for (auto& row : batch)
+                values.append(row.row[0]);
+            return {};
+        });
+    };
+
+    Vector<size_t> batch_sizes;
+    Vector<SQL::Value> values;
+    auto result = execute_in_batches("SELECT IntColumn FROM TestSchema.TestTable ORDER BY IntColumn;"sv, batch_sizes, values);
+    EXPECT(!result.is_error());
+    EXPECT(result.value().is_empty());
+    EXPECT_EQ(result.value().command(), SQL::SQLCommand::Select);
+    EXPECT_EQ(batch_sizes, (Vector<size_t> { 256, 256, 256, 232 }));
+    EXPECT_EQ(values.size(), 1000u);
+    for (size_t i = 1; i < values.size(); ++i)
+        EXPECT(values[i - 1] <= values[i]);
+
+    batch_sizes.clear();
+    values.clear();
+    result = execute_in_batches("SELECT IntColumn FROM TestSchema.TestTable WHERE IntColumn > 1000;"sv, batch_sizes, values);
+    EXPECT(!result.is_error());
+    EXPECT(result.value().is_empty());
+    EXPECT(batch_sizes.is_empty());
+
+    // Statements other than SELECT return their rows as usual.
+    result = execute_in_batches("UPDATE TestSchema.TestTable SET IntColumn = 1 WHERE IntColumn = 0;"sv, batch_sizes, values);
+    EXPECT(!result.is_error());
+    EXPECT_EQ(result.value().size(), 20u);
+    EXPECT(batch_sizes.is_empty());
+}
+
+TEST_CASE(select_aggregates_without_group_by)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    create_table(database);
+
+    auto result = execute(database, "SELECT COUNT(*), COUNT(IntColumn), SUM(IntColumn), MIN(IntColumn), MAX(IntColumn), AVG(IntColumn) FROM TestSchema.TestTable;");
+    EXPECT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0].row[0], SQL::Value(0));
+    EXPECT_EQ(result[0].row[1], SQL::Value(0));
+    for (size_t i = 2; i < 6; ++i)
+        EXPECT(result[0].row[i].is_null());
+
+    execute(database, "INSERT INTO TestSchema.TestTable ( TextColumn, IntColumn ) VALUES ( 'a', 4 ), ( 'c', 1 ), ( 'd', 7 );");
+    execute(database, "INSERT INTO TestSchema.TestTable ( TextColumn ) VALUES ( 'b' );");
+
+    result = execute(database, "SELECT COUNT(*), count(IntColumn), SUM(IntColumn), MIN(IntColumn), MAX(IntColumn), AVG(IntColumn), MIN(TextColumn) FROM TestSchema.TestTable;");
+    EXPECT_EQ(result.size(), 1u);
+    EXPECT_EQ(result.column_names(), (Vector<DeprecatedString> { "COUNT", "COUNT", "SUM", "MIN", "MAX", "AVG", "MIN" }));
+    EXPECT_EQ(result[0].row[0], SQL::Value(4));
+    EXPECT_EQ(result[0].row[1], SQL::Value(3));
+    EXPECT_EQ(result[0].row[2], SQL::Value(12));
+    EXPECT_EQ(result[0].row[3], SQL::Value(1));
+    EXPECT_EQ(result[0].row[4], SQL::Value(7));
+    EXPECT_EQ(result[0].row[5], SQL::Value(4.0));
+    EXPECT_EQ(result[0].row[6].to_deprecated_string(), "a");
+
+    result = execute(database, "SELECT COUNT(*) + SUM(IntColumn) * 2 AS Total FROM TestSchema.TestTable WHERE IntColumn > 1;");
+    EXPECT_EQ(result.size(), 1u);
+    EXPECT_EQ(result.column_names()[0], "TOTAL");
+    EXPECT_EQ(result[0].row[0], SQL::Value(24));
+
+    auto error = try_execute(database, "SELECT SUM(TextColumn) FROM TestSchema.TestTable;");
+    EXPECT(error.is_error());
+    EXPECT(error.release_error().error() == SQL::SQLErrorCode::NumericOperatorTypeMismatch);
+}
+
+TEST_CASE(select_aggregates_with_group_by)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    create_table(database);
+
+    StringBuilder builder;
+    builder.append("INSERT INTO TestSchema.TestTable ( TextColumn, IntColumn ) VALUES "sv);
+    for (int i = 0; i < 100; ++i)
+        builder.appendff("{}( 'Group{}', {} )", i == 0 ? "" : ", ", i % 4, i);
+    builder.append(';');
+    execute(database, builder.to_deprecated_string());
+    execute(database, "INSERT INTO TestSchema.TestTable ( IntColumn ) VALUES ( 1000 ), ( 2000 );");
+
+    auto result = execute(database, "SELECT TextColumn, COUNT(*), SUM(IntColumn), MIN(IntColumn), MAX(IntColumn), AVG(IntColumn) FROM TestSchema.TestTable GROUP BY TextColumn ORDER BY TextColumn;");
+    EXPECT_EQ(result.size(), 5u);
+
+    // NULL values form a single group, which sorts first.
+    EXPECT(result[0].row[0].is_null());
+    EXPECT_EQ(result[0].row[1], SQL::Value(2));
+    EXPECT_EQ(result[0].row[2], SQL::Value(3000));
+
+    for (int group = 0; group < 4; ++group) {
+        auto const& row = result[group + 1].row;
+        EXPECT_EQ(row[0].to_deprecated_string(), DeprecatedString::formatted("Group{}", group));
+        EXPECT_EQ(row[1], SQL::Value(25));
+        EXPECT_EQ(row[2], SQL::Value(1200 + 25 * group));
+        EXPECT_EQ(row[3], SQL::Value(group));
+        EXPECT_EQ(row[4], SQL::Value(96 + group));
+        EXPECT_EQ(row[5], SQL::Value(48.0 + group));
+    }
+
+    result = execute(database, "SELECT TextColumn, SUM(IntColumn) FROM TestSchema.TestTable GROUP BY TextColumn HAVING SUM(IntColumn) BETWEEN 1240 AND 2999 ORDER BY SUM(IntColumn) DESC;");
+    EXPECT_EQ(result.size(), 2u);
+    EXPECT_EQ(result[0].row[0].to_deprecated_string(), "Group3");
+    EXPECT_EQ(result[1].row[0].to_deprecated_string(), "Group2");
+
+    result = execute(database, "SELECT COUNT(*) FROM TestSchema.TestTable WHERE IntColumn > 5000 GROUP BY TextColumn;");
+    EXPECT(result.is_empty());
+
+    result = execute(database, "SELECT TextColumn FROM TestSchema.TestTable GROUP BY TextColumn ORDER BY TextColumn LIMIT 2 OFFSET 1;");
+    EXPECT_EQ(result.size(), 2u);
+    EXPECT_EQ(result[0].row[0].to_deprecated_string(), "Group0");
+    EXPECT_EQ(result[1].row[0].to_deprecated_string(), "Group1");
+
+    EXPECT(plan_contains(database, "SELECT TextColumn, COUNT(*) FROM TestSchema.TestTable GROUP BY TextColumn;", "HashAggregate"sv));
+}
+
+TEST_CASE(select_aggregates_misuse)
+{
+    ScopeGuard guard([]() { unlink(db_name); });
+    auto database = SQL::Database::construct(db_name);
+    MUST(database->open());
+    create_table(database);
+
+    auto expect_misuse = [&](StringView sql) {
+        auto result = try_execute(database, sql);
+        EXPECT(result.is_error());
+        EXPECT(result.release_error().error() == SQL::SQLErrorCode::AggregateMisuse);
+    };
+
+    expect_misuse("SELECT TextColumn FROM TestSchema.TestTable WHERE COUNT(*) > 1;"sv);
+    expect_misuse("SELECT COUNT(*) FROM TestSchema.TestTable GROUP BY SUM(IntColumn);"sv);
+    expect_misuse("SELECT SUM(COUNT(*)) FROM TestSchema.TestTable;"sv);
+    expect_misuse("UPDATE TestSchema.TestTable SET IntColumn = MAX(IntColumn);"sv);
+}
+
 }
@@ -63,6 +63,7 @@ TEST_CASE(create_table)
         StringView name;
         StringView type;
         Vector<double> signed_numbers {};
+        bool is_primary_key { false };
     };
 
     auto validate = [](StringView sql, StringView expected_schema, StringView expected_table, Vector<Column> expected_columns, bool expected_is_temporary = false, bool expected_is_error_if_table_exists = true) {
@@ -92,6 +93,7 @@ TEST_CASE(create_table)
 
             const auto& type_name = column->type_name();
             EXPECT_EQ(type_name->name(), expected_column.type);
+            EXPECT_EQ(column->is_primary_key(), expected_column.is_primary_key);
 
             const auto& signed_numbers = type_name->signed_numbers();
             EXPECT_EQ(signed_numbers.size(), expected_column.signed_numbers.size());
@@ -124,6 +126,44 @@ TEST_CASE(create_table)
     validate("CREATE TABLE test ( column1 varchar(0xff) );"sv, {}, "TEST"sv, { { "COLUMN1"sv, "VARCHAR"sv, { 255 } } });
     validate("CREATE TABLE test ( column1 varchar(3.14) );"sv, {}, "TEST"sv, { { "COLUMN1"sv, "VARCHAR"sv, { 3.14 } } });
     validate("CREATE TABLE test ( column1 varchar(1e3) );"sv, {}, "TEST"sv, { { "COLUMN1"sv, "VARCHAR"sv, { 1000 } } });
+
+    validate("CREATE TABLE test ( column1 int PRIMARY KEY, column2 text );"sv, {}, "TEST"sv, { { "COLUMN1"sv, "INT"sv, {}, true }, { "COLUMN2"sv, "TEXT"sv } });
+    EXPECT(parse("CREATE TABLE test ( column1 int PRIMARY );"sv).is_error());
+}
+
+TEST_CASE(create_index)
+{
+    EXPECT(parse("CREATE INDEX"sv).is_error());
+    EXPECT(parse("CREATE INDEX index_name"sv).is_error());
+    EXPECT(parse("CREATE INDEX index_name ON"sv).is_error());
+    EXPECT(parse("CREATE INDEX index_name ON table_name"sv).is_error());
+    EXPECT(parse("CREATE INDEX index_name ON table_name ()"sv).is_error());
+    EXPECT(parse("CREATE INDEX index_name ON table_name ( column1 )"sv).is_error());
+    EXPECT(parse("CREATE INDEX IF index_name ON table_name ( column1 );"sv).is_error());
+    EXPECT(parse("CREATE UNIQUE index_name ON table_name ( column1 );"sv).is_error());
+
+    auto validate = [](StringView sql, StringView expected_schema, StringView expected_index, StringView expected_table, Vector<StringView> expected_columns, bool expected_is_unique = false, bool expected_is_error_if_index_exists = true) {
+        auto statement = TRY_OR_FAIL(parse(sql));
+        EXPECT(is<SQL::AST::CreateIndex>(*statement));
+
+        const auto& index = static_cast<const SQL::AST::CreateIndex&>(*statement);
+        EXPECT_EQ(index.schema_name(), expected_schema);
+        EXPECT_EQ(index.index_name(), expected_index);
+        EXPECT_EQ(index.table_name(), expected_table);
+        EXPECT_EQ(index.is_unique(), expected_is_unique);
+        EXPECT_EQ(index.is_error_if_index_exists(), expected_is_error_if_index_exists);
+
+        const auto& columns = index.column_names();
+        EXPECT_EQ(columns.size(), expected_columns.size());
+        for (size_t i = 0; i < columns.size(); ++i)
+            EXPECT_EQ(columns[i], expected_columns[i]);
+    };
+
+    validate("CREATE INDEX index_name ON table_name ( column1 );"sv, {}, "INDEX_NAME"sv, "TABLE_NAME"sv, { "COLUMN1"sv });
+    validate("CREATE INDEX index_name ON table_name ( column1, column2 );"sv, {}, "INDEX_NAME"sv, "TABLE_NAME"sv, { "COLUMN1"sv, "COLUMN2"sv });
+    validate("CREATE INDEX schema_name.index_name ON table_name ( column1 );"sv, "SCHEMA_NAME"sv, "INDEX_NAME"sv, "TABLE_NAME"sv, { "COLUMN1"sv });
+    validate("CREATE UNIQUE INDEX index_name ON table_name ( column1 );"sv, {}, "INDEX_NAME"sv, "TABLE_NAME"sv, { "COLUMN1"sv }, true);
+    validate("CREATE INDEX IF NOT EXISTS index_name ON table_name ( column1 );"sv, {}, "INDEX_NAME"sv, "TABLE_NAME"sv, { "COLUMN1"sv }, false, false);
 }
 
 TEST_CASE(alter_table)
@@ -783,3 +823,22 @@ TEST_CASE(describe_table)
     validate("DESCRIBE TABLE TableName;"sv, {}, "TABLENAME"sv);
     validate("DESCRIBE TABLE SchemaName.TableName;"sv, "SCHEMANAME"sv, "TABLENAME"sv);
 }
+
+TEST_CASE(explain)
+{
+    EXPECT(parse("EXPLAIN"sv).is_error());
+    EXPECT(parse("EXPLAIN;"sv).is_error());
+    EXPECT(parse("EXPLAIN QUERY;"sv).is_error());
+    EXPECT(parse("EXPLAIN SELECT * FROM table_name"sv).is_error());
+
+    auto validate = [](StringView sql) {
+        auto statement = TRY_OR_FAIL(parse(sql));
+        EXPECT(is<SQL::AST::Explain>(*statement));
+
+        const auto& explain = static_cast<const SQL::AST::Explain&>(*statement);
+        EXPECT(is<SQL::AST::Select>(*explain.statement()));
+    };
+
+    validate("EXPLAIN SELECT * FROM table_name;"sv);
+    validate("EXPLAIN QUERY PLAN SELECT * FROM table_name WHERE column_name = 1;"sv);
+}
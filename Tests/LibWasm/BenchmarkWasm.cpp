@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibTest/TestCase.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/Types.h>
+
+// The module exports one function per benchmark, each of which spends its time in a different part of the
+// interpreter, e.g.
+// (func $loop_sum (param $n i32) (result i32) (local $i i32) (local $sum i32)
+//     (block (loop
+//         (br_if 1 (i32.ge_s (local.get $i) (local.get $n)))
+//         (local.set $sum (i32.add (local.get $sum) (local.get $i)))
+//         (local.set $i (i32.add (local.get $i) (i32.const 1)))
+//         (br 0)))
+//     (local.get $sum))
+// clang-format off
+static constexpr u8 module_bytes[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f,
+    0x03, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0x01, 0x00, 0x01, 0x07, 0x29, 0x04, 0x03,
+    0x66, 0x69, 0x62, 0x00, 0x00, 0x08, 0x6c, 0x6f, 0x6f, 0x70, 0x5f, 0x73, 0x75, 0x6d, 0x00, 0x01,
+    0x07, 0x63, 0x6f, 0x6c, 0x6c, 0x61, 0x74, 0x7a, 0x00, 0x02, 0x0a, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+    0x79, 0x5f, 0x73, 0x75, 0x6d, 0x00, 0x03, 0x0a, 0xe0, 0x01, 0x04, 0x1c, 0x00, 0x20, 0x00, 0x41,
+    0x02, 0x48, 0x04, 0x40, 0x20, 0x00, 0x0f, 0x0b, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x10, 0x00, 0x20,
+    0x00, 0x41, 0x02, 0x6b, 0x10, 0x00, 0x6a, 0x0b, 0x23, 0x01, 0x02, 0x7f, 0x02, 0x40, 0x03, 0x40,
+    0x20, 0x01, 0x20, 0x00, 0x4e, 0x0d, 0x01, 0x20, 0x02, 0x20, 0x01, 0x6a, 0x21, 0x02, 0x20, 0x01,
+    0x41, 0x01, 0x6a, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x20, 0x02, 0x0b, 0x52, 0x01, 0x03, 0x7f,
+    0x41, 0x01, 0x21, 0x01, 0x02, 0x40, 0x03, 0x40, 0x20, 0x01, 0x20, 0x00, 0x4a, 0x0d, 0x01, 0x20,
+    0x01, 0x21, 0x02, 0x02, 0x40, 0x03, 0x40, 0x20, 0x02, 0x41, 0x01, 0x4c, 0x0d, 0x01, 0x20, 0x02,
+    0x41, 0x01, 0x71, 0x04, 0x7f, 0x20, 0x02, 0x41, 0x03, 0x6c, 0x41, 0x01, 0x6a, 0x05, 0x20, 0x02,
+    0x41, 0x01, 0x76, 0x0b, 0x21, 0x02, 0x20, 0x03, 0x41, 0x01, 0x6a, 0x21, 0x03, 0x0c, 0x00, 0x0b,
+    0x0b, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x20, 0x03, 0x0b, 0x4a,
+    0x01, 0x02, 0x7f, 0x02, 0x40, 0x03, 0x40, 0x20, 0x01, 0x20, 0x00, 0x4e, 0x0d, 0x01, 0x20, 0x01,
+    0x20, 0x01, 0x41, 0x07, 0x6c, 0x3a, 0x00, 0x00, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x21, 0x01, 0x0c,
+    0x00, 0x0b, 0x0b, 0x41, 0x00, 0x21, 0x01, 0x02, 0x40, 0x03, 0x40, 0x20, 0x01, 0x20, 0x00, 0x4e,
+    0x0d, 0x01, 0x20, 0x02, 0x20, 0x01, 0x2d, 0x00, 0x00, 0x6a, 0x21, 0x02, 0x20, 0x01, 0x41, 0x01,
+    0x6a, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x20, 0x02, 0x0b,
+};
+// clang-format on
+
+// Calls the exported function `name` with `argument` the given number of times, and returns the last result.
+static i32 invoke_repeatedly(StringView name, i32 argument, size_t repetitions)
+{
+    FixedMemoryStream stream { ReadonlyBytes { module_bytes, sizeof(module_bytes) } };
+    auto module = Wasm::Module::parse(stream);
+    VERIFY(!module.is_error());
+
+    Wasm::AbstractMachine machine;
+    auto instance = machine.instantiate(module.value(), {});
+    VERIFY(!instance.is_error());
+
+    Optional<Wasm::FunctionAddress> address;
+    for (auto& entry : instance.value()->exports()) {
+        if (entry.name() == name)
+            address = entry.value().get<Wasm::FunctionAddress>();
+    }
+    VERIFY(address.has_value());
+
+    i32 result = 0;
+    for (size_t i = 0; i < repetitions; ++i) {
+        auto call_result = machine.invoke(*address, { Wasm::Value(argument) });
+        VERIFY(!call_result.is_trap());
+        result = call_result.values().first().to<i32>().value();
+    }
+    return result;
+}
+
+// Recursive calls: fib(n - 1) + fib(n - 2).
+BENCHMARK_CASE(calls)
+{
+    EXPECT_EQ(invoke_repeatedly("fib"sv, 20, 10), 6765);
+}
+
+// A loop that adds locals and leaves on a comparison.
+BENCHMARK_CASE(loop)
+{
+    EXPECT_EQ(invoke_repeatedly("loop_sum"sv, 100000, 10), 704982704);
+}
+
+// Nested loops with an if/else in the inner one: The total number of Collatz steps for 1..n.
+BENCHMARK_CASE(branches)
+{
+    EXPECT_EQ(invoke_repeatedly("collatz"sv, 1000, 10), 59542);
+}
+
+// Stores n bytes to memory and then adds them up again.
+BENCHMARK_CASE(memory)
+{
+    EXPECT_EQ(invoke_repeatedly("memory_sum"sv, 65536, 10), 8355840);
+}
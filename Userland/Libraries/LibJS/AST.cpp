@@ -17,6 +17,7 @@
 #include <LibJS/AST.h>
 #include <LibJS/Heap/MarkedVector.h>
 #include <LibJS/Interpreter.h>
+#include <LibJS/Parser.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
@@ -221,6 +222,22 @@ void LabelledStatement::dump(int indent) const
     m_labelled_item->dump(indent + 2);
 }
 
+Result<NonnullRefPtr<FunctionBody const>, ParserError> FunctionBody::parsed_body() const
+{
+    if (m_parsed_body)
+        return NonnullRefPtr<FunctionBody const> { *m_parsed_body };
+    if (!m_deferred_parse)
+        return NonnullRefPtr<FunctionBody const> { *this };
+
+    auto parsed_body = Parser::parse_deferred_function_body(source_code(), *m_deferred_parse);
+    if (parsed_body.is_error())
+        return parsed_body.release_error().take_first();
+
+    m_parsed_body = parsed_body.release_value();
+    m_deferred_parse = nullptr;
+    return NonnullRefPtr<FunctionBody const> { *m_parsed_body };
+}
+
 // 10.2.1.3 Runtime Semantics: EvaluateBody, https://tc39.es/ecma262/#sec-runtime-semantics-evaluatebody
 Completion FunctionBody::execute(Interpreter& interpreter) const
 {
@@ -2507,6 +2524,12 @@ void FunctionNode::dump(int indent, DeprecatedString const& class_name) const
     }
     print_indent(indent + 1);
     outln("(Body)");
+    if (is<FunctionBody>(body())) {
+        if (auto parsed_body = static_cast<FunctionBody const&>(body()).parsed_body(); !parsed_body.is_error()) {
+            parsed_body.value()->dump(indent + 2);
+            return;
+        }
+    }
     body().dump(indent + 2);
 }
 
@@ -13,6 +13,7 @@
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
+#include <AK/Result.h>
 #include <AK/Variant.h>
 #include <AK/Vector.h>
 #include <LibJS/Bytecode/CodeGenerationError.h>
@@ -78,6 +79,7 @@ public:
     virtual bool is_identifier() const { return false; }
     virtual bool is_private_identifier() const { return false; }
     virtual bool is_scope_node() const { return false; }
+    virtual bool is_function_body() const { return false; }
     virtual bool is_program() const { return false; }
     virtual bool is_class_declaration() const { return false; }
     virtual bool is_function_declaration() const { return false; }
@@ -565,19 +567,46 @@ public:
 
 class FunctionBody final : public ScopeNode {
 public:
+    // The parser only keeps the statements of most function bodies until it has checked them for errors.
+    // This is what it needs to know to parse such a body again, once the function is called.
+    struct DeferredParse {
+        DeprecatedString source;
+        Position start;
+        FunctionKind kind { FunctionKind::Normal };
+        bool is_module { false };
+        bool strict_mode { false };
+        bool in_formal_parameter_context { false };
+        bool in_arrow_function_context { false };
+    };
+
     explicit FunctionBody(SourceRange source_range)
         : ScopeNode(source_range)
     {
     }
 
+    FunctionBody(SourceRange source_range, DeferredParse deferred_parse)
+        : ScopeNode(source_range)
+        , m_deferred_parse(make<DeferredParse>(move(deferred_parse)))
+    {
+    }
+
     void set_strict_mode() { m_in_strict_mode = true; }
 
     bool in_strict_mode() const { return m_in_strict_mode; }
 
+    // Returns this body if it was fully parsed, or otherwise parses it now.
+    // NOTE: Parsing the body again can still fail, as it's then parsed without most of the surrounding code.
+    Result<NonnullRefPtr<FunctionBody const>, ParserError> parsed_body() const;
+
     virtual Completion execute(Interpreter&) const override;
 
 private:
+    virtual bool is_function_body() const override { return true; }
+
     bool m_in_strict_mode { false };
+
+    mutable OwnPtr<DeferredParse> m_deferred_parse;
+    mutable RefPtr<FunctionBody const> m_parsed_body;
 };
 
 class Expression : public ASTNode {
@@ -1048,6 +1077,10 @@ public:
     virtual void dump(int indent) const override;
     virtual Bytecode::CodeGenerationErrorOr<void> generate_bytecode(Bytecode::Generator&) const override;
 
+    BinaryOp op() const { return m_op; }
+    Expression const& lhs() const { return *m_lhs; }
+    Expression const& rhs() const { return *m_rhs; }
+
 private:
     BinaryOp m_op;
     NonnullRefPtr<Expression const> m_lhs;
@@ -2241,6 +2274,9 @@ inline bool ASTNode::fast_is<SuperExpression>() const { return is_super_expressi
 template<>
 inline bool ASTNode::fast_is<FunctionExpression>() const { return is_function_expression(); }
 
+template<>
+inline bool ASTNode::fast_is<FunctionBody>() const { return is_function_body(); }
+
 template<>
 inline bool ASTNode::fast_is<ClassExpression>() const { return is_class_expression(); }
 
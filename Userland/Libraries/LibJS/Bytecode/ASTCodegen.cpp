@@ -416,7 +416,7 @@ Bytecode::CodeGenerationErrorOr<void> AssignmentExpression::generate_bytecode(By
                         generator.emit<Bytecode::Op::PutByValue>(*base_object_register, *computed_property_register);
                     } else if (expression.property().is_identifier()) {
                         auto identifier_table_ref = generator.intern_identifier(verify_cast<Identifier>(expression.property()).string());
-                        generator.emit<Bytecode::Op::PutById>(*base_object_register, identifier_table_ref);
+                        generator.emit<Bytecode::Op::PutById>(*base_object_register, identifier_table_ref, generator.next_property_lookup_cache());
                     } else if (expression.property().is_private_identifier()) {
                         auto identifier_table_ref = generator.intern_identifier(verify_cast<PrivateIdentifier>(expression.property()).string());
                         generator.emit<Bytecode::Op::PutPrivateById>(*base_object_register, identifier_table_ref);
@@ -656,10 +656,7 @@ Bytecode::CodeGenerationErrorOr<void> WhileStatement::generate_labelled_evaluati
 
     generator.switch_to_basic_block(test_block);
     generator.emit<Bytecode::Op::Store>(result_reg);
-    TRY(m_test->generate_bytecode(generator));
-    generator.emit<Bytecode::Op::JumpConditional>().set_targets(
-        Bytecode::Label { body_block },
-        Bytecode::Label { load_result_and_jump_to_end_block });
+    TRY(generator.emit_jump_if(*m_test, Bytecode::Label { body_block }, Bytecode::Label { load_result_and_jump_to_end_block }));
 
     generator.switch_to_basic_block(body_block);
     generator.begin_continuable_scope(Bytecode::Label { test_block }, label_set);
@@ -712,10 +709,7 @@ Bytecode::CodeGenerationErrorOr<void> DoWhileStatement::generate_labelled_evalua
 
     generator.switch_to_basic_block(test_block);
     generator.emit<Bytecode::Op::Store>(result_reg);
-    TRY(m_test->generate_bytecode(generator));
-    generator.emit<Bytecode::Op::JumpConditional>().set_targets(
-        Bytecode::Label { body_block },
-        Bytecode::Label { load_result_and_jump_to_end_block });
+    TRY(generator.emit_jump_if(*m_test, Bytecode::Label { body_block }, Bytecode::Label { load_result_and_jump_to_end_block }));
 
     generator.switch_to_basic_block(body_block);
     generator.begin_continuable_scope(Bytecode::Label { test_block }, label_set);
@@ -818,10 +812,7 @@ Bytecode::CodeGenerationErrorOr<void> ForStatement::generate_labelled_evaluation
         if (!m_update)
             generator.emit<Bytecode::Op::Store>(result_reg);
 
-        TRY(m_test->generate_bytecode(generator));
-        generator.emit<Bytecode::Op::JumpConditional>().set_targets(
-            Bytecode::Label { *body_block_ptr },
-            Bytecode::Label { *load_result_and_jump_to_end_block_ptr });
+        TRY(generator.emit_jump_if(*m_test, Bytecode::Label { *body_block_ptr }, Bytecode::Label { *load_result_and_jump_to_end_block_ptr }));
     }
 
     if (m_update) {
@@ -911,7 +902,7 @@ Bytecode::CodeGenerationErrorOr<void> ObjectExpression::generate_bytecode(Byteco
                 TRY(generator.emit_named_evaluation_if_anonymous_function(property->value(), name));
             }
 
-            generator.emit<Bytecode::Op::PutById>(object_reg, key_name, property_kind);
+            generator.emit<Bytecode::Op::PutById>(object_reg, key_name, generator.next_property_lookup_cache(), property_kind);
         } else {
             TRY(property->key().generate_bytecode(generator));
             auto property_reg = generator.allocate_register();
@@ -1061,7 +1052,7 @@ static Bytecode::CodeGenerationErrorOr<void> generate_object_binding_pattern_byt
             }
 
             generator.emit<Bytecode::Op::Load>(value_reg);
-            generator.emit<Bytecode::Op::GetById>(generator.intern_identifier(identifier));
+            generator.emit<Bytecode::Op::GetById>(generator.intern_identifier(identifier), generator.next_property_lookup_cache());
         } else {
             auto expression = name.get<NonnullRefPtr<Expression const>>();
             TRY(expression->generate_bytecode(generator));
@@ -1409,7 +1400,7 @@ static Bytecode::CodeGenerationErrorOr<void> get_base_and_value_from_member_expr
         } else {
             // 3. Let propertyKey be StringValue of IdentifierName.
             auto identifier_table_ref = generator.intern_identifier(verify_cast<Identifier>(member_expression.property()).string());
-            generator.emit<Bytecode::Op::GetById>(identifier_table_ref);
+            generator.emit<Bytecode::Op::GetById>(identifier_table_ref, generator.next_property_lookup_cache());
         }
     } else {
         TRY(member_expression.object().generate_bytecode(generator));
@@ -1420,7 +1411,7 @@ static Bytecode::CodeGenerationErrorOr<void> get_base_and_value_from_member_expr
         } else if (is<PrivateIdentifier>(member_expression.property())) {
             generator.emit<Bytecode::Op::GetPrivateById>(generator.intern_identifier(verify_cast<PrivateIdentifier>(member_expression.property()).string()));
         } else {
-            generator.emit<Bytecode::Op::GetById>(generator.intern_identifier(verify_cast<Identifier>(member_expression.property()).string()));
+            generator.emit<Bytecode::Op::GetById>(generator.intern_identifier(verify_cast<Identifier>(member_expression.property()).string()), generator.next_property_lookup_cache());
         }
     }
 
@@ -1505,11 +1496,11 @@ Bytecode::CodeGenerationErrorOr<void> YieldExpression::generate_bytecode(Bytecod
         // The accumulator is set to an object, for example: { "type": 1 (normal), value: 1337 }
         generator.emit<Bytecode::Op::Store>(received_completion_register);
 
-        generator.emit<Bytecode::Op::GetById>(type_identifier);
+        generator.emit<Bytecode::Op::GetById>(type_identifier, generator.next_property_lookup_cache());
         generator.emit<Bytecode::Op::Store>(received_completion_type_register);
 
         generator.emit<Bytecode::Op::Load>(received_completion_register);
-        generator.emit<Bytecode::Op::GetById>(value_identifier);
+        generator.emit<Bytecode::Op::GetById>(value_identifier, generator.next_property_lookup_cache());
         generator.emit<Bytecode::Op::Store>(received_completion_value_register);
     };
 
@@ -1531,14 +1522,14 @@ Bytecode::CodeGenerationErrorOr<void> YieldExpression::generate_bytecode(Bytecod
         // 5. Let iterator be iteratorRecord.[[Iterator]].
         auto iterator_register = generator.allocate_register();
         auto iterator_identifier = generator.intern_identifier("iterator");
-        generator.emit<Bytecode::Op::GetById>(iterator_identifier);
+        generator.emit<Bytecode::Op::GetById>(iterator_identifier, generator.next_property_lookup_cache());
         generator.emit<Bytecode::Op::Store>(iterator_register);
 
         // Cache iteratorRecord.[[NextMethod]] for use in step 7.a.i.
         auto next_method_register = generator.allocate_register();
         auto next_method_identifier = generator.intern_identifier("next");
         generator.emit<Bytecode::Op::Load>(iterator_record_register);
-        generator.emit<Bytecode::Op::GetById>(next_method_identifier);
+        generator.emit<Bytecode::Op::GetById>(next_method_identifier, generator.next_property_lookup_cache());
         generator.emit<Bytecode::Op::Store>(next_method_register);
 
         // 6. Let received be NormalCompletion(undefined).
@@ -1840,10 +1831,7 @@ Bytecode::CodeGenerationErrorOr<void> IfStatement::generate_bytecode(Bytecode::G
     auto& true_block = generator.make_block();
     auto& false_block = generator.make_block();
 
-    TRY(m_predicate->generate_bytecode(generator));
-    generator.emit<Bytecode::Op::JumpConditional>().set_targets(
-        Bytecode::Label { true_block },
-        Bytecode::Label { false_block });
+    TRY(generator.emit_jump_if(*m_predicate, Bytecode::Label { true_block }, Bytecode::Label { false_block }));
 
     Bytecode::Op::Jump* true_block_jump { nullptr };
 
@@ -1902,10 +1890,7 @@ Bytecode::CodeGenerationErrorOr<void> ConditionalExpression::generate_bytecode(B
     auto& false_block = generator.make_block();
     auto& end_block = generator.make_block();
 
-    TRY(m_test->generate_bytecode(generator));
-    generator.emit<Bytecode::Op::JumpConditional>().set_targets(
-        Bytecode::Label { true_block },
-        Bytecode::Label { false_block });
+    TRY(generator.emit_jump_if(*m_test, Bytecode::Label { true_block }, Bytecode::Label { false_block }));
 
     generator.switch_to_basic_block(true_block);
     TRY(m_consequent->generate_bytecode(generator));
@@ -2025,7 +2010,7 @@ Bytecode::CodeGenerationErrorOr<void> TaggedTemplateLiteral::generate_bytecode(B
     auto raw_strings_reg = generator.allocate_register();
     generator.emit<Bytecode::Op::Store>(raw_strings_reg);
 
-    generator.emit<Bytecode::Op::PutById>(strings_reg, generator.intern_identifier("raw"));
+    generator.emit<Bytecode::Op::PutById>(strings_reg, generator.intern_identifier("raw"), generator.next_property_lookup_cache());
 
     generator.emit<Bytecode::Op::LoadImmediate>(js_undefined());
     auto this_reg = generator.allocate_register();
@@ -2317,11 +2302,11 @@ static void generate_await(Bytecode::Generator& generator)
     // The accumulator is set to an object, for example: { "type": 1 (normal), value: 1337 }
     generator.emit<Bytecode::Op::Store>(received_completion_register);
 
-    generator.emit<Bytecode::Op::GetById>(type_identifier);
+    generator.emit<Bytecode::Op::GetById>(type_identifier, generator.next_property_lookup_cache());
     generator.emit<Bytecode::Op::Store>(received_completion_type_register);
 
     generator.emit<Bytecode::Op::Load>(received_completion_register);
-    generator.emit<Bytecode::Op::GetById>(value_identifier);
+    generator.emit<Bytecode::Op::GetById>(value_identifier, generator.next_property_lookup_cache());
     generator.emit<Bytecode::Op::Store>(received_completion_value_register);
 
     auto& normal_completion_continuation_block = generator.make_block();
@@ -2806,7 +2791,7 @@ static Bytecode::CodeGenerationErrorOr<void> generate_optional_chain(Bytecode::G
             },
             [&](OptionalChain::MemberReference const& ref) -> Bytecode::CodeGenerationErrorOr<void> {
                 generator.emit<Bytecode::Op::Store>(current_base_register);
-                generator.emit<Bytecode::Op::GetById>(generator.intern_identifier(ref.identifier->string()));
+                generator.emit<Bytecode::Op::GetById>(generator.intern_identifier(ref.identifier->string()), generator.next_property_lookup_cache());
                 generator.emit<Bytecode::Op::Store>(current_value_register);
                 return {};
             },
@@ -64,4 +64,33 @@ void BasicBlock::grow(size_t additional_size)
     VERIFY(m_buffer_size <= m_buffer_capacity);
 }
 
+void BasicBlock::remove_instructions_if(Function<bool(Instruction const&)> const& predicate)
+{
+    size_t new_size = 0;
+    Instruction const* new_terminator = nullptr;
+
+    Bytecode::InstructionStreamIterator it(instruction_stream());
+    while (!it.at_end()) {
+        auto& instruction = const_cast<Instruction&>(*it);
+        auto offset = it.offset();
+        auto length = instruction.length();
+        ++it;
+
+        if (predicate(instruction)) {
+            Instruction::destroy(instruction);
+            continue;
+        }
+
+        // NOTE: Instructions may be moved around in memory, as long as the old copy isn't destroyed.
+        if (new_size != offset)
+            memmove(m_buffer + new_size, m_buffer + offset, length);
+        if (&instruction == m_terminator)
+            new_terminator = reinterpret_cast<Instruction const*>(m_buffer + new_size);
+        new_size += length;
+    }
+
+    m_terminator = new_terminator;
+    m_buffer_size = new_size;
+}
+
 }
@@ -8,6 +8,7 @@
 
 #include <AK/Badge.h>
 #include <AK/DeprecatedString.h>
+#include <AK/Function.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Handle.h>
 
@@ -39,6 +40,9 @@ public:
     bool can_grow(size_t additional_size) const { return m_buffer_size + additional_size <= m_buffer_capacity; }
     void grow(size_t additional_size);
 
+    // Destroys the instructions for which the predicate returns true, and moves the remaining ones together.
+    void remove_instructions_if(Function<bool(Instruction const&)> const&);
+
     void terminate(Badge<Generator>, Instruction const* terminator) { m_terminator = terminator; }
     bool is_terminated() const { return m_terminator != nullptr; }
     Instruction const* terminator() const { return m_terminator; }
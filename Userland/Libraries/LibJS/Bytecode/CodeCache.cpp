@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringHash.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/CodeCache.h>
+#include <LibJS/Bytecode/Interpreter.h>
+
+namespace JS::Bytecode {
+
+// Enough for a handful of large bundles, while keeping the memory used by their parse trees in check.
+static constexpr size_t maximum_total_source_length = 32 * MiB;
+static constexpr size_t maximum_entry_count = 64;
+
+static u32 hash_source_text(StringView source_text)
+{
+    return string_hash(source_text.characters_without_null_termination(), source_text.length());
+}
+
+CodeCache::Entry::Entry(NonnullRefPtr<Program> program, size_t line_number_offset)
+    : program(move(program))
+    , line_number_offset(line_number_offset)
+    , source_hash(hash_source_text(this->program->source_code().code()))
+{
+}
+
+CodeCache::Entry::~Entry() = default;
+
+CodeCache& CodeCache::the()
+{
+    // NOTE: This is intentionally leaked, so that the cached parse trees outlive every VM that might use them.
+    static auto* code_cache = new CodeCache;
+    return *code_cache;
+}
+
+bool CodeCache::is_enabled() const
+{
+    return m_enabled && Interpreter::enabled();
+}
+
+void CodeCache::set_enabled(bool enabled)
+{
+    m_enabled = enabled;
+    if (!enabled)
+        clear();
+}
+
+RefPtr<Program> CodeCache::find_program(StringView source_text, StringView filename, size_t line_number_offset)
+{
+    auto source_hash = hash_source_text(source_text);
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        auto const& entry = *m_entries[i];
+        if (entry.source_hash != source_hash || entry.line_number_offset != line_number_offset)
+            continue;
+
+        // Different source texts can have the same hash, so make sure that this is really the same script.
+        auto const& source_code = entry.program->source_code();
+        if (source_code.code() != source_text || source_code.filename() != filename)
+            continue;
+
+        auto used_entry = m_entries.take(i);
+        m_entries.append(used_entry);
+        return used_entry->program;
+    }
+
+    return nullptr;
+}
+
+void CodeCache::add_program(NonnullRefPtr<Program> program, size_t line_number_offset)
+{
+    m_total_source_length += program->source_code().code().bytes().size();
+    m_entries.append(adopt_ref(*new Entry(move(program), line_number_offset)));
+    evict_if_needed();
+}
+
+RefPtr<CodeCache::Entry> CodeCache::entry_for(Program const& program) const
+{
+    for (auto const& entry : m_entries) {
+        if (entry->program.ptr() == &program)
+            return entry;
+    }
+    return nullptr;
+}
+
+void CodeCache::clear()
+{
+    m_entries.clear();
+    m_total_source_length = 0;
+}
+
+void CodeCache::evict_if_needed()
+{
+    while (!m_entries.is_empty() && (m_entries.size() > maximum_entry_count || m_total_source_length > maximum_total_source_length)) {
+        auto evicted_entry = m_entries.take_first();
+        m_total_source_length -= evicted_entry->program->source_code().code().bytes().size();
+    }
+}
+
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Forward.h>
+
+namespace JS::Bytecode {
+
+// Remembers the parse trees of recently parsed scripts, along with the bytecode generated for their top level,
+// so that parsing and running the same source text again (e.g. when a page is reloaded) skips both the parser
+// and the bytecode generator.
+// The cache only lives in memory, so nothing is reused across processes.
+// Parse trees are only shared while the bytecode interpreter is enabled, as the AST interpreter keeps
+// per-evaluation state (like template objects) in them.
+class CodeCache {
+public:
+    struct Entry : public RefCounted<Entry> {
+        Entry(NonnullRefPtr<Program>, size_t line_number_offset);
+        ~Entry();
+
+        NonnullRefPtr<Program> program;
+        size_t line_number_offset { 0 };
+        u32 source_hash { 0 };
+
+        // Generated when the script is first run.
+        OwnPtr<Executable> executable;
+    };
+
+    static CodeCache& the();
+
+    [[nodiscard]] bool is_enabled() const;
+    void set_enabled(bool);
+
+    RefPtr<Program> find_program(StringView source_text, StringView filename, size_t line_number_offset);
+    void add_program(NonnullRefPtr<Program>, size_t line_number_offset);
+
+    // Returns the entry for a parse tree that came from the cache, or null if it didn't.
+    RefPtr<Entry> entry_for(Program const&) const;
+
+    size_t size() const { return m_entries.size(); }
+    void clear();
+
+private:
+    CodeCache() = default;
+
+    void evict_if_needed();
+
+    bool m_enabled { false };
+    size_t m_total_source_length { 0 };
+
+    // Ordered from least to most recently used.
+    Vector<NonnullRefPtr<Entry>> m_entries;
+};
+
+}
@@ -5,9 +5,12 @@
  */
 
 #include <LibJS/Bytecode/Executable.h>
+#include <LibJS/JIT/Compiler.h>
 
 namespace JS::Bytecode {
 
+Executable::~Executable() = default;
+
 void Executable::dump() const
 {
     dbgln("\033[33;1mJS::Bytecode::Executable\033[0m ({})", name);
@@ -23,4 +26,13 @@ void Executable::dump() const
     }
 }
 
+JIT::NativeExecutable const* Executable::get_or_create_native_executable()
+{
+    if (!did_try_jitting) {
+        did_try_jitting = true;
+        native_executable = JIT::Compiler::compile(*this);
+    }
+    return native_executable.ptr();
+}
+
 }
@@ -6,25 +6,58 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/DeprecatedFlyString.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/WeakPtr.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/IdentifierTable.h>
 #include <LibJS/Bytecode/StringTable.h>
+#include <LibJS/Runtime/Shape.h>
 
 namespace JS::Bytecode {
 
+// The inline cache of a single GetById or PutById instruction. It remembers where the property
+// was found for the last few shapes of the objects that the instruction was executed on, so that
+// the property does not have to be looked up again as long as the object's shape is the same.
+struct PropertyLookupCache {
+    static constexpr size_t maximum_shape_count = 4;
+
+    struct Entry {
+        WeakPtr<Shape> shape;
+        u32 unique_shape_serial_number { 0 };
+        u32 property_offset { 0 };
+
+        // Set if the property is a property of the prototype of objects with `shape`.
+        WeakPtr<Shape> prototype_shape;
+        u32 prototype_unique_shape_serial_number { 0 };
+    };
+
+    AK::Array<Entry, maximum_shape_count> entries;
+    size_t next_entry_to_replace { 0 };
+};
+
 struct Executable {
+    ~Executable();
+
     DeprecatedFlyString name;
     Vector<NonnullOwnPtr<BasicBlock>> basic_blocks;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
+    Vector<PropertyLookupCache> property_lookup_caches;
     size_t number_of_registers { 0 };
     bool is_strict_mode { false };
+    OwnPtr<JIT::NativeExecutable> native_executable;
+    bool did_try_jitting { false };
 
     DeprecatedString const& get_string(StringTableIndex index) const { return string_table->get(index); }
     DeprecatedFlyString const& get_identifier(IdentifierTableIndex index) const { return identifier_table->get(index); }
 
+    // Compiles the executable to machine code the first time it is called. Returns null if the JIT
+    // does not support this platform, or if compilation failed.
+    JIT::NativeExecutable const* get_or_create_native_executable();
+
     void dump() const;
 };
 
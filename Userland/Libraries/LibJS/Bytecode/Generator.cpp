@@ -54,13 +54,19 @@ CodeGenerationErrorOr<NonnullOwnPtr<Executable>> Generator::generate(ASTNode con
     else if (is<FunctionExpression>(node))
         is_strict_mode = static_cast<FunctionExpression const&>(node).is_strict_mode();
 
+    Vector<PropertyLookupCache> property_lookup_caches;
+    property_lookup_caches.resize(generator.m_next_property_lookup_cache);
+
     return adopt_own(*new Executable {
         .name = {},
         .basic_blocks = move(generator.m_root_basic_blocks),
         .string_table = move(generator.m_string_table),
         .identifier_table = move(generator.m_identifier_table),
+        .property_lookup_caches = move(property_lookup_caches),
         .number_of_registers = generator.m_next_register,
         .is_strict_mode = is_strict_mode,
+        .native_executable = nullptr,
+        .did_try_jitting = false,
     });
 }
 
@@ -184,7 +190,7 @@ CodeGenerationErrorOr<void> Generator::emit_load_from_reference(JS::ASTNode cons
             } else {
                 // 3. Let propertyKey be StringValue of IdentifierName.
                 auto identifier_table_ref = intern_identifier(verify_cast<Identifier>(expression.property()).string());
-                emit<Bytecode::Op::GetById>(identifier_table_ref);
+                emit<Bytecode::Op::GetById>(identifier_table_ref, next_property_lookup_cache());
             }
         } else {
             TRY(expression.object().generate_bytecode(*this));
@@ -197,7 +203,7 @@ CodeGenerationErrorOr<void> Generator::emit_load_from_reference(JS::ASTNode cons
                 emit<Bytecode::Op::GetByValue>(object_reg);
             } else if (expression.property().is_identifier()) {
                 auto identifier_table_ref = intern_identifier(verify_cast<Identifier>(expression.property()).string());
-                emit<Bytecode::Op::GetById>(identifier_table_ref);
+                emit<Bytecode::Op::GetById>(identifier_table_ref, next_property_lookup_cache());
             } else if (expression.property().is_private_identifier()) {
                 auto identifier_table_ref = intern_identifier(verify_cast<PrivateIdentifier>(expression.property()).string());
                 emit<Bytecode::Op::GetPrivateById>(identifier_table_ref);
@@ -240,7 +246,7 @@ CodeGenerationErrorOr<void> Generator::emit_store_to_reference(JS::ASTNode const
         } else if (expression.property().is_identifier()) {
             emit<Bytecode::Op::Load>(value_reg);
             auto identifier_table_ref = intern_identifier(verify_cast<Identifier>(expression.property()).string());
-            emit<Bytecode::Op::PutById>(object_reg, identifier_table_ref);
+            emit<Bytecode::Op::PutById>(object_reg, identifier_table_ref, next_property_lookup_cache());
         } else if (expression.property().is_private_identifier()) {
             emit<Bytecode::Op::Load>(value_reg);
             auto identifier_table_ref = intern_identifier(verify_cast<PrivateIdentifier>(expression.property()).string());
@@ -482,4 +488,42 @@ CodeGenerationErrorOr<void> Generator::emit_named_evaluation_if_anonymous_functi
     return {};
 }
 
+template<typename OpType>
+static CodeGenerationErrorOr<void> emit_compare_and_jump(Generator& generator, BinaryExpression const& comparison, Label true_target, Label false_target)
+{
+    TRY(comparison.lhs().generate_bytecode(generator));
+    auto lhs_reg = generator.allocate_register();
+    generator.emit<Op::Store>(lhs_reg);
+    TRY(comparison.rhs().generate_bytecode(generator));
+    generator.emit<OpType>(lhs_reg, true_target, false_target);
+    return {};
+}
+
+CodeGenerationErrorOr<void> Generator::emit_jump_if(Expression const& condition, Label true_target, Label false_target)
+{
+    if (is<BinaryExpression>(condition)) {
+        auto const& comparison = static_cast<BinaryExpression const&>(condition);
+        switch (comparison.op()) {
+        case BinaryOp::GreaterThan:
+            return emit_compare_and_jump<Op::JumpGreaterThan>(*this, comparison, true_target, false_target);
+        case BinaryOp::GreaterThanEquals:
+            return emit_compare_and_jump<Op::JumpGreaterThanEquals>(*this, comparison, true_target, false_target);
+        case BinaryOp::LessThan:
+            return emit_compare_and_jump<Op::JumpLessThan>(*this, comparison, true_target, false_target);
+        case BinaryOp::LessThanEquals:
+            return emit_compare_and_jump<Op::JumpLessThanEquals>(*this, comparison, true_target, false_target);
+        case BinaryOp::StrictlyEquals:
+            return emit_compare_and_jump<Op::JumpStrictlyEquals>(*this, comparison, true_target, false_target);
+        case BinaryOp::StrictlyInequals:
+            return emit_compare_and_jump<Op::JumpStrictlyInequals>(*this, comparison, true_target, false_target);
+        default:
+            break;
+        }
+    }
+
+    TRY(condition.generate_bytecode(*this));
+    emit<Op::JumpConditional>(true_target, false_target);
+    return {};
+}
+
 }
@@ -89,6 +89,10 @@ public:
 
     CodeGenerationErrorOr<void> emit_named_evaluation_if_anonymous_function(Expression const&, Optional<DeprecatedFlyString const&> lhs_name);
 
+    // Evaluates the condition and jumps to one of the targets depending on whether the result is truthy.
+    // Comparisons are fused with the jump into a single instruction.
+    CodeGenerationErrorOr<void> emit_jump_if(Expression const& condition, Label true_target, Label false_target);
+
     void begin_continuable_scope(Label continue_target, Vector<DeprecatedFlyString> const& language_label_set);
     void end_continuable_scope();
     void begin_breakable_scope(Label breakable_target, Vector<DeprecatedFlyString> const& language_label_set);
@@ -127,6 +131,8 @@ public:
         return m_identifier_table->insert(move(string));
     }
 
+    u32 next_property_lookup_cache() { return m_next_property_lookup_cache++; }
+
     bool is_in_generator_or_async_function() const { return m_enclosing_function_kind == FunctionKind::Async || m_enclosing_function_kind == FunctionKind::Generator; }
     bool is_in_generator_function() const { return m_enclosing_function_kind == FunctionKind::Generator; }
     bool is_in_async_function() const { return m_enclosing_function_kind == FunctionKind::Async; }
@@ -209,6 +215,7 @@ private:
 
     u32 m_next_register { 2 };
     u32 m_next_block { 1 };
+    u32 m_next_property_lookup_cache { 0 };
     FunctionKind m_enclosing_function_kind { FunctionKind::Normal };
     Vector<LabelableScope> m_continuable_scopes;
     Vector<LabelableScope> m_breakable_scopes;
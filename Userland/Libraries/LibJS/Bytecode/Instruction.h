@@ -53,7 +53,13 @@
     O(IteratorToArray)               \
     O(Jump)                          \
     O(JumpConditional)               \
+    O(JumpGreaterThan)               \
+    O(JumpGreaterThanEquals)         \
+    O(JumpLessThan)                  \
+    O(JumpLessThanEquals)            \
     O(JumpNullish)                   \
+    O(JumpStrictlyEquals)            \
+    O(JumpStrictlyInequals)          \
     O(JumpUndefined)                 \
     O(LeaveLexicalEnvironment)       \
     O(LeaveUnwindContext)            \
@@ -123,6 +129,17 @@ public:
     void replace_references(Register, Register);
     static void destroy(Instruction&);
 
+    enum class RegisterAccess {
+        Read,
+        Write,
+        ReadWrite,
+    };
+
+    // Calls `callback(Register&, RegisterAccess)` for each register operand of this instruction.
+    // NOTE: NewArray only reports the first and the last register of its element range.
+    template<typename Callback>
+    void visit_registers(Callback);
+
 protected:
     explicit Instruction(Type type)
         : m_type(type)
@@ -8,12 +8,15 @@
 #include <AK/TemporaryChange.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/BasicBlock.h>
+#include <LibJS/Bytecode/CodeCache.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/PassManager.h>
+#include <LibJS/Bytecode/Profiler.h>
 #include <LibJS/Interpreter.h>
+#include <LibJS/JIT/NativeExecutable.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Realm.h>
@@ -39,6 +42,13 @@ void Interpreter::set_optimizations_enabled(bool enabled)
     s_optimizations_enabled = enabled;
 }
 
+static bool s_jit_enabled = false;
+
+void Interpreter::set_jit_enabled(bool enabled)
+{
+    s_jit_enabled = enabled;
+}
+
 bool g_dump_bytecode = false;
 
 Interpreter::Interpreter(VM& vm)
@@ -99,26 +109,46 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, JS::GCPtr<Envir
 
     // 13. If result.[[Type]] is normal, then
     if (result.type() == Completion::Type::Normal) {
-        auto executable_result = JS::Bytecode::Generator::generate(script);
+        // OPTIMIZATION: If the script was parsed from the code cache, it may already have been compiled as well.
+        //               Cached executables remember where identifiers were found in the environment chain,
+        //               so a script that runs with a different chain gets a fresh executable.
+        RefPtr<CodeCache::Entry> cache_entry;
+        if (!lexical_environment_override)
+            cache_entry = CodeCache::the().entry_for(script);
+
+        OwnPtr<Executable> uncached_executable;
+        Executable* executable = cache_entry ? cache_entry->executable.ptr() : nullptr;
+
+        if (!executable) {
+            auto executable_result = JS::Bytecode::Generator::generate(script);
+
+            if (executable_result.is_error()) {
+                if (auto error_string = executable_result.error().to_string(); error_string.is_error())
+                    result = vm.template throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory));
+                else if (error_string = String::formatted("TODO({})", error_string.value()); error_string.is_error())
+                    result = vm.template throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory));
+                else
+                    result = JS::throw_completion(JS::InternalError::create(realm(), error_string.release_value()));
+            } else {
+                auto new_executable = executable_result.release_value();
+
+                if (s_optimizations_enabled) {
+                    auto& passes = optimization_pipeline();
+                    passes.perform(*new_executable);
+                }
 
-        if (executable_result.is_error()) {
-            if (auto error_string = executable_result.error().to_string(); error_string.is_error())
-                result = vm.template throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory));
-            else if (error_string = String::formatted("TODO({})", error_string.value()); error_string.is_error())
-                result = vm.template throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory));
-            else
-                result = JS::throw_completion(JS::InternalError::create(realm(), error_string.release_value()));
-        } else {
-            auto executable = executable_result.release_value();
+                if (g_dump_bytecode)
+                    new_executable->dump();
 
-            if (s_optimizations_enabled) {
-                auto& passes = optimization_pipeline();
-                passes.perform(*executable);
+                executable = new_executable.ptr();
+                if (cache_entry)
+                    cache_entry->executable = move(new_executable);
+                else
+                    uncached_executable = move(new_executable);
             }
+        }
 
-            if (g_dump_bytecode)
-                executable->dump();
-
+        if (executable) {
             // a. Set result to the result of evaluating script.
             auto result_or_error = run_and_return_frame(script_record.realm(), *executable, nullptr);
             if (result_or_error.value.is_error())
@@ -180,7 +210,7 @@ ThrowCompletionOr<Value> Interpreter::run(SourceTextModule& module)
     return js_undefined();
 }
 
-Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Realm& realm, Executable const& executable, BasicBlock const* entry_point, RegisterWindow* in_frame)
+Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Realm& realm, Executable& executable, BasicBlock const* entry_point, RegisterWindow* in_frame)
 {
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter will run unit {:p}", &executable);
 
@@ -212,6 +242,12 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Realm& realm, Execu
 
     registers().resize(executable.number_of_registers);
 
+    auto* profiler = Profiler::the().is_enabled() ? &Profiler::the() : nullptr;
+    if (profiler && !in_frame)
+        profiler->did_enter_executable(executable);
+
+    auto const* native_executable = s_jit_enabled && !profiler ? executable.get_or_create_native_executable() : nullptr;
+
     for (;;) {
         Bytecode::InstructionStreamIterator pc(m_current_block->instruction_stream());
         TemporaryChange temp_change { m_pc, &pc };
@@ -220,9 +256,29 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Realm& realm, Execu
         bool will_jump = false;
         bool will_return = false;
         bool will_yield = false;
-        while (!pc.at_end()) {
-            auto& instruction = *pc;
-            auto ran_or_error = instruction.execute(*this);
+        bool reached_end_of_block = false;
+        for (;;) {
+            Instruction const* instruction_pointer = nullptr;
+            ThrowCompletionOr<void> ran_or_error {};
+            if (native_executable) {
+                // Native code runs until an instruction needs us to unwind, jump, or return, possibly in another block.
+                auto result = native_executable->run(*this, *m_current_block, registers().data());
+                m_current_block = result.exit.block;
+                instruction_pointer = result.exit.instruction;
+                ran_or_error = move(result.completion);
+                if (!instruction_pointer) {
+                    reached_end_of_block = true;
+                    break;
+                }
+            } else {
+                if (pc.at_end()) {
+                    reached_end_of_block = true;
+                    break;
+                }
+                instruction_pointer = &*pc;
+                ran_or_error = profiler ? profiler->execute(*instruction_pointer, *this) : instruction_pointer->execute(*this);
+            }
+            auto& instruction = *instruction_pointer;
             if (ran_or_error.is_error()) {
                 auto exception_value = *ran_or_error.throw_completion().value();
                 m_saved_exception = make_handle(exception_value);
@@ -266,6 +322,7 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Realm& realm, Execu
                 will_yield = instruction.type() == Instruction::Type::Yield && static_cast<Op::Yield const&>(instruction).continuation().has_value();
                 break;
             }
+            VERIFY(!native_executable);
             ++pc;
         }
 
@@ -283,7 +340,7 @@ Interpreter::ValueAndFrame Interpreter::run_and_return_frame(Realm& realm, Execu
             }
         }
 
-        if (pc.at_end())
+        if (reached_end_of_block)
             break;
 
         if (!m_saved_exception.is_null())
@@ -409,6 +466,10 @@ Bytecode::PassManager& Interpreter::optimization_pipeline()
         pm->add<Passes::GenerateCFG>();
         pm->add<Passes::PlaceBlocks>();
         pm->add<Passes::EliminateLoads>();
+        pm->add<Passes::EliminateDeadStores>();
+        pm->add<Passes::AllocateRegisters>();
+        // Sharing registers turns some copies between them into no-ops.
+        pm->add<Passes::EliminateDeadStores>();
         return pm;
     }();
     return *s_optimization_pipeline;
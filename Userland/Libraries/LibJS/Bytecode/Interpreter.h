@@ -32,6 +32,7 @@ public:
     [[nodiscard]] static bool enabled();
     static void set_enabled(bool);
     static void set_optimizations_enabled(bool);
+    static void set_jit_enabled(bool);
 
     explicit Interpreter(VM&);
     ~Interpreter();
@@ -42,7 +43,7 @@ public:
     ThrowCompletionOr<Value> run(Script&, JS::GCPtr<Environment> lexical_environment_override = nullptr);
     ThrowCompletionOr<Value> run(SourceTextModule&);
 
-    ThrowCompletionOr<Value> run(Realm& realm, Bytecode::Executable const& executable, Bytecode::BasicBlock const* entry_point = nullptr)
+    ThrowCompletionOr<Value> run(Realm& realm, Bytecode::Executable& executable, Bytecode::BasicBlock const* entry_point = nullptr)
     {
         auto value_and_frame = run_and_return_frame(realm, executable, entry_point);
         return move(value_and_frame.value);
@@ -52,7 +53,7 @@ public:
         ThrowCompletionOr<Value> value;
         OwnPtr<RegisterWindow> frame;
     };
-    ValueAndFrame run_and_return_frame(Realm&, Bytecode::Executable const&, Bytecode::BasicBlock const* entry_point, RegisterWindow* = nullptr);
+    ValueAndFrame run_and_return_frame(Realm&, Bytecode::Executable&, Bytecode::BasicBlock const* entry_point, RegisterWindow* = nullptr);
 
     ALWAYS_INLINE Value& accumulator() { return reg(Register::accumulator()); }
     Value& reg(Register const& r) { return registers()[r.index()]; }
@@ -77,11 +78,14 @@ public:
         m_saved_exception = {};
     }
 
+    // Whether the instruction that just ran wants execution to continue somewhere else.
+    bool has_pending_jump_or_return() const { return m_pending_jump.has_value() || !m_return_value.is_empty(); }
+
     void enter_unwind_context(Optional<Label> handler_target, Optional<Label> finalizer_target);
     void leave_unwind_context();
     ThrowCompletionOr<void> continue_pending_unwind(Label const& resume_label);
 
-    Executable const& current_executable() { return *m_current_executable; }
+    Executable& current_executable() { return *m_current_executable; }
     BasicBlock const& current_block() const { return *m_current_block; }
     size_t pc() const;
     DeprecatedString debug_position() const;
@@ -109,7 +113,7 @@ private:
     BasicBlock const* m_scheduled_jump { nullptr };
     Value m_return_value;
     Handle<Value> m_saved_return_value;
-    Executable const* m_current_executable { nullptr };
+    Executable* m_current_executable { nullptr };
     Handle<Value> m_saved_exception;
     OwnPtr<JS::Interpreter> m_ast_interpreter;
     BasicBlock const* m_current_block { nullptr };
@@ -48,7 +48,94 @@ DeprecatedString Instruction::to_deprecated_string(Bytecode::Executable const& e
 
 namespace JS::Bytecode::Op {
 
-static ThrowCompletionOr<void> put_by_property_key(VM& vm, Object* object, Value value, PropertyKey name, PropertyKind kind)
+static bool is_cached_shape(WeakPtr<Shape> const& cached_shape, u32 cached_unique_shape_serial_number, Shape const& shape)
+{
+    if (cached_shape.ptr() != &shape)
+        return false;
+    return !shape.is_unique() || shape.unique_shape_serial_number() == cached_unique_shape_serial_number;
+}
+
+// Looks up the value of a property of `object` in the cache. Returns an empty optional if
+// none of the cached shapes match, or if the cached property is now an accessor.
+static Optional<Value> get_from_property_lookup_cache(PropertyLookupCache const& cache, Object const& object)
+{
+    if (object.may_interfere_with_property_lookup_caches())
+        return {};
+
+    for (auto const& entry : cache.entries) {
+        if (!is_cached_shape(entry.shape, entry.unique_shape_serial_number, object.shape()))
+            continue;
+
+        Value value;
+        if (!entry.prototype_shape) {
+            value = object.get_direct(entry.property_offset);
+        } else {
+            auto const* prototype = object.shape().prototype();
+            if (!prototype || !is_cached_shape(entry.prototype_shape, entry.prototype_unique_shape_serial_number, prototype->shape()))
+                return {};
+            value = prototype->get_direct(entry.property_offset);
+        }
+
+        if (value.is_accessor())
+            return {};
+        return value;
+    }
+
+    return {};
+}
+
+// Overwrites the value of a property of `object` if the cache knows where it is stored.
+static bool put_into_property_lookup_cache(PropertyLookupCache const& cache, Object& object, Value value)
+{
+    if (object.may_interfere_with_property_lookup_caches())
+        return false;
+
+    for (auto const& entry : cache.entries) {
+        if (entry.prototype_shape || !is_cached_shape(entry.shape, entry.unique_shape_serial_number, object.shape()))
+            continue;
+
+        if (object.get_direct(entry.property_offset).is_accessor())
+            return false;
+        object.put_direct(entry.property_offset, value);
+        return true;
+    }
+
+    return false;
+}
+
+static void update_property_lookup_cache(PropertyLookupCache& cache, Object const& object, CacheablePropertyMetadata const& metadata)
+{
+    if (metadata.type == CacheablePropertyMetadata::Type::NotCacheable || object.may_interfere_with_property_lookup_caches())
+        return;
+
+    PropertyLookupCache::Entry entry;
+    entry.shape = object.shape().make_weak_ptr<Shape>();
+    entry.unique_shape_serial_number = object.shape().unique_shape_serial_number();
+    entry.property_offset = *metadata.property_offset;
+
+    if (metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
+        // The prototype has to be the one which is reachable from the object's shape, as only
+        // that one is checked when the cache is used.
+        if (metadata.prototype != object.shape().prototype())
+            return;
+        entry.prototype_shape = const_cast<Shape&>(metadata.prototype->shape()).make_weak_ptr<Shape>();
+        entry.prototype_unique_shape_serial_number = metadata.prototype->shape().unique_shape_serial_number();
+    }
+
+    // Prefer replacing an entry whose shape is gone or is the shape of the new entry, and
+    // otherwise replace the entries in turn.
+    for (auto& existing_entry : cache.entries) {
+        if (!existing_entry.shape || existing_entry.shape.ptr() == &object.shape()) {
+            existing_entry = move(entry);
+            return;
+        }
+    }
+
+    cache.entries[cache.next_entry_to_replace] = move(entry);
+    cache.next_entry_to_replace = (cache.next_entry_to_replace + 1) % PropertyLookupCache::maximum_shape_count;
+}
+
+static ThrowCompletionOr<void> put_by_property_key(VM& vm, Object* object, Value value, PropertyKey name, PropertyKind kind, PropertyLookupCache* cache = nullptr)
 {
     if (kind == PropertyKind::Getter || kind == PropertyKind::Setter) {
         // The generator should only pass us functions for getters and setters.
@@ -70,9 +157,16 @@ static ThrowCompletionOr<void> put_by_property_key(VM& vm, Object* object, Value
         break;
     }
     case PropertyKind::KeyValue: {
-        bool succeeded = TRY(object->internal_set(name, value, object));
+        // Only writable data properties of the object itself are cached, which can simply be overwritten.
+        if (cache && put_into_property_lookup_cache(*cache, *object, value))
+            break;
+
+        CacheablePropertyMetadata cacheable_metadata;
+        bool succeeded = TRY(object->internal_set(name, value, object, cache ? &cacheable_metadata : nullptr));
         if (!succeeded && vm.in_strict_mode())
             return vm.throw_completion<TypeError>(ErrorType::ReferenceNullishSetProperty, name, TRY_OR_THROW_OOM(vm, value.to_string_without_side_effects()));
+        if (succeeded && cache)
+            update_property_lookup_cache(*cache, *object, cacheable_metadata);
         break;
     }
     case PropertyKind::Spread:
@@ -125,6 +219,80 @@ static ThrowCompletionOr<Value> typed_equals(VM&, Value src1, Value src2)
     return Value(is_strictly_equal(src1, src2));
 }
 
+// OPTIMIZATION: Most arithmetic and comparisons in hot code is done on numbers, for which we don't need any of the
+//               type conversions the generic operations in Value.cpp start with. Int32 results stay int32 unless
+//               they overflow, in which case we fall back to doing the operation on doubles.
+static ALWAYS_INLINE ThrowCompletionOr<Value> add_with_fast_path(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_int32() && rhs.is_int32()) {
+        Checked<i32> result = lhs.as_i32();
+        result += rhs.as_i32();
+        if (!result.has_overflow())
+            return Value(result.value());
+    }
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() + rhs.as_double());
+    return add(vm, lhs, rhs);
+}
+
+static ALWAYS_INLINE ThrowCompletionOr<Value> sub_with_fast_path(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_int32() && rhs.is_int32()) {
+        Checked<i32> result = lhs.as_i32();
+        result -= rhs.as_i32();
+        if (!result.has_overflow())
+            return Value(result.value());
+    }
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() - rhs.as_double());
+    return sub(vm, lhs, rhs);
+}
+
+static ALWAYS_INLINE ThrowCompletionOr<Value> mul_with_fast_path(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_int32() && rhs.is_int32()) {
+        Checked<i32> result = lhs.as_i32();
+        result *= rhs.as_i32();
+        // NOTE: A zero product may have to be -0, which only a double can represent.
+        if (!result.has_overflow() && result.value() != 0)
+            return Value(result.value());
+    }
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() * rhs.as_double());
+    return mul(vm, lhs, rhs);
+}
+
+// NOTE: Comparisons involving NaN are false, both in C++ and in JS.
+#define JS_DEFINE_NUMERIC_COMPARISON_WITH_FAST_PATH(op_snake_case, numeric_operator)                              \
+    static ALWAYS_INLINE ThrowCompletionOr<Value> op_snake_case##_with_fast_path(VM& vm, Value lhs, Value rhs) \
+    {                                                                                                             \
+        if (lhs.is_int32() && rhs.is_int32())                                                                     \
+            return Value(lhs.as_i32() numeric_operator rhs.as_i32());                                             \
+        if (lhs.is_number() && rhs.is_number())                                                                   \
+            return Value(lhs.as_double() numeric_operator rhs.as_double());                                       \
+        return op_snake_case(vm, lhs, rhs);                                                                       \
+    }
+
+JS_DEFINE_NUMERIC_COMPARISON_WITH_FAST_PATH(greater_than, >)
+JS_DEFINE_NUMERIC_COMPARISON_WITH_FAST_PATH(greater_than_equals, >=)
+JS_DEFINE_NUMERIC_COMPARISON_WITH_FAST_PATH(less_than, <)
+JS_DEFINE_NUMERIC_COMPARISON_WITH_FAST_PATH(less_than_equals, <=)
+#undef JS_DEFINE_NUMERIC_COMPARISON_WITH_FAST_PATH
+
+static ALWAYS_INLINE ThrowCompletionOr<Value> typed_equals_with_fast_path(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_int32() && rhs.is_int32())
+        return Value(lhs.as_i32() == rhs.as_i32());
+    return typed_equals(vm, lhs, rhs);
+}
+
+static ALWAYS_INLINE ThrowCompletionOr<Value> typed_inequals_with_fast_path(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_int32() && rhs.is_int32())
+        return Value(lhs.as_i32() != rhs.as_i32());
+    return typed_inequals(vm, lhs, rhs);
+}
+
 #define JS_DEFINE_COMMON_BINARY_OP(OpTitleCase, op_snake_case)                                  \
     ThrowCompletionOr<void> OpTitleCase::execute_impl(Bytecode::Interpreter& interpreter) const \
     {                                                                                           \
@@ -139,7 +307,11 @@ static ThrowCompletionOr<Value> typed_equals(VM&, Value src1, Value src2)
         return DeprecatedString::formatted(#OpTitleCase " {}", m_lhs_reg);                      \
     }
 
-JS_ENUMERATE_COMMON_BINARY_OPS(JS_DEFINE_COMMON_BINARY_OP)
+#define JS_DEFINE_COMMON_BINARY_OP_WITH_FAST_PATH(OpTitleCase, op_snake_case) \
+    JS_DEFINE_COMMON_BINARY_OP(OpTitleCase, op_snake_case##_with_fast_path)
+
+JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(JS_DEFINE_COMMON_BINARY_OP_WITH_FAST_PATH)
+JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(JS_DEFINE_COMMON_BINARY_OP)
 
 static ThrowCompletionOr<Value> not_(VM&, Value value)
 {
@@ -529,7 +701,21 @@ ThrowCompletionOr<void> GetById::execute_impl(Bytecode::Interpreter& interpreter
         base_obj = TRY(base_value.to_object(vm));
     }
 
-    interpreter.accumulator() = TRY(base_obj->internal_get(name, base_value));
+    auto& cache = interpreter.current_executable().property_lookup_caches[m_cache_index];
+    if (auto value = get_from_property_lookup_cache(cache, *base_obj); value.has_value()) {
+        interpreter.accumulator() = *value;
+        return {};
+    }
+
+    CacheablePropertyMetadata cacheable_metadata;
+    interpreter.accumulator() = TRY(base_obj->internal_get(name, base_value, &cacheable_metadata));
+
+    // NOTE: Arrays can have the same shape as ordinary objects, but their "length" is not stored in it. So a "length"
+    //       found in the prototype chain of an ordinary object may be shadowed for an array with the same shape.
+    if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain && name == vm.names.length.as_string())
+        return {};
+
+    update_property_lookup_cache(cache, *base_obj, cacheable_metadata);
     return {};
 }
 
@@ -550,7 +736,8 @@ ThrowCompletionOr<void> PutById::execute_impl(Bytecode::Interpreter& interpreter
     auto value = interpreter.accumulator();
     auto object = TRY(interpreter.reg(m_base).to_object(vm));
     PropertyKey name = interpreter.current_executable().get_identifier(m_property);
-    TRY(put_by_property_key(vm, object, value, name, m_kind));
+    auto& cache = interpreter.current_executable().property_lookup_caches[m_cache_index];
+    TRY(put_by_property_key(vm, object, value, name, m_kind, &cache));
     interpreter.accumulator() = value;
     return {};
 }
@@ -662,6 +849,32 @@ ThrowCompletionOr<void> JumpUndefined::execute_impl(Bytecode::Interpreter& inter
     return {};
 }
 
+#define JS_DEFINE_COMPARE_AND_JUMP_OP(OpTitleCase, ComparisonTitleCase, comparison_snake_case)                           \
+    ThrowCompletionOr<void> OpTitleCase::execute_impl(Bytecode::Interpreter& interpreter) const                          \
+    {                                                                                                                    \
+        VERIFY(m_true_target.has_value());                                                                               \
+        VERIFY(m_false_target.has_value());                                                                              \
+        auto& vm = interpreter.vm();                                                                                     \
+        auto lhs = interpreter.reg(m_lhs_reg);                                                                           \
+        auto rhs = interpreter.accumulator();                                                                            \
+        auto result = TRY(comparison_snake_case##_with_fast_path(vm, lhs, rhs));                                         \
+        interpreter.accumulator() = result;                                                                              \
+        if (result.as_bool())                                                                                            \
+            interpreter.jump(m_true_target.value());                                                                     \
+        else                                                                                                             \
+            interpreter.jump(m_false_target.value());                                                                    \
+        return {};                                                                                                       \
+    }                                                                                                                    \
+    DeprecatedString OpTitleCase::to_deprecated_string_impl(Bytecode::Executable const&) const                           \
+    {                                                                                                                    \
+        auto true_string = m_true_target.has_value() ? DeprecatedString::formatted("{}", *m_true_target) : "<empty>";    \
+        auto false_string = m_false_target.has_value() ? DeprecatedString::formatted("{}", *m_false_target) : "<empty>"; \
+        return DeprecatedString::formatted(#OpTitleCase " {} true:{} false:{}", m_lhs_reg, true_string, false_string);   \
+    }
+
+JS_ENUMERATE_COMPARE_AND_JUMP_OPS(JS_DEFINE_COMPARE_AND_JUMP_OP)
+#undef JS_DEFINE_COMPARE_AND_JUMP_OP
+
 // 13.3.8.1 https://tc39.es/ecma262/#sec-runtime-semantics-argumentlistevaluation
 static MarkedVector<Value> argument_list_evaluation(Bytecode::Interpreter& interpreter)
 {
@@ -816,6 +1029,13 @@ ThrowCompletionOr<void> Return::execute_impl(Bytecode::Interpreter& interpreter)
 ThrowCompletionOr<void> Increment::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
+
+    // OPTIMIZATION: Fast path for int32 values that don't overflow.
+    if (auto value = interpreter.accumulator(); value.is_int32() && value.as_i32() != NumericLimits<i32>::max()) {
+        interpreter.accumulator() = Value(value.as_i32() + 1);
+        return {};
+    }
+
     auto old_value = TRY(interpreter.accumulator().to_numeric(vm));
 
     if (old_value.is_number())
@@ -828,6 +1048,13 @@ ThrowCompletionOr<void> Increment::execute_impl(Bytecode::Interpreter& interpret
 ThrowCompletionOr<void> Decrement::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
+
+    // OPTIMIZATION: Fast path for int32 values that don't overflow.
+    if (auto value = interpreter.accumulator(); value.is_int32() && value.as_i32() != NumericLimits<i32>::min()) {
+        interpreter.accumulator() = Value(value.as_i32() - 1);
+        return {};
+    }
+
     auto old_value = TRY(interpreter.accumulator().to_numeric(vm));
 
     if (old_value.is_number())
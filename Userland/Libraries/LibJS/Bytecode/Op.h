@@ -44,6 +44,13 @@ public:
         if (m_src == from)
             m_src = to;
     }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_src, RegisterAccess::Read);
+    }
+
+    Register src() const { return m_src; }
 
 private:
     Register m_src;
@@ -62,6 +69,8 @@ public:
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register) { }
 
+    Value value() const { return m_value; }
+
 private:
     Value m_value;
 };
@@ -78,6 +87,11 @@ public:
     DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register) { }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_dst, RegisterAccess::Write);
+    }
 
     Register dst() const { return m_dst; }
 
@@ -85,30 +99,37 @@ private:
     Register m_dst;
 };
 
-#define JS_ENUMERATE_COMMON_BINARY_OPS(O)     \
-    O(Add, add)                               \
-    O(Sub, sub)                               \
-    O(Mul, mul)                               \
-    O(Div, div)                               \
-    O(Exp, exp)                               \
-    O(Mod, mod)                               \
-    O(In, in)                                 \
-    O(InstanceOf, instance_of)                \
-    O(GreaterThan, greater_than)              \
-    O(GreaterThanEquals, greater_than_equals) \
-    O(LessThan, less_than)                    \
-    O(LessThanEquals, less_than_equals)       \
-    O(LooselyInequals, abstract_inequals)     \
-    O(LooselyEquals, abstract_equals)         \
-    O(StrictlyInequals, typed_inequals)       \
-    O(StrictlyEquals, typed_equals)           \
-    O(BitwiseAnd, bitwise_and)                \
-    O(BitwiseOr, bitwise_or)                  \
-    O(BitwiseXor, bitwise_xor)                \
-    O(LeftShift, left_shift)                  \
-    O(RightShift, right_shift)                \
+// These have inline fast paths for int32 and double operands, see Op.cpp.
+#define JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(O) \
+    O(Add, add)                                          \
+    O(Sub, sub)                                          \
+    O(Mul, mul)                                          \
+    O(GreaterThan, greater_than)                         \
+    O(GreaterThanEquals, greater_than_equals)            \
+    O(LessThan, less_than)                               \
+    O(LessThanEquals, less_than_equals)                  \
+    O(StrictlyInequals, typed_inequals)                  \
+    O(StrictlyEquals, typed_equals)
+
+#define JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(O) \
+    O(Div, div)                                             \
+    O(Exp, exp)                                             \
+    O(Mod, mod)                                             \
+    O(In, in)                                               \
+    O(InstanceOf, instance_of)                              \
+    O(LooselyInequals, abstract_inequals)                   \
+    O(LooselyEquals, abstract_equals)                       \
+    O(BitwiseAnd, bitwise_and)                              \
+    O(BitwiseOr, bitwise_or)                                \
+    O(BitwiseXor, bitwise_xor)                              \
+    O(LeftShift, left_shift)                                \
+    O(RightShift, right_shift)                              \
     O(UnsignedRightShift, unsigned_right_shift)
 
+#define JS_ENUMERATE_COMMON_BINARY_OPS(O)            \
+    JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(O) \
+    JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(O)
+
 #define JS_DECLARE_COMMON_BINARY_OP(OpTitleCase, op_snake_case)                        \
     class OpTitleCase final : public Instruction {                                     \
     public:                                                                            \
@@ -128,6 +149,13 @@ private:
             if (m_lhs_reg == from)                                                     \
                 m_lhs_reg = to;                                                        \
         }                                                                              \
+        template<typename Callback>                                                    \
+        void visit_registers_impl(Callback callback)                                   \
+        {                                                                              \
+            callback(m_lhs_reg, RegisterAccess::Read);                                 \
+        }                                                                              \
+                                                                                       \
+        Register lhs() const { return m_lhs_reg; }                                     \
                                                                                        \
     private:                                                                           \
         Register m_lhs_reg;                                                            \
@@ -257,6 +285,13 @@ public:
     DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register from, Register to);
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_from_object, RegisterAccess::Read);
+        for (size_t i = 0; i < m_excluded_names_count; ++i)
+            callback(m_excluded_names[i], RegisterAccess::Read);
+    }
 
     size_t length_impl() const { return sizeof(*this) + sizeof(Register) * m_excluded_names_count; }
 
@@ -306,6 +341,14 @@ public:
     // Note: The underlying element range shall never be changed item, by item
     //       shifting it may be done in the future
     void replace_references_impl(Register from, Register) { VERIFY(!m_element_count || from.index() < start().index() || from.index() > end().index()); }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        if (!m_element_count)
+            return;
+        callback(m_elements[0], RegisterAccess::Read);
+        callback(m_elements[1], RegisterAccess::Read);
+    }
 
     size_t length_impl() const
     {
@@ -346,6 +389,11 @@ public:
 
     // Note: This should never do anything, the lhs should always be an array, that is currently being constructed
     void replace_references_impl(Register from, Register) { VERIFY(from != m_lhs); }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_lhs, RegisterAccess::Read);
+    }
 
 private:
     Register m_lhs;
@@ -365,6 +413,12 @@ public:
     DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register);
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_specifier, RegisterAccess::Read);
+        callback(m_options, RegisterAccess::Read);
+    }
 
 private:
     Register m_specifier;
@@ -397,6 +451,11 @@ public:
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     // Note: lhs should always be a string in construction, so this should never do anything
     void replace_references_impl(Register from, Register) { VERIFY(from != m_lhs); }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_lhs, RegisterAccess::ReadWrite);
+    }
 
 private:
     Register m_lhs;
@@ -526,9 +585,10 @@ private:
 
 class GetById final : public Instruction {
 public:
-    explicit GetById(IdentifierTableIndex property)
+    GetById(IdentifierTableIndex property, u32 cache_index)
         : Instruction(Type::GetById)
         , m_property(property)
+        , m_cache_index(cache_index)
     {
     }
 
@@ -539,6 +599,7 @@ public:
 
 private:
     IdentifierTableIndex m_property;
+    u32 m_cache_index { 0 };
 };
 
 class GetPrivateById final : public Instruction {
@@ -568,11 +629,12 @@ enum class PropertyKind {
 
 class PutById final : public Instruction {
 public:
-    explicit PutById(Register base, IdentifierTableIndex property, PropertyKind kind = PropertyKind::KeyValue)
+    PutById(Register base, IdentifierTableIndex property, u32 cache_index, PropertyKind kind = PropertyKind::KeyValue)
         : Instruction(Type::PutById)
         , m_base(base)
         , m_property(property)
         , m_kind(kind)
+        , m_cache_index(cache_index)
     {
     }
 
@@ -584,11 +646,17 @@ public:
         if (m_base == from)
             m_base = to;
     }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_base, RegisterAccess::Read);
+    }
 
 private:
     Register m_base;
     IdentifierTableIndex m_property;
     PropertyKind m_kind;
+    u32 m_cache_index { 0 };
 };
 
 class PutPrivateById final : public Instruction {
@@ -609,6 +677,11 @@ public:
         if (m_base == from)
             m_base = to;
     }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_base, RegisterAccess::Read);
+    }
 
 private:
     Register m_base;
@@ -649,6 +722,11 @@ public:
         if (m_base == from)
             m_base = to;
     }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_base, RegisterAccess::Read);
+    }
 
 private:
     Register m_base;
@@ -672,6 +750,12 @@ public:
         if (m_base == from)
             m_base = to;
     }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_base, RegisterAccess::Read);
+        callback(m_property, RegisterAccess::Read);
+    }
 
 private:
     Register m_base;
@@ -695,6 +779,11 @@ public:
         if (m_base == from)
             m_base = to;
     }
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_base, RegisterAccess::Read);
+    }
 
 private:
     Register m_base;
@@ -770,6 +859,51 @@ public:
     DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
 };
 
+// Fused versions of a comparison followed by a JumpConditional, which loops and if statements use for their tests.
+// They leave the result of the comparison in the accumulator, just like the unfused instructions would.
+#define JS_ENUMERATE_COMPARE_AND_JUMP_OPS(O)                         \
+    O(JumpGreaterThan, GreaterThan, greater_than)                    \
+    O(JumpGreaterThanEquals, GreaterThanEquals, greater_than_equals) \
+    O(JumpLessThan, LessThan, less_than)                             \
+    O(JumpLessThanEquals, LessThanEquals, less_than_equals)          \
+    O(JumpStrictlyEquals, StrictlyEquals, typed_equals)              \
+    O(JumpStrictlyInequals, StrictlyInequals, typed_inequals)
+
+#define JS_DECLARE_COMPARE_AND_JUMP_OP(OpTitleCase, ComparisonTitleCase, comparison_snake_case)                     \
+    class OpTitleCase final : public Jump {                                                                         \
+    public:                                                                                                         \
+        explicit OpTitleCase(Register lhs_reg, Optional<Label> true_target = {}, Optional<Label> false_target = {}) \
+            : Jump(Type::OpTitleCase, move(true_target), move(false_target))                                        \
+            , m_lhs_reg(lhs_reg)                                                                                    \
+        {                                                                                                           \
+        }                                                                                                           \
+                                                                                                                    \
+        ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;                                         \
+        DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;                              \
+        void replace_references_impl(BasicBlock const& from, BasicBlock const& to)                                  \
+        {                                                                                                           \
+            Jump::replace_references_impl(from, to);                                                                \
+        }                                                                                                           \
+        void replace_references_impl(Register from, Register to)                                                    \
+        {                                                                                                           \
+            if (m_lhs_reg == from)                                                                                  \
+                m_lhs_reg = to;                                                                                     \
+        }                                                                                                           \
+        template<typename Callback>                                                                                 \
+        void visit_registers_impl(Callback callback)                                                                \
+        {                                                                                                           \
+            callback(m_lhs_reg, RegisterAccess::Read);                                                              \
+        }                                                                                                           \
+                                                                                                                    \
+        Register lhs() const { return m_lhs_reg; }                                                                  \
+                                                                                                                    \
+    private:                                                                                                        \
+        Register m_lhs_reg;                                                                                         \
+    };
+
+JS_ENUMERATE_COMPARE_AND_JUMP_OPS(JS_DECLARE_COMPARE_AND_JUMP_OP)
+#undef JS_DECLARE_COMPARE_AND_JUMP_OP
+
 // NOTE: This instruction is variable-width depending on the number of arguments!
 class Call final : public Instruction {
 public:
@@ -792,6 +926,12 @@ public:
     DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register);
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        callback(m_callee, RegisterAccess::Read);
+        callback(m_this_value, RegisterAccess::Read);
+    }
 
     Completion throw_type_error_for_callee(Bytecode::Interpreter&, StringView callee_type) const;
 
@@ -853,6 +993,12 @@ public:
     DeprecatedString to_deprecated_string_impl(Bytecode::Executable const&) const;
     void replace_references_impl(BasicBlock const&, BasicBlock const&) { }
     void replace_references_impl(Register, Register);
+    template<typename Callback>
+    void visit_registers_impl(Callback callback)
+    {
+        if (m_home_object.has_value())
+            callback(m_home_object.value(), RegisterAccess::Read);
+    }
 
 private:
     FunctionExpression const& m_function_node;
@@ -1334,6 +1480,30 @@ ALWAYS_INLINE void Instruction::replace_references(Register from, Register to)
 #undef __BYTECODE_OP
 }
 
+template<typename OpType, typename Callback>
+ALWAYS_INLINE void visit_registers_of(OpType& instruction, Callback callback)
+{
+    // Instructions that don't declare visit_registers_impl() have no register operands.
+    if constexpr (requires { instruction.visit_registers_impl(callback); })
+        instruction.visit_registers_impl(callback);
+}
+
+template<typename Callback>
+ALWAYS_INLINE void Instruction::visit_registers(Callback callback)
+{
+#define __BYTECODE_OP(op)                                                          \
+    case Instruction::Type::op:                                                    \
+        return visit_registers_of(static_cast<Bytecode::Op::op&>(*this), callback);
+
+    switch (type()) {
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+#undef __BYTECODE_OP
+}
+
 ALWAYS_INLINE size_t Instruction::length() const
 {
     if (type() == Type::NewArray)
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Bitmap.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+static Bitmap registers_that_are_read(Executable& executable)
+{
+    auto read_registers = Bitmap::create(executable.number_of_registers, false).release_value_but_fixme_should_propagate_errors();
+
+    for (auto& block : executable.basic_blocks) {
+        for (InstructionStreamIterator it { block->instruction_stream() }; !it.at_end(); ++it) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            if (instruction.type() == Instruction::Type::NewArray) {
+                auto const& new_array = static_cast<Op::NewArray const&>(instruction);
+                if (new_array.element_count())
+                    read_registers.set_range<true, false>(new_array.start().index(), new_array.element_count());
+                continue;
+            }
+            instruction.visit_registers([&](Register& reg, Instruction::RegisterAccess access) {
+                if (access != Instruction::RegisterAccess::Write)
+                    read_registers.set(reg.index(), true);
+            });
+        }
+    }
+
+    return read_registers;
+}
+
+void EliminateDeadStores::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    auto read_registers = registers_that_are_read(executable.executable);
+
+    for (auto& block : executable.executable.basic_blocks) {
+        // The register that is known to hold the same value as the accumulator, if any.
+        // Only Load and Store leave both of them alone, so anything else makes us forget it.
+        Optional<Register> register_in_accumulator;
+
+        block->remove_instructions_if([&](Instruction const& instruction) {
+            switch (instruction.type()) {
+            case Instruction::Type::Load: {
+                auto src = static_cast<Op::Load const&>(instruction).src();
+                if (register_in_accumulator == src)
+                    return true;
+                register_in_accumulator = src;
+                return false;
+            }
+            case Instruction::Type::Store: {
+                auto dst = static_cast<Op::Store const&>(instruction).dst();
+                // Nothing will ever look at this value.
+                if (dst != Register::accumulator() && !read_registers.get(dst.index()))
+                    return true;
+                if (register_in_accumulator == dst)
+                    return true;
+                register_in_accumulator = dst;
+                return false;
+            }
+            default:
+                register_in_accumulator.clear();
+                return false;
+            }
+        });
+    }
+
+    finished();
+}
+
+}
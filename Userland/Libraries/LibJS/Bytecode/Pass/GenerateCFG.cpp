@@ -64,7 +64,13 @@ static void generate_cfg_for_block(BasicBlock const& current_block, PassPipeline
             return;
         }
         case JumpConditional:
+        case JumpGreaterThan:
+        case JumpGreaterThanEquals:
+        case JumpLessThan:
+        case JumpLessThanEquals:
         case JumpNullish:
+        case JumpStrictlyEquals:
+        case JumpStrictlyInequals:
         case JumpUndefined: {
             // FIXME: It would be nice if we could avoid this copy, if we know that the unwind context stays the same in both paths
             //        Or with a COW capable Vector alternative
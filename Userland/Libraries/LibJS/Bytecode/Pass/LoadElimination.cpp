@@ -141,12 +141,24 @@ static NonnullOwnPtr<BasicBlock> eliminate_loads(BasicBlock const& block, size_t
             ++it;
             continue;
         case NewBigInt:
-            // FIXME: This is the only non trivially copyable Instruction,
+            // FIXME: NewBigInt, NewClass and NewFunction are not trivially copyable,
             //        so we need to do some extra work here
             new (new_block->next_slot()) Op::NewBigInt(static_cast<Op::NewBigInt const&>(*it));
             new_block->grow(sizeof(Op::NewBigInt));
             ++it;
             continue;
+        case NewClass:
+            new (new_block->next_slot()) Op::NewClass(static_cast<Op::NewClass const&>(*it));
+            new_block->grow(sizeof(Op::NewClass));
+            ++it;
+            continue;
+        case NewFunction:
+            new (new_block->next_slot()) Op::NewFunction(static_cast<Op::NewFunction const&>(*it));
+            for (auto route : register_rerouting_table)
+                reinterpret_cast<Instruction*>(new_block->next_slot())->replace_references(Register { route.key }, route.value);
+            new_block->grow(sizeof(Op::NewFunction));
+            ++it;
+            continue;
         default:
             break;
         }
@@ -159,13 +159,19 @@ void MergeBlocks::perform(PassPipelineExecutable& executable)
                 ++it;
                 if (instruction.is_terminator() && last_successor_index != i)
                     break;
-                // FIXME: Op::NewBigInt is not trivially copyable, so we cant use
-                //        a simple memcpy to transfer them.
+                // FIXME: Op::NewBigInt, Op::NewClass and Op::NewFunction are not trivially
+                //        copyable, so we cant use a simple memcpy to transfer them.
                 //        When this is resolved we can use a single memcpy to copy
                 //        the whole block at once
                 if (instruction.type() == Instruction::Type::NewBigInt) {
                     new (block.next_slot()) Op::NewBigInt(static_cast<Op::NewBigInt const&>(instruction));
                     block.grow(sizeof(Op::NewBigInt));
+                } else if (instruction.type() == Instruction::Type::NewClass) {
+                    new (block.next_slot()) Op::NewClass(static_cast<Op::NewClass const&>(instruction));
+                    block.grow(sizeof(Op::NewClass));
+                } else if (instruction.type() == Instruction::Type::NewFunction) {
+                    new (block.next_slot()) Op::NewFunction(static_cast<Op::NewFunction const&>(instruction));
+                    block.grow(sizeof(Op::NewFunction));
                 } else {
                     auto instruction_size = instruction.length();
                     memcpy(block.next_slot(), &instruction, instruction_size);
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/QuickSort.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PassManager.h>
+
+namespace JS::Bytecode::Passes {
+
+// The accumulator and the register after it are never renamed.
+static constexpr u32 first_allocatable_register = 2;
+
+struct RegisterUses {
+    BasicBlock const* block { nullptr };
+    // Whether the register is only used within `block`, and only after having been written to there.
+    bool is_local { true };
+    size_t first_use { 0 };
+    size_t last_use { 0 };
+};
+
+void AllocateRegisters::perform(PassPipelineExecutable& executable)
+{
+    started();
+
+    auto& basic_blocks = executable.executable.basic_blocks;
+    auto register_count = executable.executable.number_of_registers;
+
+    Vector<Optional<RegisterUses>> uses;
+    uses.resize(register_count);
+
+    auto note_use = [&](BasicBlock const& block, size_t instruction_index, Register reg, bool is_read) {
+        auto& register_uses = uses[reg.index()];
+        if (!register_uses.has_value()) {
+            // A register that is read before it is written may still hold a value from an earlier block.
+            register_uses = RegisterUses { &block, !is_read, instruction_index, instruction_index };
+            return;
+        }
+        if (register_uses->block != &block)
+            register_uses->is_local = false;
+        register_uses->last_use = instruction_index;
+    };
+
+    for (auto& block : basic_blocks) {
+        size_t instruction_index = 0;
+        for (InstructionStreamIterator it { block->instruction_stream() }; !it.at_end(); ++it, ++instruction_index) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            if (instruction.type() == Instruction::Type::NewArray) {
+                auto const& new_array = static_cast<Op::NewArray const&>(instruction);
+                if (!new_array.element_count())
+                    continue;
+                for (auto i = new_array.start().index(); i <= new_array.end().index(); ++i) {
+                    note_use(*block, instruction_index, Register { i }, true);
+                    // Element ranges have to stay contiguous, which we only guarantee for registers that keep their relative order.
+                    if (new_array.element_count() > 1)
+                        uses[i]->is_local = false;
+                }
+                continue;
+            }
+            instruction.visit_registers([&](Register& reg, Instruction::RegisterAccess access) {
+                note_use(*block, instruction_index, reg, access != Instruction::RegisterAccess::Write);
+            });
+        }
+    }
+
+    Vector<u32> new_index;
+    new_index.resize(register_count);
+
+    // Registers that are live across blocks are simply renumbered in order, dropping the unused ones.
+    u32 next_register = first_allocatable_register;
+    HashMap<BasicBlock const*, Vector<u32>> local_registers;
+    for (u32 i = 0; i < register_count; ++i) {
+        if (i < first_allocatable_register) {
+            new_index[i] = i;
+            continue;
+        }
+        if (!uses[i].has_value())
+            continue;
+        if (uses[i]->is_local)
+            local_registers.ensure(uses[i]->block).append(i);
+        else
+            new_index[i] = next_register++;
+    }
+
+    // Registers that are local to a block are dead outside of the span between their first and last use,
+    // so registers whose spans don't overlap can share a slot. Slots are shared between all blocks.
+    auto first_local_register = next_register;
+    u32 local_register_count = 0;
+    for (auto& block : basic_blocks) {
+        auto it = local_registers.find(block.ptr());
+        if (it == local_registers.end())
+            continue;
+        auto& registers = it->value;
+
+        quick_sort(registers, [&](u32 a, u32 b) { return uses[a]->first_use < uses[b]->first_use; });
+
+        Vector<u32> active_registers;
+        Vector<u32> free_slots;
+        u32 slot_count = 0;
+        for (auto reg : registers) {
+            active_registers.remove_all_matching([&](u32 active_register) {
+                if (uses[active_register]->last_use >= uses[reg]->first_use)
+                    return false;
+                free_slots.append(new_index[active_register] - first_local_register);
+                return true;
+            });
+            auto slot = free_slots.is_empty() ? slot_count++ : free_slots.take_last();
+            new_index[reg] = first_local_register + slot;
+            active_registers.append(reg);
+        }
+        local_register_count = max(local_register_count, slot_count);
+    }
+
+    for (auto& block : basic_blocks) {
+        for (InstructionStreamIterator it { block->instruction_stream() }; !it.at_end(); ++it) {
+            const_cast<Instruction&>(*it).visit_registers([&](Register& reg, Instruction::RegisterAccess) {
+                reg = Register { new_index[reg.index()] };
+            });
+        }
+    }
+
+    executable.executable.number_of_registers = first_local_register + local_register_count;
+
+    finished();
+}
+
+}
@@ -131,6 +131,24 @@ private:
     virtual void perform(PassPipelineExecutable&) override;
 };
 
+class EliminateDeadStores : public Pass {
+public:
+    EliminateDeadStores() = default;
+    virtual ~EliminateDeadStores() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
+class AllocateRegisters : public Pass {
+public:
+    AllocateRegisters() = default;
+    virtual ~AllocateRegisters() override = default;
+
+private:
+    virtual void perform(PassPipelineExecutable&) override;
+};
+
 }
 
 }
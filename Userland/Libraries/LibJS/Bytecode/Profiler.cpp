@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/Profiler.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/VM.h>
+
+namespace JS::Bytecode {
+
+static StringView instruction_type_name(Instruction::Type type)
+{
+    switch (type) {
+#define __BYTECODE_OP(op)       \
+    case Instruction::Type::op: \
+        return #op##sv;
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static double to_milliseconds(Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000.0;
+}
+
+Profiler& Profiler::the()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::set_enabled(bool enabled)
+{
+    m_enabled = enabled;
+    m_last_sample_time.clear();
+}
+
+ThrowCompletionOr<void> Profiler::execute(Instruction const& instruction, Interpreter& interpreter)
+{
+    auto time_in_enclosing_instructions = exchange(m_time_in_nested_instructions, {});
+
+    auto start = MonotonicTime::now();
+    auto result = instruction.execute(interpreter);
+    auto end = MonotonicTime::now();
+
+    auto& statistics = m_instruction_statistics[to_underlying(instruction.type())];
+    ++statistics.count;
+    statistics.self_time += (end - start) - m_time_in_nested_instructions;
+
+    if (!m_sampling_interval.is_zero())
+        take_sample(interpreter.vm(), end);
+
+    // NOTE: The time spent on profiling this instruction is not counted towards the instruction that ran it either.
+    m_time_in_nested_instructions = time_in_enclosing_instructions + (MonotonicTime::now() - start);
+
+    return result;
+}
+
+void Profiler::did_enter_executable(Executable const& executable)
+{
+    auto name = executable.name.is_empty() ? DeprecatedFlyString { "(anonymous)"sv } : executable.name;
+    m_invocation_counts.ensure(name, [] { return 0; })++;
+}
+
+// NOTE: Samples can only be taken between two instructions, so a sample stands for all the intervals that passed since the last one.
+//       That way, an instruction that took a long time (e.g. a call to a native function) gets as many samples as it should.
+void Profiler::take_sample(VM& vm, MonotonicTime now)
+{
+    if (!m_last_sample_time.has_value()) {
+        m_last_sample_time = now;
+        return;
+    }
+
+    auto interval_in_nanoseconds = m_sampling_interval.to_nanoseconds();
+    auto elapsed_intervals = (now - *m_last_sample_time).to_nanoseconds() / interval_in_nanoseconds;
+    if (elapsed_intervals <= 0)
+        return;
+    *m_last_sample_time = *m_last_sample_time + Duration::from_nanoseconds(elapsed_intervals * interval_in_nanoseconds);
+
+    StringBuilder builder;
+    for (auto const* context : vm.execution_context_stack()) {
+        if (!builder.is_empty())
+            builder.append(';');
+
+        if (!context->function_name.is_empty())
+            builder.append(context->function_name.view().replace(";"sv, ":"sv, ReplaceMode::All));
+        else if (context->function)
+            builder.append("(anonymous)"sv);
+        else
+            builder.append("(global)"sv);
+    }
+
+    m_samples.ensure(builder.to_deprecated_string(), [] { return 0; }) += elapsed_intervals;
+}
+
+ErrorOr<void> Profiler::write_report(Stream& stream) const
+{
+    Vector<Instruction::Type> instruction_types;
+    Duration total_time;
+    for (size_t i = 0; i < instruction_type_count; ++i) {
+        if (m_instruction_statistics[i].count == 0)
+            continue;
+        instruction_types.append(static_cast<Instruction::Type>(i));
+        total_time += m_instruction_statistics[i].self_time;
+    }
+    quick_sort(instruction_types, [&](auto a, auto b) {
+        return statistics_for(a).self_time > statistics_for(b).self_time;
+    });
+
+    TRY(stream.write_formatted("{:<32} {:>14} {:>16} {:>8}\n", "Instruction", "Count", "Self time (ms)", "%"));
+    for (auto type : instruction_types) {
+        auto const& statistics = statistics_for(type);
+        auto percentage = total_time.is_zero() ? 0.0 : 100.0 * to_milliseconds(statistics.self_time) / to_milliseconds(total_time);
+        TRY(stream.write_formatted("{:<32} {:>14} {:>16.3} {:>8.2}\n", instruction_type_name(type), statistics.count, to_milliseconds(statistics.self_time), percentage));
+    }
+
+    struct FunctionInvocations {
+        DeprecatedFlyString name;
+        u64 count { 0 };
+    };
+    Vector<FunctionInvocations> functions;
+    for (auto const& it : m_invocation_counts)
+        functions.append({ it.key, it.value });
+    quick_sort(functions, [](auto const& a, auto const& b) {
+        return a.count > b.count;
+    });
+
+    TRY(stream.write_formatted("\n{:<48} {:>14}\n", "Function", "Invocations"));
+    for (auto const& function : functions)
+        TRY(stream.write_formatted("{:<48} {:>14}\n", function.name, function.count));
+
+    return {};
+}
+
+ErrorOr<void> Profiler::write_folded_stacks(Stream& stream) const
+{
+    for (auto const& sample : m_samples)
+        TRY(stream.write_formatted("{} {}\n", sample.key, sample.value));
+    return {};
+}
+
+void Profiler::reset()
+{
+    m_instruction_statistics = {};
+    m_invocation_counts.clear();
+    m_time_in_nested_instructions = {};
+    m_last_sample_time.clear();
+    m_samples.clear();
+}
+
+}
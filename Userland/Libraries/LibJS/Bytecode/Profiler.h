@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/DeprecatedFlyString.h>
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/Stream.h>
+#include <AK/Time.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/Completion.h>
+
+namespace JS::Bytecode {
+
+// Opt-in instrumentation for the bytecode interpreter. While it is enabled, the interpreter counts and times
+// every instruction it executes, and counts how often each executable is entered. It can also sample the JS
+// call stack at a fixed interval, and write those samples in the "folded stacks" format that flame graph tools
+// (e.g. flamegraph.pl, inferno or speedscope) load.
+// NOTE: The JIT is not used while profiling, as native code doesn't go through the interpreter's dispatch loop.
+class Profiler {
+public:
+    struct InstructionStatistics {
+        u64 count { 0 };
+
+        // The time spent in the instruction itself, without the instructions it ran in turn (e.g. for a Call).
+        // NOTE: This still includes the interpreter's own overhead of running those instructions.
+        Duration self_time;
+    };
+
+    static Profiler& the();
+
+    [[nodiscard]] bool is_enabled() const { return m_enabled; }
+    void set_enabled(bool);
+
+    // Samples the call stack every `interval` while the profiler is enabled. A zero interval disables sampling.
+    void set_sampling_interval(Duration interval) { m_sampling_interval = interval; }
+
+    ThrowCompletionOr<void> execute(Instruction const&, Interpreter&);
+    void did_enter_executable(Executable const&);
+
+    InstructionStatistics const& statistics_for(Instruction::Type type) const { return m_instruction_statistics[to_underlying(type)]; }
+    HashMap<DeprecatedFlyString, u64> const& invocation_counts() const { return m_invocation_counts; }
+
+    // Maps call stacks (from the outermost to the innermost function, separated by semicolons) to their sample count.
+    HashMap<DeprecatedString, u64> const& samples() const { return m_samples; }
+
+    ErrorOr<void> write_report(Stream&) const;
+    ErrorOr<void> write_folded_stacks(Stream&) const;
+
+    void reset();
+
+private:
+    Profiler() = default;
+
+    void take_sample(VM&, MonotonicTime now);
+
+    static constexpr size_t instruction_type_count = 0
+#define __BYTECODE_OP(op) +1
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+        ;
+
+    bool m_enabled { false };
+
+    AK::Array<InstructionStatistics, instruction_type_count> m_instruction_statistics {};
+    HashMap<DeprecatedFlyString, u64> m_invocation_counts;
+
+    // The time spent in instructions that ran while the current one was executing.
+    Duration m_time_in_nested_instructions;
+
+    Duration m_sampling_interval;
+    Optional<MonotonicTime> m_last_sample_time;
+    HashMap<DeprecatedString, u64> m_samples;
+};
+
+}
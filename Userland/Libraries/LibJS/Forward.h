@@ -155,6 +155,7 @@ class Accessor;
 struct AsyncGeneratorRequest;
 class BigInt;
 class BoundFunction;
+struct CacheablePropertyMetadata;
 class Cell;
 class CellAllocator;
 class ClassExpression;
@@ -307,4 +308,8 @@ class Interpreter;
 class Register;
 }
 
+namespace JIT {
+class NativeExecutable;
+}
+
 }
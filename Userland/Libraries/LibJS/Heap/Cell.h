@@ -38,8 +38,10 @@ public:
     bool is_marked() const { return m_mark; }
     void set_marked(bool b) { m_mark = b; }
 
-    enum class State {
+    enum class State : u8 {
         Live,
+        // The cell was found to be unreachable and has been finalized, but has not been destroyed by the sweeper yet.
+        Dying,
         Dead,
     };
 
@@ -96,6 +98,8 @@ public:
     virtual void visit_edges(Visitor&) { }
 
     // This will be called on unmarked objects by the garbage collector in a separate pass before destruction.
+    // NOTE: Dead cells are destroyed lazily, some time after the collection that found them. Cells that hand out
+    //       weak pointers to themselves must revoke them here, so they can't be revived in the meantime.
     virtual void finalize() { }
 
     // This allows cells to survive GC by choice, even if nothing points to them.
@@ -116,7 +120,7 @@ protected:
 private:
     bool m_mark : 1 { false };
     bool m_overrides_must_survive_garbage_collection : 1 { false };
-    State m_state : 1 { State::Live };
+    State m_state : 2 { State::Live };
 };
 
 }
@@ -19,6 +19,9 @@ CellAllocator::CellAllocator(size_t cell_size)
 
 Cell* CellAllocator::allocate_cell(Heap& heap)
 {
+    while (m_usable_blocks.is_empty() && !m_blocks_to_sweep.is_empty())
+        sweep_block(*m_blocks_to_sweep.first());
+
     if (m_usable_blocks.is_empty()) {
         auto block = HeapBlock::create_with_cell_size(heap, m_cell_size);
         m_usable_blocks.append(*block.leak_ptr());
@@ -32,19 +35,34 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     return cell;
 }
 
-void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block)
+void CellAllocator::block_has_dying_cells(Badge<Heap>, HeapBlock& block)
 {
-    auto& heap = block.heap();
     block.m_list_node.remove();
-    // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
-    block.~HeapBlock();
-    heap.block_allocator().deallocate_block(&block);
+    m_blocks_to_sweep.append(block);
 }
 
-void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
+void CellAllocator::sweep_all_blocks(Badge<Heap>)
 {
-    VERIFY(!block.is_full());
-    m_usable_blocks.append(block);
+    while (!m_blocks_to_sweep.is_empty())
+        sweep_block(*m_blocks_to_sweep.first());
+}
+
+void CellAllocator::sweep_block(HeapBlock& block)
+{
+    block.m_list_node.remove();
+
+    if (!block.sweep()) {
+        auto& heap = block.heap();
+        // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
+        block.~HeapBlock();
+        heap.block_allocator().deallocate_block(&block);
+        return;
+    }
+
+    if (block.is_full())
+        m_full_blocks.append(block);
+    else
+        m_usable_blocks.append(block);
 }
 
 }
@@ -33,11 +33,15 @@ public:
             if (callback(block) == IterationDecision::Break)
                 return IterationDecision::Break;
         }
+        for (auto& block : m_blocks_to_sweep) {
+            if (callback(block) == IterationDecision::Break)
+                return IterationDecision::Break;
+        }
         return IterationDecision::Continue;
     }
 
-    void block_did_become_empty(Badge<Heap>, HeapBlock&);
-    void block_did_become_usable(Badge<Heap>, HeapBlock&);
+    void block_has_dying_cells(Badge<Heap>, HeapBlock&);
+    void sweep_all_blocks(Badge<Heap>);
 
 private:
     const size_t m_cell_size;
@@ -45,6 +49,11 @@ private:
     using BlockList = IntrusiveList<&HeapBlock::m_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
+
+    // Blocks with dying cells are swept lazily, when the allocator runs out of usable blocks.
+    BlockList m_blocks_to_sweep;
+
+    void sweep_block(HeapBlock&);
 };
 
 }
@@ -97,9 +97,8 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     perf_event(PERF_EVENT_SIGNPOST, gc_perf_string_id, global_gc_counter++);
 #endif
 
-    Core::ElapsedTimer collection_measurement_timer;
-    if (print_report)
-        collection_measurement_timer.start();
+    Core::ElapsedTimer collection_measurement_timer(true);
+    collection_measurement_timer.start();
 
     if (collection_type == CollectionType::CollectGarbage) {
         if (m_gc_deferrals) {
@@ -111,7 +110,7 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         mark_live_cells(roots);
     }
     finalize_unmarked_cells();
-    sweep_dead_cells(print_report, collection_measurement_timer);
+    sweep_dead_cells(collection_type, print_report, collection_measurement_timer);
 }
 
 void Heap::gather_roots(HashTable<Cell*>& roots)
@@ -220,6 +219,11 @@ public:
     {
         if (cell.is_marked())
             return;
+
+        // NOTE: Uprooted cells may still be referenced after they died, but must neither be revived nor traced through.
+        if (cell.state() != Cell::State::Live)
+            return;
+
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
         cell.set_marked(true);
@@ -268,51 +272,51 @@ void Heap::finalize_unmarked_cells()
     });
 }
 
-void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
+void Heap::sweep_dead_cells(CollectionType collection_type, bool print_report, Core::ElapsedTimer const& measurement_timer)
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
-    Vector<HeapBlock*, 32> empty_blocks;
-    Vector<HeapBlock*, 32> full_blocks_that_became_usable;
+    Vector<HeapBlock*, 32> blocks_with_dying_cells;
 
     size_t collected_cells = 0;
     size_t live_cells = 0;
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
 
+    // NOTE: Destroying dead cells is most of the work of a collection, so we only mark them as dying here,
+    //       and leave it to the allocators to sweep their blocks once they need the space.
     for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
-        bool block_was_full = block.is_full();
+        bool block_has_dying_cells = false;
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell)) {
                 dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
-                block.deallocate(cell);
+                cell->set_state(Cell::State::Dying);
+                block_has_dying_cells = true;
                 ++collected_cells;
                 collected_cell_bytes += block.cell_size();
             } else {
                 cell->set_marked(false);
-                block_has_live_cells = true;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
             }
         });
-        if (!block_has_live_cells)
-            empty_blocks.append(&block);
-        else if (block_was_full != block.is_full())
-            full_blocks_that_became_usable.append(&block);
+        if (block_has_dying_cells)
+            blocks_with_dying_cells.append(&block);
         return IterationDecision::Continue;
     });
 
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
 
-    for (auto* block : empty_blocks) {
-        dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
-        allocator_for_size(block->cell_size()).block_did_become_empty({}, *block);
+    m_max_allocations_between_gc = clamp(live_cells, minimum_allocations_between_gc, maximum_allocations_between_gc);
+
+    for (auto* block : blocks_with_dying_cells) {
+        dbgln_if(HEAP_DEBUG, " - HeapBlock has dying cells @ {}: cell_size={}", block, block->cell_size());
+        allocator_for_size(block->cell_size()).block_has_dying_cells({}, *block);
     }
 
-    for (auto* block : full_blocks_that_became_usable) {
-        dbgln_if(HEAP_DEBUG, " - HeapBlock usable again @ {}: cell_size={}", block, block->cell_size());
-        allocator_for_size(block->cell_size()).block_did_become_usable({}, *block);
+    if (collection_type == CollectionType::CollectEverything) {
+        for (auto& allocator : m_allocators)
+            allocator->sweep_all_blocks({});
     }
 
     if constexpr (HEAP_DEBUG) {
@@ -322,8 +326,10 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
+    Duration const time_spent = measurement_timer.elapsed_time();
+    m_statistics.record_pause(time_spent);
+
     if (print_report) {
-        Duration const time_spent = measurement_timer.elapsed_time();
         size_t live_block_count = 0;
         for_each_block([&](auto&) {
             ++live_block_count;
@@ -336,11 +342,31 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
         dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::block_size);
-        dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::block_size);
+        dbgln("    Collections: {} ({} ms in total, {} ms at most)", m_statistics.collection_count, m_statistics.total_pause_time.to_milliseconds(), m_statistics.max_pause_time.to_milliseconds());
+        for (size_t i = 0; i < m_statistics.pause_histogram.size(); ++i) {
+            if (!m_statistics.pause_histogram[i])
+                continue;
+            if (i == m_statistics.pause_histogram.size() - 1)
+                dbgln("      >= {:4} ms: {}", 1u << (i - 1), m_statistics.pause_histogram[i]);
+            else
+                dbgln("       < {:4} ms: {}", 1u << i, m_statistics.pause_histogram[i]);
+        }
         dbgln("=============================================");
     }
 }
 
+void Heap::Statistics::record_pause(Duration pause_time)
+{
+    ++collection_count;
+    total_pause_time += pause_time;
+    max_pause_time = max(max_pause_time, pause_time);
+
+    size_t bucket = 0;
+    while (bucket < pause_histogram.size() - 1 && pause_time.to_milliseconds() >= (1 << bucket))
+        ++bucket;
+    ++pause_histogram[bucket];
+}
+
 void Heap::did_create_handle(Badge<HandleImpl>, HandleImpl& impl)
 {
     VERIFY(!m_handles.contains(impl));
@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Badge.h>
 #include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -78,6 +80,19 @@ public:
 
     void uproot_cell(Cell* cell);
 
+    struct Statistics {
+        size_t collection_count { 0 };
+        Duration total_pause_time;
+        Duration max_pause_time;
+
+        // Bucket i counts the pauses shorter than 2^i ms, but not shorter than 2^(i-1) ms. The last bucket counts all longer pauses.
+        AK::Array<size_t, 12> pause_histogram {};
+
+        void record_pause(Duration);
+    };
+
+    Statistics const& statistics() const { return m_statistics; }
+
 private:
     static bool cell_must_survive_garbage_collection(Cell const&);
 
@@ -87,7 +102,7 @@ private:
     void gather_conservative_roots(HashTable<Cell*>&);
     void mark_live_cells(HashTable<Cell*> const& live_cells);
     void finalize_unmarked_cells();
-    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+    void sweep_dead_cells(CollectionType, bool print_report, Core::ElapsedTimer const&);
 
     CellAllocator& allocator_for_size(size_t);
 
@@ -100,7 +115,13 @@ private:
         }
     }
 
-    size_t m_max_allocations_between_gc { 100000 };
+    // A collection is triggered once as many cells have been allocated since the last one as survived it,
+    // so that the time spent marking and sweeping grows with the number of allocations rather than with
+    // the size of the heap. Every collection still marks and sweeps the whole heap.
+    // The interval is capped, so that a large heap only grows by a bounded number of cells between collections.
+    static constexpr size_t minimum_allocations_between_gc = 100000;
+    static constexpr size_t maximum_allocations_between_gc = 1000000;
+    size_t m_max_allocations_between_gc { minimum_allocations_between_gc };
     size_t m_allocations_since_last_gc { 0 };
 
     bool m_should_collect_on_every_allocation { false };
@@ -121,6 +142,8 @@ private:
     bool m_should_gc_when_deferral_ends { false };
 
     bool m_collecting_garbage { false };
+
+    Statistics m_statistics;
 };
 
 }
@@ -43,7 +43,7 @@ void HeapBlock::deallocate(Cell* cell)
 {
     VERIFY(is_valid_cell_pointer(cell));
     VERIFY(!m_freelist || is_valid_cell_pointer(m_freelist));
-    VERIFY(cell->state() == Cell::State::Live);
+    VERIFY(cell->state() == Cell::State::Live || cell->state() == Cell::State::Dying);
     VERIFY(!cell->is_marked());
 
     cell->~Cell();
@@ -63,4 +63,16 @@ void HeapBlock::deallocate(Cell* cell)
 #endif
 }
 
+bool HeapBlock::sweep()
+{
+    bool has_live_cells = false;
+    for_each_cell([&](Cell* cell) {
+        if (cell->state() == Cell::State::Dying)
+            deallocate(cell);
+        else if (cell->state() == Cell::State::Live)
+            has_live_cells = true;
+    });
+    return has_live_cells;
+}
+
 }
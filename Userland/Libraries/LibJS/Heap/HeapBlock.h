@@ -49,6 +49,9 @@ public:
 
     void deallocate(Cell*);
 
+    // Destroys the cells that the last garbage collection found to be dying. Returns whether any live cells remain.
+    bool sweep();
+
     template<typename Callback>
     void for_each_cell(Callback callback)
     {
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BitCast.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+
+namespace JS::JIT {
+
+// A minimal x86-64 assembler, which only knows the handful of instructions the JIT compiler needs.
+struct Assembler {
+    explicit Assembler(Vector<u8>& output)
+        : m_output(output)
+    {
+    }
+
+    Vector<u8>& m_output;
+
+    enum class Reg {
+        RAX = 0,
+        RCX = 1,
+        RDX = 2,
+        RBX = 3,
+        RSP = 4,
+        RBP = 5,
+        RSI = 6,
+        RDI = 7,
+        R8 = 8,
+        R9 = 9,
+        R10 = 10,
+        R11 = 11,
+        R12 = 12,
+        R13 = 13,
+        R14 = 14,
+        R15 = 15,
+    };
+
+    enum class Condition {
+        Overflow = 0x0,
+        Below = 0x2,
+        AboveOrEqual = 0x3,
+        Equal = 0x4,
+        NotEqual = 0x5,
+        BelowOrEqual = 0x6,
+        Above = 0x7,
+        LessThan = 0xc,
+        GreaterThanOrEqual = 0xd,
+        LessThanOrEqual = 0xe,
+        GreaterThan = 0xf,
+    };
+
+    struct Label {
+        Optional<size_t> offset_in_output;
+        Vector<size_t> unresolved_jump_slots;
+    };
+
+    void mov_imm64(Reg dst, u64 imm)
+    {
+        emit_rex(true, 0, dst);
+        emit8(0xb8 | encode_reg(dst));
+        emit64(imm);
+    }
+
+    void mov(Reg dst, Reg src)
+    {
+        emit_rex(true, src, dst);
+        emit8(0x89);
+        emit_modrm_reg(src, dst);
+    }
+
+    // mov dst, [base + offset]
+    void load(Reg dst, Reg base, i32 offset)
+    {
+        emit_rex(true, dst, base);
+        emit8(0x8b);
+        emit_modrm_mem(dst, base, offset);
+    }
+
+    // mov [base + offset], src
+    void store(Reg base, i32 offset, Reg src)
+    {
+        emit_rex(true, src, base);
+        emit8(0x89);
+        emit_modrm_mem(src, base, offset);
+    }
+
+    void shift_right64(Reg dst, u8 amount)
+    {
+        emit_rex(true, 0, dst);
+        emit8(0xc1);
+        emit_modrm_reg(5, dst);
+        emit8(amount);
+    }
+
+    void compare64(Reg lhs, i32 imm)
+    {
+        emit_rex(true, 0, lhs);
+        emit8(0x81);
+        emit_modrm_reg(7, lhs);
+        emit32(imm);
+    }
+
+    void or64(Reg dst, Reg src)
+    {
+        emit_rex(true, src, dst);
+        emit8(0x09);
+        emit_modrm_reg(src, dst);
+    }
+
+    void and64(Reg dst, i32 imm)
+    {
+        emit_rex(true, 0, dst);
+        emit8(0x81);
+        emit_modrm_reg(4, dst);
+        emit32(imm);
+    }
+
+    void add32(Reg dst, Reg src) { emit_alu32(0x01, dst, src); }
+    void sub32(Reg dst, Reg src) { emit_alu32(0x29, dst, src); }
+    void and32(Reg dst, Reg src) { emit_alu32(0x21, dst, src); }
+    void or32(Reg dst, Reg src) { emit_alu32(0x09, dst, src); }
+    void xor32(Reg dst, Reg src) { emit_alu32(0x31, dst, src); }
+    void compare32(Reg lhs, Reg rhs) { emit_alu32(0x39, lhs, rhs); }
+    void test32(Reg lhs, Reg rhs) { emit_alu32(0x85, lhs, rhs); }
+
+    void add32(Reg dst, i8 imm)
+    {
+        emit_rex(false, 0, dst);
+        emit8(0x83);
+        emit_modrm_reg(0, dst);
+        emit8(static_cast<u8>(imm));
+    }
+
+    // test r8, r8 on the low byte of RAX, which is where functions return a bool.
+    void test_al()
+    {
+        emit8(0x84);
+        emit8(0xc0);
+    }
+
+    // Sets the low byte of `dst` to 1 if `condition` holds and to 0 otherwise, and clears the rest of it.
+    void set_if(Condition condition, Reg dst)
+    {
+        // Always emit a REX prefix, so that encodings 4-7 refer to SPL, BPL, SIL and DIL instead of AH, CH, DH and BH.
+        emit8(0x40 | (to_underlying(dst) >= 8 ? 0x01 : 0x00));
+        emit8(0x0f);
+        emit8(0x90 | to_underlying(condition));
+        emit_modrm_reg(0, dst);
+
+        // movzx dst32, dst8
+        emit8(0x40 | (to_underlying(dst) >= 8 ? 0x05 : 0x00));
+        emit8(0x0f);
+        emit8(0xb6);
+        emit_modrm_reg(dst, dst);
+    }
+
+    void push(Reg reg)
+    {
+        if (to_underlying(reg) >= 8)
+            emit8(0x41);
+        emit8(0x50 | encode_reg(reg));
+    }
+
+    void pop(Reg reg)
+    {
+        if (to_underlying(reg) >= 8)
+            emit8(0x41);
+        emit8(0x58 | encode_reg(reg));
+    }
+
+    void add_to_stack_pointer(i8 amount)
+    {
+        emit_rex(true, 0, Reg::RSP);
+        emit8(0x83);
+        emit_modrm_reg(0, Reg::RSP);
+        emit8(static_cast<u8>(amount));
+    }
+
+    void call(Reg target)
+    {
+        if (to_underlying(target) >= 8)
+            emit8(0x41);
+        emit8(0xff);
+        emit_modrm_reg(2, target);
+    }
+
+    void jump(Reg target)
+    {
+        if (to_underlying(target) >= 8)
+            emit8(0x41);
+        emit8(0xff);
+        emit_modrm_reg(4, target);
+    }
+
+    void ret() { emit8(0xc3); }
+
+    void jump(Label& label)
+    {
+        emit8(0xe9);
+        emit_jump_slot(label);
+    }
+
+    void jump_if(Condition condition, Label& label)
+    {
+        emit8(0x0f);
+        emit8(0x80 | to_underlying(condition));
+        emit_jump_slot(label);
+    }
+
+    void link(Label& label)
+    {
+        VERIFY(!label.offset_in_output.has_value());
+        label.offset_in_output = m_output.size();
+        for (auto slot : label.unresolved_jump_slots)
+            patch_jump_slot(slot, m_output.size());
+        label.unresolved_jump_slots.clear();
+    }
+
+    // Calls a function with the System V calling convention. Arguments must already be in RDI, RSI, RDX and RCX.
+    template<typename Callee>
+    void native_call(Callee* callee)
+    {
+        mov_imm64(Reg::RAX, bit_cast<FlatPtr>(callee));
+        call(Reg::RAX);
+    }
+
+private:
+    static u8 encode_reg(Reg reg) { return to_underlying(reg) & 7; }
+    static u8 encode_reg(u8 reg) { return reg & 7; }
+
+    template<typename RegOrExtension>
+    void emit_rex(bool wide, RegOrExtension reg, Reg rm)
+    {
+        u8 rex = 0x40;
+        if (wide)
+            rex |= 0x08;
+        if (static_cast<u8>(reg) >= 8)
+            rex |= 0x04;
+        if (to_underlying(rm) >= 8)
+            rex |= 0x01;
+        if (rex != 0x40)
+            emit8(rex);
+    }
+
+    template<typename RegOrExtension>
+    void emit_modrm_reg(RegOrExtension reg, Reg rm)
+    {
+        emit8(0xc0 | (encode_reg(reg) << 3) | encode_reg(rm));
+    }
+
+    void emit_modrm_mem(Reg reg, Reg base, i32 offset)
+    {
+        // Always use a 32-bit displacement, which also avoids the special meaning of mod=00 with RBP and R13 as base.
+        emit8(0x80 | (encode_reg(reg) << 3) | encode_reg(base));
+        // RSP and R12 as base need a SIB byte.
+        if (encode_reg(base) == 4)
+            emit8(0x24);
+        emit32(static_cast<u32>(offset));
+    }
+
+    void emit_alu32(u8 opcode, Reg dst, Reg src)
+    {
+        emit_rex(false, src, dst);
+        emit8(opcode);
+        emit_modrm_reg(src, dst);
+    }
+
+    void emit_jump_slot(Label& label)
+    {
+        auto slot = m_output.size();
+        emit32(0);
+        if (label.offset_in_output.has_value())
+            patch_jump_slot(slot, *label.offset_in_output);
+        else
+            label.unresolved_jump_slots.append(slot);
+    }
+
+    void patch_jump_slot(size_t slot, size_t target)
+    {
+        auto displacement = static_cast<i32>(static_cast<i64>(target) - static_cast<i64>(slot + 4));
+        for (size_t i = 0; i < 4; ++i)
+            m_output[slot + i] = static_cast<u8>(static_cast<u32>(displacement) >> (i * 8));
+    }
+
+    void emit8(u8 value) { m_output.append(value); }
+
+    void emit32(u32 value)
+    {
+        for (size_t i = 0; i < 4; ++i)
+            emit8(static_cast<u8>(value >> (i * 8)));
+    }
+
+    void emit64(u64 value)
+    {
+        for (size_t i = 0; i < 8; ++i)
+            emit8(static_cast<u8>(value >> (i * 8)));
+    }
+};
+
+}
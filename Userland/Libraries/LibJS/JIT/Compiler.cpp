@@ -0,0 +1,457 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/Platform.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/JIT/Compiler.h>
+#include <sys/mman.h>
+
+namespace JS::JIT {
+
+#if ARCH(X86_64)
+
+using Reg = Assembler::Reg;
+using Condition = Assembler::Condition;
+
+// Native code keeps these in callee-saved registers, so that they survive calls into C++.
+static constexpr auto REGISTERS_BASE = Reg::RBX;
+static constexpr auto INTERPRETER = Reg::R12;
+static constexpr auto EXCEPTION_SLOT = Reg::R13;
+
+static_assert(sizeof(Value) == sizeof(u64));
+
+// Runs an instruction which has no fast path (or whose fast path did not apply) in the interpreter.
+// Returns whether native code can go on with the next instruction. If it cannot, either the
+// instruction threw and `exception` is set, or the interpreter has to jump or return.
+template<typename OpType>
+static bool cxx_execute(Bytecode::Interpreter& interpreter, OpType const& instruction, Optional<Value>& exception)
+{
+    auto result = instruction.execute_impl(interpreter);
+    if (result.is_error()) {
+        exception = result.release_error().value();
+        return false;
+    }
+    return !interpreter.has_pending_jump_or_return();
+}
+
+static bool cxx_accumulator_to_boolean(Bytecode::Interpreter& interpreter)
+{
+    return interpreter.accumulator().to_boolean();
+}
+
+OwnPtr<NativeExecutable> Compiler::compile(Bytecode::Executable const& executable)
+{
+    Compiler compiler { executable };
+    auto& assembler = compiler.m_assembler;
+
+    for (auto& block : executable.basic_blocks)
+        compiler.m_block_labels.set(block, make<Assembler::Label>());
+
+    // Entry: (Interpreter&, Value* registers, FlatPtr entry_point, Optional<Value>* exception).
+    // Four pushes on top of the return address leave the stack misaligned by 8 bytes.
+    assembler.push(Reg::RBP);
+    assembler.push(REGISTERS_BASE);
+    assembler.push(INTERPRETER);
+    assembler.push(EXCEPTION_SLOT);
+    assembler.add_to_stack_pointer(-8);
+    assembler.mov(INTERPRETER, Reg::RDI);
+    assembler.mov(REGISTERS_BASE, Reg::RSI);
+    assembler.mov(EXCEPTION_SLOT, Reg::RCX);
+    assembler.jump(Reg::RDX);
+
+    // Exit: returns the NativeExecutable::Exit (block, instruction) in RAX:RDX.
+    assembler.link(compiler.m_exit_label);
+    assembler.add_to_stack_pointer(8);
+    assembler.pop(EXCEPTION_SLOT);
+    assembler.pop(INTERPRETER);
+    assembler.pop(REGISTERS_BASE);
+    assembler.pop(Reg::RBP);
+    assembler.ret();
+
+    HashMap<Bytecode::BasicBlock const*, size_t> block_offsets;
+    for (auto& block : executable.basic_blocks) {
+        block_offsets.set(block, compiler.m_output.size());
+        compiler.compile_block(*block);
+    }
+
+    auto& output = compiler.m_output;
+    auto* code = mmap(nullptr, output.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED) {
+        perror("mmap");
+        return nullptr;
+    }
+    memcpy(code, output.data(), output.size());
+    if (mprotect(code, output.size(), PROT_READ | PROT_EXEC) < 0) {
+        perror("mprotect");
+        munmap(code, output.size());
+        return nullptr;
+    }
+
+    dbgln_if(JIT_DEBUG, "JIT compiled {} ({} basic blocks) into {} bytes at {:p}", executable.name, executable.basic_blocks.size(), output.size(), code);
+    return make<NativeExecutable>(code, output.size(), move(block_offsets));
+}
+
+void Compiler::compile_block(Bytecode::BasicBlock const& block)
+{
+    m_assembler.link(*m_block_labels.get(&block).value());
+
+    Bytecode::InstructionStreamIterator it(block.instruction_stream());
+    while (!it.at_end()) {
+        compile_instruction(*it, block);
+        ++it;
+    }
+
+    // Falling off the end of a block ends the executable.
+    m_assembler.mov_imm64(Reg::RAX, bit_cast<FlatPtr>(&block));
+    m_assembler.mov_imm64(Reg::RDX, 0);
+    m_assembler.jump(m_exit_label);
+}
+
+void Compiler::compile_instruction(Bytecode::Instruction const& instruction, Bytecode::BasicBlock const& block)
+{
+    using Type = Bytecode::Instruction::Type;
+
+    switch (instruction.type()) {
+    case Type::Load:
+        compile_load(static_cast<Bytecode::Op::Load const&>(instruction));
+        return;
+    case Type::LoadImmediate:
+        compile_load_immediate(static_cast<Bytecode::Op::LoadImmediate const&>(instruction));
+        return;
+    case Type::Store:
+        compile_store(static_cast<Bytecode::Op::Store const&>(instruction));
+        return;
+    case Type::Jump:
+        compile_jump(static_cast<Bytecode::Op::Jump const&>(instruction), block);
+        return;
+    case Type::JumpConditional:
+        compile_jump_conditional(static_cast<Bytecode::Op::JumpConditional const&>(instruction), block);
+        return;
+    case Type::JumpNullish:
+        compile_jump_nullish(static_cast<Bytecode::Op::JumpNullish const&>(instruction), block);
+        return;
+    case Type::JumpUndefined:
+        compile_jump_undefined(static_cast<Bytecode::Op::JumpUndefined const&>(instruction), block);
+        return;
+    case Type::Increment:
+        compile_increment_or_decrement(instruction, block, 1);
+        return;
+    case Type::Decrement:
+        compile_increment_or_decrement(instruction, block, -1);
+        return;
+#define __COMPILE_INT32_BINARY_OP(OpTitleCase)                                           \
+    case Type::OpTitleCase:                                                              \
+        compile_int32_binary_operation(instruction,                                      \
+            static_cast<Bytecode::Op::OpTitleCase const&>(instruction).lhs(), block,     \
+            Int32Operation::OpTitleCase);                                                \
+        return;
+        __COMPILE_INT32_BINARY_OP(Add)
+        __COMPILE_INT32_BINARY_OP(Sub)
+        __COMPILE_INT32_BINARY_OP(BitwiseAnd)
+        __COMPILE_INT32_BINARY_OP(BitwiseOr)
+        __COMPILE_INT32_BINARY_OP(BitwiseXor)
+        __COMPILE_INT32_BINARY_OP(LessThan)
+        __COMPILE_INT32_BINARY_OP(LessThanEquals)
+        __COMPILE_INT32_BINARY_OP(GreaterThan)
+        __COMPILE_INT32_BINARY_OP(GreaterThanEquals)
+        __COMPILE_INT32_BINARY_OP(StrictlyEquals)
+        __COMPILE_INT32_BINARY_OP(StrictlyInequals)
+#undef __COMPILE_INT32_BINARY_OP
+#define __COMPILE_COMPARE_AND_JUMP_OP(OpTitleCase, ComparisonTitleCase, comparison_snake_case) \
+    case Type::OpTitleCase:                                                                    \
+        compile_compare_and_jump(static_cast<Bytecode::Op::OpTitleCase const&>(instruction),   \
+            static_cast<Bytecode::Op::OpTitleCase const&>(instruction).lhs(), block,           \
+            Int32Operation::ComparisonTitleCase);                                              \
+        return;
+        JS_ENUMERATE_COMPARE_AND_JUMP_OPS(__COMPILE_COMPARE_AND_JUMP_OP)
+#undef __COMPILE_COMPARE_AND_JUMP_OP
+    // NOTE: Property accesses like GetById and PutById have no fast path here. They run the interpreter's
+    //       implementation, which owns the property lookup caches and knows which objects must not use them.
+    default:
+        compile_slow_path(instruction, block);
+        return;
+    }
+}
+
+void Compiler::load_register(Reg dst, Bytecode::Register reg)
+{
+    m_assembler.load(dst, REGISTERS_BASE, static_cast<i32>(reg.index() * sizeof(Value)));
+}
+
+void Compiler::store_register(Bytecode::Register reg, Reg src)
+{
+    m_assembler.store(REGISTERS_BASE, static_cast<i32>(reg.index() * sizeof(Value)), src);
+}
+
+void Compiler::jump_if_not_int32(Reg value, Assembler::Label& label)
+{
+    m_assembler.mov(Reg::RCX, value);
+    m_assembler.shift_right64(Reg::RCX, TAG_SHIFT);
+    m_assembler.compare64(Reg::RCX, INT32_TAG);
+    m_assembler.jump_if(Condition::NotEqual, label);
+}
+
+void Compiler::jump_to_target(Optional<Bytecode::Label> const& target)
+{
+    m_assembler.jump(*m_block_labels.get(&target->block()).value());
+}
+
+void Compiler::compile_load(Bytecode::Op::Load const& instruction)
+{
+    load_register(Reg::RAX, instruction.src());
+    store_register(Bytecode::Register::accumulator(), Reg::RAX);
+}
+
+void Compiler::compile_load_immediate(Bytecode::Op::LoadImmediate const& instruction)
+{
+    m_assembler.mov_imm64(Reg::RAX, instruction.value().encoded());
+    store_register(Bytecode::Register::accumulator(), Reg::RAX);
+}
+
+void Compiler::compile_store(Bytecode::Op::Store const& instruction)
+{
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    store_register(instruction.dst(), Reg::RAX);
+}
+
+void Compiler::compile_jump(Bytecode::Op::Jump const& instruction, Bytecode::BasicBlock const& block)
+{
+    if (!instruction.true_target().has_value()) {
+        compile_slow_path(instruction, block);
+        return;
+    }
+    jump_to_target(instruction.true_target());
+}
+
+void Compiler::compile_jump_conditional(Bytecode::Op::JumpConditional const& instruction, Bytecode::BasicBlock const& block)
+{
+    if (!instruction.true_target().has_value() || !instruction.false_target().has_value()) {
+        compile_slow_path(instruction, block);
+        return;
+    }
+
+    Assembler::Label slow_case;
+    Assembler::Label test_payload;
+
+    // Booleans and int32s are truthy exactly when their payload is non-zero.
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    m_assembler.mov(Reg::RCX, Reg::RAX);
+    m_assembler.shift_right64(Reg::RCX, TAG_SHIFT);
+    m_assembler.compare64(Reg::RCX, BOOLEAN_TAG);
+    m_assembler.jump_if(Condition::Equal, test_payload);
+    m_assembler.compare64(Reg::RCX, INT32_TAG);
+    m_assembler.jump_if(Condition::NotEqual, slow_case);
+
+    m_assembler.link(test_payload);
+    m_assembler.test32(Reg::RAX, Reg::RAX);
+    m_assembler.jump_if(Condition::NotEqual, *m_block_labels.get(&instruction.true_target()->block()).value());
+    jump_to_target(instruction.false_target());
+
+    m_assembler.link(slow_case);
+    m_assembler.mov(Reg::RDI, INTERPRETER);
+    m_assembler.native_call(&cxx_accumulator_to_boolean);
+    m_assembler.test_al();
+    m_assembler.jump_if(Condition::NotEqual, *m_block_labels.get(&instruction.true_target()->block()).value());
+    jump_to_target(instruction.false_target());
+}
+
+void Compiler::compile_jump_nullish(Bytecode::Op::JumpNullish const& instruction, Bytecode::BasicBlock const& block)
+{
+    if (!instruction.true_target().has_value() || !instruction.false_target().has_value()) {
+        compile_slow_path(instruction, block);
+        return;
+    }
+
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    m_assembler.shift_right64(Reg::RAX, TAG_SHIFT);
+    m_assembler.and64(Reg::RAX, IS_NULLISH_EXTRACT_PATTERN);
+    m_assembler.compare64(Reg::RAX, IS_NULLISH_PATTERN);
+    m_assembler.jump_if(Condition::Equal, *m_block_labels.get(&instruction.true_target()->block()).value());
+    jump_to_target(instruction.false_target());
+}
+
+void Compiler::compile_jump_undefined(Bytecode::Op::JumpUndefined const& instruction, Bytecode::BasicBlock const& block)
+{
+    if (!instruction.true_target().has_value() || !instruction.false_target().has_value()) {
+        compile_slow_path(instruction, block);
+        return;
+    }
+
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    m_assembler.shift_right64(Reg::RAX, TAG_SHIFT);
+    m_assembler.compare64(Reg::RAX, UNDEFINED_TAG);
+    m_assembler.jump_if(Condition::Equal, *m_block_labels.get(&instruction.true_target()->block()).value());
+    jump_to_target(instruction.false_target());
+}
+
+void Compiler::compile_increment_or_decrement(Bytecode::Instruction const& instruction, Bytecode::BasicBlock const& block, i8 delta)
+{
+    Assembler::Label slow_case;
+    Assembler::Label done;
+
+    load_register(Reg::RAX, Bytecode::Register::accumulator());
+    jump_if_not_int32(Reg::RAX, slow_case);
+    m_assembler.add32(Reg::RAX, delta);
+    m_assembler.jump_if(Condition::Overflow, slow_case);
+    m_assembler.mov_imm64(Reg::RCX, SHIFTED_INT32_TAG);
+    m_assembler.or64(Reg::RAX, Reg::RCX);
+    store_register(Bytecode::Register::accumulator(), Reg::RAX);
+    m_assembler.jump(done);
+
+    m_assembler.link(slow_case);
+    compile_slow_path(instruction, block);
+    m_assembler.link(done);
+}
+
+Condition Compiler::int32_comparison_condition(Int32Operation operation)
+{
+    switch (operation) {
+    case Int32Operation::LessThan:
+        return Condition::LessThan;
+    case Int32Operation::LessThanEquals:
+        return Condition::LessThanOrEqual;
+    case Int32Operation::GreaterThan:
+        return Condition::GreaterThan;
+    case Int32Operation::GreaterThanEquals:
+        return Condition::GreaterThanOrEqual;
+    case Int32Operation::StrictlyEquals:
+        return Condition::Equal;
+    case Int32Operation::StrictlyInequals:
+        return Condition::NotEqual;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+void Compiler::compile_int32_binary_operation(Bytecode::Instruction const& instruction, Bytecode::Register lhs, Bytecode::BasicBlock const& block, Int32Operation operation)
+{
+    Assembler::Label slow_case;
+    Assembler::Label done;
+
+    load_register(Reg::RAX, lhs);
+    load_register(Reg::RDX, Bytecode::Register::accumulator());
+    jump_if_not_int32(Reg::RAX, slow_case);
+    jump_if_not_int32(Reg::RDX, slow_case);
+
+    // 32-bit operations clear the upper half of their destination, so only the tag needs to be added.
+    auto box_result = [&](u64 shifted_tag) {
+        m_assembler.mov_imm64(Reg::RCX, shifted_tag);
+        m_assembler.or64(Reg::RAX, Reg::RCX);
+    };
+    auto compare = [&] {
+        m_assembler.compare32(Reg::RAX, Reg::RDX);
+        m_assembler.set_if(int32_comparison_condition(operation), Reg::RAX);
+        box_result(BOOLEAN_TAG << TAG_SHIFT);
+    };
+
+    switch (operation) {
+    case Int32Operation::Add:
+        m_assembler.add32(Reg::RAX, Reg::RDX);
+        m_assembler.jump_if(Condition::Overflow, slow_case);
+        box_result(SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::Sub:
+        m_assembler.sub32(Reg::RAX, Reg::RDX);
+        m_assembler.jump_if(Condition::Overflow, slow_case);
+        box_result(SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::BitwiseAnd:
+        m_assembler.and32(Reg::RAX, Reg::RDX);
+        box_result(SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::BitwiseOr:
+        m_assembler.or32(Reg::RAX, Reg::RDX);
+        box_result(SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::BitwiseXor:
+        m_assembler.xor32(Reg::RAX, Reg::RDX);
+        box_result(SHIFTED_INT32_TAG);
+        break;
+    case Int32Operation::LessThan:
+    case Int32Operation::LessThanEquals:
+    case Int32Operation::GreaterThan:
+    case Int32Operation::GreaterThanEquals:
+    case Int32Operation::StrictlyEquals:
+    case Int32Operation::StrictlyInequals:
+        compare();
+        break;
+    }
+    store_register(Bytecode::Register::accumulator(), Reg::RAX);
+    m_assembler.jump(done);
+
+    m_assembler.link(slow_case);
+    compile_slow_path(instruction, block);
+    m_assembler.link(done);
+}
+
+void Compiler::compile_compare_and_jump(Bytecode::Op::Jump const& instruction, Bytecode::Register lhs, Bytecode::BasicBlock const& block, Int32Operation operation)
+{
+    if (!instruction.true_target().has_value() || !instruction.false_target().has_value()) {
+        compile_slow_path(instruction, block);
+        return;
+    }
+
+    Assembler::Label slow_case;
+
+    load_register(Reg::RAX, lhs);
+    load_register(Reg::RDX, Bytecode::Register::accumulator());
+    jump_if_not_int32(Reg::RAX, slow_case);
+    jump_if_not_int32(Reg::RDX, slow_case);
+
+    // The comparison result stays in the accumulator, like it would have without the jump.
+    m_assembler.compare32(Reg::RAX, Reg::RDX);
+    m_assembler.set_if(int32_comparison_condition(operation), Reg::RAX);
+    m_assembler.mov(Reg::RDX, Reg::RAX);
+    m_assembler.mov_imm64(Reg::RCX, BOOLEAN_TAG << TAG_SHIFT);
+    m_assembler.or64(Reg::RAX, Reg::RCX);
+    store_register(Bytecode::Register::accumulator(), Reg::RAX);
+    m_assembler.test32(Reg::RDX, Reg::RDX);
+    m_assembler.jump_if(Condition::NotEqual, *m_block_labels.get(&instruction.true_target()->block()).value());
+    jump_to_target(instruction.false_target());
+
+    // Anything else makes the interpreter take the jump.
+    m_assembler.link(slow_case);
+    compile_slow_path(instruction, block);
+}
+
+void Compiler::compile_slow_path(Bytecode::Instruction const& instruction, Bytecode::BasicBlock const& block)
+{
+    m_assembler.mov(Reg::RDI, INTERPRETER);
+    m_assembler.mov_imm64(Reg::RSI, bit_cast<FlatPtr>(&instruction));
+    m_assembler.mov(Reg::RDX, EXCEPTION_SLOT);
+
+    switch (instruction.type()) {
+#define __BYTECODE_OP(op)                                        \
+    case Bytecode::Instruction::Type::op:                        \
+        m_assembler.native_call(&cxx_execute<Bytecode::Op::op>); \
+        break;
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+    Assembler::Label continue_with_next_instruction;
+    m_assembler.test_al();
+    m_assembler.jump_if(Condition::NotEqual, continue_with_next_instruction);
+    m_assembler.mov_imm64(Reg::RAX, bit_cast<FlatPtr>(&block));
+    m_assembler.mov_imm64(Reg::RDX, bit_cast<FlatPtr>(&instruction));
+    m_assembler.jump(m_exit_label);
+    m_assembler.link(continue_with_next_instruction);
+}
+
+#else
+
+OwnPtr<NativeExecutable> Compiler::compile(Bytecode::Executable const&)
+{
+    return nullptr;
+}
+
+#endif
+
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
+#include <AK/Platform.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/JIT/Assembler.h>
+#include <LibJS/JIT/NativeExecutable.h>
+
+namespace JS::JIT {
+
+// A baseline JIT compiler, which translates every instruction of a Bytecode::Executable into x86-64
+// machine code on its own. Simple instructions get inline fast paths (for example for int32
+// arithmetic and comparisons, and for jumps between basic blocks); everything else, and every fast
+// path that does not apply, calls the instruction's regular implementation.
+class Compiler {
+public:
+    static OwnPtr<NativeExecutable> compile(Bytecode::Executable const&);
+
+private:
+#if ARCH(X86_64)
+    explicit Compiler(Bytecode::Executable const& executable)
+        : m_executable(executable)
+    {
+    }
+
+    void compile_block(Bytecode::BasicBlock const&);
+    void compile_instruction(Bytecode::Instruction const&, Bytecode::BasicBlock const&);
+
+    void compile_load(Bytecode::Op::Load const&);
+    void compile_load_immediate(Bytecode::Op::LoadImmediate const&);
+    void compile_store(Bytecode::Op::Store const&);
+    void compile_jump(Bytecode::Op::Jump const&, Bytecode::BasicBlock const&);
+    void compile_jump_conditional(Bytecode::Op::JumpConditional const&, Bytecode::BasicBlock const&);
+    void compile_jump_nullish(Bytecode::Op::JumpNullish const&, Bytecode::BasicBlock const&);
+    void compile_jump_undefined(Bytecode::Op::JumpUndefined const&, Bytecode::BasicBlock const&);
+    void compile_increment_or_decrement(Bytecode::Instruction const&, Bytecode::BasicBlock const&, i8 delta);
+
+    enum class Int32Operation {
+        Add,
+        Sub,
+        BitwiseAnd,
+        BitwiseOr,
+        BitwiseXor,
+        LessThan,
+        LessThanEquals,
+        GreaterThan,
+        GreaterThanEquals,
+        StrictlyEquals,
+        StrictlyInequals,
+    };
+    void compile_int32_binary_operation(Bytecode::Instruction const&, Bytecode::Register lhs, Bytecode::BasicBlock const&, Int32Operation);
+    void compile_compare_and_jump(Bytecode::Op::Jump const&, Bytecode::Register lhs, Bytecode::BasicBlock const&, Int32Operation);
+    static Assembler::Condition int32_comparison_condition(Int32Operation);
+
+    void compile_slow_path(Bytecode::Instruction const&, Bytecode::BasicBlock const&);
+
+    void load_register(Assembler::Reg dst, Bytecode::Register);
+    void store_register(Bytecode::Register, Assembler::Reg src);
+    void jump_if_not_int32(Assembler::Reg value, Assembler::Label&);
+    void jump_to_target(Optional<Bytecode::Label> const& target);
+
+    Bytecode::Executable const& m_executable;
+    Vector<u8> m_output;
+    Assembler m_assembler { m_output };
+    HashMap<Bytecode::BasicBlock const*, NonnullOwnPtr<Assembler::Label>> m_block_labels;
+    Assembler::Label m_exit_label;
+#endif
+};
+
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/JIT/NativeExecutable.h>
+#include <LibJS/Runtime/Value.h>
+#include <sys/mman.h>
+
+namespace JS::JIT {
+
+NativeExecutable::NativeExecutable(void* code, size_t size, HashMap<Bytecode::BasicBlock const*, size_t> block_offsets)
+    : m_code(code)
+    , m_size(size)
+    , m_block_offsets(move(block_offsets))
+{
+}
+
+NativeExecutable::~NativeExecutable()
+{
+    if (munmap(m_code, m_size) < 0) {
+        perror("munmap");
+        VERIFY_NOT_REACHED();
+    }
+}
+
+NativeExecutable::Result NativeExecutable::run(Bytecode::Interpreter& interpreter, Bytecode::BasicBlock const& entry_block, Value* registers) const
+{
+    auto entry_point = bit_cast<FlatPtr>(m_code) + m_block_offsets.get(&entry_block).value();
+
+    Optional<Value> exception;
+    auto exit = bit_cast<EntryFunction>(m_code)(interpreter, registers, entry_point, &exception);
+    if (exception.has_value())
+        return { exit, throw_completion(*exception) };
+    return { exit, {} };
+}
+
+}
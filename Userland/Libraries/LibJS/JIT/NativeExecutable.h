@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/Types.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Runtime/Completion.h>
+
+namespace JS::JIT {
+
+// The machine code for a whole Bytecode::Executable. It can be entered at the start of every basic
+// block, and keeps running (jumping between blocks on its own) until an instruction needs the
+// interpreter to unwind, jump, or return.
+class NativeExecutable {
+    AK_MAKE_NONCOPYABLE(NativeExecutable);
+    AK_MAKE_NONMOVABLE(NativeExecutable);
+
+public:
+    // Where native code handed control back to the interpreter. `instruction` is the instruction
+    // which needs the interpreter's attention, or null if the end of `block` was reached.
+    struct Exit {
+        Bytecode::BasicBlock const* block { nullptr };
+        Bytecode::Instruction const* instruction { nullptr };
+    };
+
+    struct Result {
+        Exit exit;
+        ThrowCompletionOr<void> completion;
+    };
+
+    NativeExecutable(void* code, size_t size, HashMap<Bytecode::BasicBlock const*, size_t> block_offsets);
+    ~NativeExecutable();
+
+    Result run(Bytecode::Interpreter&, Bytecode::BasicBlock const& entry_block, Value* registers) const;
+
+private:
+    using EntryFunction = Exit (*)(Bytecode::Interpreter&, Value* registers, FlatPtr entry_point, Optional<Value>* exception);
+
+    void* m_code { nullptr };
+    size_t m_size { 0 };
+    HashMap<Bytecode::BasicBlock const*, size_t> m_block_offsets;
+};
+
+}
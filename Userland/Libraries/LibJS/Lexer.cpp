@@ -22,7 +22,13 @@ HashMap<DeprecatedString, TokenType> Lexer::s_two_char_tokens;
 HashMap<char, TokenType> Lexer::s_single_char_tokens;
 
 Lexer::Lexer(StringView source, StringView filename, size_t line_number, size_t line_column)
-    : m_source(source)
+    : Lexer(DeprecatedString { source }, filename, 0, line_number, line_column)
+{
+}
+
+Lexer::Lexer(DeprecatedString source, StringView filename, size_t offset, size_t line_number, size_t line_column)
+    : m_source(move(source))
+    , m_position(offset)
     , m_current_token(TokenType::Eof, {}, {}, {}, filename, 0, 0, 0)
     , m_filename(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors())
     , m_line_number(line_number)
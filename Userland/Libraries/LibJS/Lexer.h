@@ -19,6 +19,10 @@ class Lexer {
 public:
     explicit Lexer(StringView source, StringView filename = "(unknown)"sv, size_t line_number = 1, size_t line_column = 0);
 
+    // Starts lexing at the given offset into the source (with line_column being the column before that offset),
+    // so that tokens keep their positions within the whole source, e.g. when parsing a part of it again.
+    Lexer(DeprecatedString source, StringView filename, size_t offset, size_t line_number, size_t line_column);
+
     Token next();
 
     DeprecatedString const& source() const { return m_source; };
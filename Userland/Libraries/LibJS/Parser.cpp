@@ -428,6 +428,13 @@ Parser::Parser(Lexer lexer, Program::Type program_type, Optional<EvalInitialStat
     }
 }
 
+Parser::Parser(NonnullRefPtr<SourceCode const> source_code, Lexer lexer, Program::Type program_type)
+    : m_source_code(move(source_code))
+    , m_state(move(lexer), program_type)
+    , m_program_type(program_type)
+{
+}
+
 Associativity Parser::operator_associativity(TokenType type) const
 {
     switch (type) {
@@ -2576,6 +2583,29 @@ NonnullRefPtr<FunctionBody const> Parser::parse_function_body(Vector<FunctionPar
     return function_body;
 }
 
+Result<NonnullRefPtr<FunctionBody const>, Vector<ParserError>> Parser::parse_deferred_function_body(NonnullRefPtr<SourceCode const> source_code, FunctionBody::DeferredParse const& deferred_parse)
+{
+    auto filename = source_code->filename();
+    Lexer lexer { deferred_parse.source, filename, deferred_parse.start.offset, deferred_parse.start.line, deferred_parse.start.column - 1 };
+    Parser parser { move(source_code), move(lexer), deferred_parse.is_module ? Program::Type::Module : Program::Type::Script };
+
+    // NOTE: This is the state that parse_function_node() sets up for the body, on top of what it got from the surrounding code.
+    parser.m_state.strict_mode = deferred_parse.strict_mode;
+    parser.m_state.in_function_context = true;
+    parser.m_state.in_formal_parameter_context = deferred_parse.in_formal_parameter_context;
+    parser.m_state.in_generator_function_context = deferred_parse.kind == FunctionKind::Generator || deferred_parse.kind == FunctionKind::AsyncGenerator;
+    parser.m_state.await_expression_is_valid = deferred_parse.kind == FunctionKind::Async || deferred_parse.kind == FunctionKind::AsyncGenerator;
+    parser.m_state.in_arrow_function_context = deferred_parse.in_arrow_function_context;
+
+    parser.consume(TokenType::CurlyOpen);
+    bool contains_direct_call_to_eval = false;
+    // NOTE: The parameters were already checked against the body when it was parsed the first time around.
+    auto body = parser.parse_function_body({}, deferred_parse.kind, contains_direct_call_to_eval);
+    if (parser.has_errors())
+        return parser.errors();
+    return body;
+}
+
 NonnullRefPtr<BlockStatement const> Parser::parse_block_statement()
 {
     auto rule_start = push_start();
@@ -2661,11 +2691,39 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
         m_state.labels_in_scope = move(old_labels_in_scope);
     });
 
+    // OPTIMIZATION: Most functions in a large script are never called, so we only keep the parse tree of a function's body
+    //               until it has been checked for errors, and parse it again when the function is called for the first time.
+    //               This isn't done for methods and functions in class bodies, as their bodies depend on more of the
+    //               surrounding code, nor for functions that are parsed on their own (which are about to be called).
+    Optional<FunctionBody::DeferredParse> deferred_parse;
+    if (m_state.current_scope_pusher
+        && !m_state.referenced_private_names
+        && !m_state.allow_super_property_lookup
+        && !m_state.allow_super_constructor_call) {
+        deferred_parse = FunctionBody::DeferredParse {
+            .source = m_state.lexer.source(),
+            .start = position(),
+            .kind = function_kind,
+            .is_module = m_program_type == Program::Type::Module,
+            .strict_mode = m_state.strict_mode,
+            .in_formal_parameter_context = m_state.in_formal_parameter_context,
+            .in_arrow_function_context = m_state.in_arrow_function_context,
+        };
+    }
+
     consume(TokenType::CurlyOpen);
     bool contains_direct_call_to_eval = false;
     auto body = parse_function_body(parameters, function_kind, contains_direct_call_to_eval);
     consume(TokenType::CurlyClose);
 
+    if (deferred_parse.has_value()) {
+        auto body_start = deferred_parse->start;
+        auto deferred_body = create_ast_node<FunctionBody>({ m_source_code, body_start, body_start }, deferred_parse.release_value());
+        if (body->in_strict_mode())
+            deferred_body->set_strict_mode();
+        body = move(deferred_body);
+    }
+
     auto has_strict_directive = body->in_strict_mode();
 
     if (has_strict_directive)
@@ -57,6 +57,9 @@ public:
 
     NonnullRefPtr<Program> parse_program(bool starts_in_strict_mode = false);
 
+    // Parses a function body that was only checked for errors when its surrounding code was parsed, see FunctionBody::DeferredParse.
+    static Result<NonnullRefPtr<FunctionBody const>, Vector<ParserError>> parse_deferred_function_body(NonnullRefPtr<SourceCode const>, FunctionBody::DeferredParse const&);
+
     template<typename FunctionNodeType>
     NonnullRefPtr<FunctionNodeType> parse_function_node(u16 parse_options = FunctionNodeParseOptions::CheckForFunctionAndName, Optional<Position> const& function_start = {});
     Vector<FunctionParameter> parse_formal_parameters(int& function_length, u16 parse_options = 0);
@@ -214,6 +217,8 @@ public:
 private:
     friend class ScopePusher;
 
+    Parser(NonnullRefPtr<SourceCode const>, Lexer, Program::Type);
+
     void parse_script(Program& program, bool starts_in_strict_mode);
     void parse_module(Program& program);
 
@@ -156,6 +156,16 @@ ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_des
     return true;
 }
 
+SimpleIndexedPropertyStorage const* packed_array_storage(Object const& object, size_t length)
+{
+    if (!is<Array>(object))
+        return nullptr;
+    auto const* storage = object.indexed_properties().packed_storage();
+    if (!storage || storage->array_like_size() < length)
+        return nullptr;
+    return storage;
+}
+
 // 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
 ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
 {
@@ -163,8 +173,16 @@ ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM& vm, Object co
     auto items = MarkedVector<Value> { vm.heap() };
 
     // 2. Let k be 0.
+    size_t k = 0;
+
+    // OPTIMIZATION: Every element of a packed array is present and can be read without side effects.
+    if (auto const* packed_storage = packed_array_storage(object, length)) {
+        items.append(packed_storage->elements().data(), length);
+        k = length;
+    }
+
     // 3. Repeat, while k < len,
-    for (size_t k = 0; k < length; ++k) {
+    for (; k < length; ++k) {
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -74,6 +74,10 @@ enum class Holes {
     ReadThroughHoles,
 };
 
+// Returns the storage of `object` if it is an array with packed elements at (at least) every index below `length`.
+// Reading those elements with [[Get]] has no side effects and never reaches the prototype chain, so they can be read directly.
+SimpleIndexedPropertyStorage const* packed_array_storage(Object const&, size_t length);
+
 ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes);
 ThrowCompletionOr<double> compare_array_elements(VM&, Value x, Value y, FunctionObject* comparefn);
 
@@ -149,6 +149,57 @@ static ThrowCompletionOr<Object*> array_species_create(VM& vm, Object& original_
     return TRY(construct(vm, constructor.as_function(), Value(length))).ptr();
 }
 
+enum class SearchDirection {
+    Forward,
+    Backward,
+};
+
+// Searches the elements in [start, end) of packed storage for one that is IsStrictlyEqual (or SameValueZero, if NaN should
+// match itself) to the search element. The element kind can rule out every element at once, or let us compare plain numbers.
+static Optional<size_t> search_packed_elements(SimpleIndexedPropertyStorage const& storage, Value search_element, size_t start, size_t end, SearchDirection direction, bool nan_matches_nan)
+{
+    auto const& elements = storage.elements();
+    auto find = [&](auto matches) -> Optional<size_t> {
+        if (direction == SearchDirection::Forward) {
+            for (size_t k = start; k < end; ++k) {
+                if (matches(elements[k]))
+                    return k;
+            }
+        } else {
+            for (size_t k = end; k > start; --k) {
+                if (matches(elements[k - 1]))
+                    return k - 1;
+            }
+        }
+        return {};
+    };
+
+    using ElementKind = SimpleIndexedPropertyStorage::ElementKind;
+    auto element_kind = storage.element_kind();
+
+    if (element_kind == ElementKind::Value) {
+        if (nan_matches_nan)
+            return find([&](Value element) { return same_value_zero(element, search_element); });
+        return find([&](Value element) { return is_strictly_equal(element, search_element); });
+    }
+
+    // Only a number can be equal to a number.
+    if (!search_element.is_number())
+        return {};
+
+    if (search_element.is_nan()) {
+        if (!nan_matches_nan || element_kind == ElementKind::Int32)
+            return {};
+        return find([](Value element) { return element.is_nan(); });
+    }
+
+    // NOTE: Comparing doubles makes 0 and -0 equal, as both IsStrictlyEqual and SameValueZero require.
+    auto number = search_element.as_double();
+    if (element_kind == ElementKind::Int32)
+        return find([number](Value element) { return element.as_i32() == number; });
+    return find([number](Value element) { return element.as_double() == number; });
+}
+
 // 23.1.3.1 Array.prototype.at ( index ), https://tc39.es/ecma262/#sec-array.prototype.at
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::at)
 {
@@ -419,13 +470,17 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::filter)
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
+        // OPTIMIZATION: Every index below the length of a packed array is present, and its element can be read directly.
+        //               The callback may change the array, so this has to be checked again on every iteration.
+        auto const* packed_storage = packed_array_storage(*object, k + 1);
+
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
+        auto k_present = packed_storage || TRY(object->has_property(property_key));
 
         // c. If kPresent is true, then
         if (k_present) {
             // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(k));
+            auto k_value = packed_storage ? packed_storage->elements()[k] : TRY(object->get(k));
 
             // ii. Let selected be ToBoolean(? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »)).
             auto selected = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object)).to_boolean();
@@ -903,6 +958,11 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Search the elements of packed arrays directly.
+    if (auto const* packed_storage = packed_array_storage(*this_object, length))
+        return Value(search_packed_elements(*packed_storage, value_to_find, from_index, length, SearchDirection::Forward, true).has_value());
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -956,6 +1016,14 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    // OPTIMIZATION: Search the elements of packed arrays directly.
+    if (auto const* packed_storage = packed_array_storage(*object, length)) {
+        if (k >= length)
+            return Value(-1);
+        auto index = search_packed_elements(*packed_storage, search_element, k, length, SearchDirection::Forward, false);
+        return index.has_value() ? Value(*index) : Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -1067,6 +1135,14 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    // OPTIMIZATION: Search the elements of packed arrays directly.
+    if (auto const* packed_storage = packed_array_storage(*object, length)) {
+        if (k < 0)
+            return Value(-1);
+        auto index = search_packed_elements(*packed_storage, search_element, 0, k + 1, SearchDirection::Backward, false);
+        return index.has_value() ? Value(*index) : Value(-1);
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
@@ -1119,13 +1195,17 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
+        // OPTIMIZATION: Every index below the length of a packed array is present, and its element can be read directly.
+        //               The callback may change the array, so this has to be checked again on every iteration.
+        auto const* packed_storage = packed_array_storage(*object, k + 1);
+
         // b. Let kPresent be ? HasProperty(O, Pk).
-        auto k_present = TRY(object->has_property(property_key));
+        auto k_present = packed_storage || TRY(object->has_property(property_key));
 
         // c. If kPresent is true, then
         if (k_present) {
             // i. Let kValue be ? Get(O, Pk).
-            auto k_value = TRY(object->get(property_key));
+            auto k_value = packed_storage ? packed_storage->elements()[k] : TRY(object->get(property_key));
 
             // ii. Let mappedValue be ? Call(callbackfn, thisArg, « kValue, 𝔽(k), O »).
             auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, k_value, Value(k), object));
@@ -830,6 +830,14 @@ Completion ECMAScriptFunctionObject::ordinary_call_evaluate_body()
     if (m_kind == FunctionKind::AsyncGenerator)
         return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "Async Generator function execution");
 
+    // NOTE: The parser may have only checked the body for errors, in which case we have to parse it for real on the first call.
+    if (is<FunctionBody>(*m_ecmascript_code)) {
+        auto parsed_body = static_cast<FunctionBody const&>(*m_ecmascript_code).parsed_body();
+        if (parsed_body.is_error())
+            return vm.throw_completion<SyntaxError>(TRY_OR_THROW_OOM(vm, parsed_body.error().to_string()));
+        m_ecmascript_code = parsed_body.release_value();
+    }
+
     auto* bytecode_interpreter = vm.bytecode_interpreter_if_exists();
 
     // The bytecode interpreter can execute generator functions while the AST interpreter cannot.
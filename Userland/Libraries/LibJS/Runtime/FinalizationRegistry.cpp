@@ -45,6 +45,15 @@ bool FinalizationRegistry::remove_by_token(Cell& unregister_token)
     return removed;
 }
 
+void FinalizationRegistry::finalize()
+{
+    Base::finalize();
+
+    // NOTE: We are not destroyed until our block gets swept, so stop looking for dead targets right away,
+    //       as enqueueing a cleanup job would revive us.
+    deregister();
+}
+
 void FinalizationRegistry::remove_dead_cells(Badge<Heap>)
 {
     auto any_cells_were_removed = false;
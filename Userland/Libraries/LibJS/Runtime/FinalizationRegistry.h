@@ -40,6 +40,7 @@ public:
 private:
     FinalizationRegistry(Realm&, JobCallback, Object& prototype);
 
+    virtual void finalize() override;
     virtual void visit_edges(Visitor& visitor) override;
 
     NonnullGCPtr<Realm> m_realm;
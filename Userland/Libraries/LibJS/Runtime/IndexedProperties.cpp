@@ -13,10 +13,30 @@ namespace JS {
 constexpr const size_t SPARSE_ARRAY_HOLE_THRESHOLD = 200;
 constexpr const size_t LENGTH_SETTER_GENERIC_STORAGE_THRESHOLD = 4 * MiB;
 
+static SimpleIndexedPropertyStorage::ElementKind element_kind_of(Value value)
+{
+    if (value.is_int32())
+        return SimpleIndexedPropertyStorage::ElementKind::Int32;
+    if (value.is_number())
+        return SimpleIndexedPropertyStorage::ElementKind::Double;
+    return SimpleIndexedPropertyStorage::ElementKind::Value;
+}
+
 SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initial_values)
     : m_array_size(initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements) {
+        if (value.is_empty())
+            ++m_hole_count;
+        else
+            note_element_added(value);
+    }
+}
+
+void SimpleIndexedPropertyStorage::note_element_added(Value value)
+{
+    m_element_kind = max(m_element_kind, element_kind_of(value));
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -49,22 +69,38 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     VERIFY(attributes == default_attributes);
 
     if (index >= m_array_size) {
+        // Every index we grow by starts out as a hole, including the one we're about to fill.
+        m_hole_count += index + 1 - m_array_size;
         m_array_size = index + 1;
         grow_storage_if_needed();
     }
-    m_packed_elements[index] = value;
+
+    auto& element = m_packed_elements[index];
+    if (element.is_empty() && !value.is_empty())
+        --m_hole_count;
+    else if (!element.is_empty() && value.is_empty())
+        ++m_hole_count;
+    element = value;
+
+    if (!value.is_empty())
+        note_element_added(value);
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
 {
     VERIFY(index < m_array_size);
+    if (!m_packed_elements[index].is_empty())
+        ++m_hole_count;
     m_packed_elements[index] = {};
 }
 
 ValueAndAttributes SimpleIndexedPropertyStorage::take_first()
 {
     m_array_size--;
-    return { m_packed_elements.take_first(), default_attributes };
+    auto first_element = m_packed_elements.take_first();
+    if (first_element.is_empty())
+        --m_hole_count;
+    return { first_element, default_attributes };
 }
 
 ValueAndAttributes SimpleIndexedPropertyStorage::take_last()
@@ -72,11 +108,26 @@ ValueAndAttributes SimpleIndexedPropertyStorage::take_last()
     m_array_size--;
     auto last_element = m_packed_elements[m_array_size];
     m_packed_elements[m_array_size] = {};
+    if (last_element.is_empty())
+        --m_hole_count;
     return { last_element, default_attributes };
 }
 
 bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
 {
+    if (new_size > m_array_size) {
+        m_hole_count += new_size - m_array_size;
+    } else {
+        for (size_t i = new_size; i < m_array_size; ++i) {
+            if (m_packed_elements[i].is_empty())
+                --m_hole_count;
+        }
+    }
+
+    // Nothing is left that could have made the element kind more general.
+    if (new_size == 0)
+        m_element_kind = ElementKind::Int32;
+
     m_array_size = new_size;
     m_packed_elements.resize_and_keep_capacity(new_size);
     return true;
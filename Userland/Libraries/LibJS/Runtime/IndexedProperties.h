@@ -15,6 +15,7 @@ namespace JS {
 struct ValueAndAttributes {
     Value value;
     PropertyAttributes attributes { default_attributes };
+    Optional<u32> property_offset {};
 };
 
 class IndexedProperties;
@@ -42,6 +43,14 @@ public:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // The most specific kind of value that every element is known to be. This only ever gets more general,
+    // so it may describe elements that have since been removed.
+    enum class ElementKind : u8 {
+        Int32,
+        Double, // Any number, including int32 ones.
+        Value,
+    };
+
     SimpleIndexedPropertyStorage() = default;
     explicit SimpleIndexedPropertyStorage(Vector<Value>&& initial_values);
 
@@ -60,12 +69,20 @@ public:
     virtual bool is_simple_storage() const override { return true; }
     Vector<Value> const& elements() const { return m_packed_elements; }
 
+    ElementKind element_kind() const { return m_element_kind; }
+
+    // Whether there is an element at every index below the array-like size.
+    bool is_packed() const { return m_hole_count == 0; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
+    void note_element_added(Value);
 
     size_t m_array_size { 0 };
+    size_t m_hole_count { 0 };
+    ElementKind m_element_kind { ElementKind::Int32 };
     Vector<Value> m_packed_elements;
 };
 
@@ -138,6 +155,16 @@ public:
 
     size_t real_size() const;
 
+    // Returns the storage if it holds every element below the array-like size, all with default attributes.
+    // The pointer is only valid until the next modification of the indexed properties.
+    SimpleIndexedPropertyStorage const* packed_storage() const
+    {
+        if (!m_storage || !m_storage->is_simple_storage())
+            return nullptr;
+        auto const& storage = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage);
+        return storage.is_packed() ? &storage : nullptr;
+    }
+
     Vector<u32> indices() const;
 
     template<typename Callback>
@@ -764,7 +764,7 @@ ThrowCompletionOr<Optional<PropertyDescriptor>> Object::internal_get_own_propert
     PropertyDescriptor descriptor;
 
     // 3. Let X be O's own property whose key is P.
-    auto [value, attributes] = *maybe_storage_entry;
+    auto [value, attributes, property_offset] = *maybe_storage_entry;
 
     // 4. If X is a data property, then
     if (!value.is_accessor()) {
@@ -791,6 +791,9 @@ ThrowCompletionOr<Optional<PropertyDescriptor>> Object::internal_get_own_propert
     // 7. Set D.[[Configurable]] to the value of X's [[Configurable]] attribute.
     descriptor.configurable = attributes.is_configurable();
 
+    // Non-standard: Remember where the property is stored, so that it can be cached.
+    descriptor.property_offset = property_offset;
+
     // 8. Return D.
     return descriptor;
 }
@@ -836,7 +839,7 @@ ThrowCompletionOr<bool> Object::internal_has_property(PropertyKey const& propert
 }
 
 // 10.1.8 [[Get]] ( P, Receiver ), https://tc39.es/ecma262/#sec-ordinary-object-internal-methods-and-internal-slots-get-p-receiver
-ThrowCompletionOr<Value> Object::internal_get(PropertyKey const& property_key, Value receiver) const
+ThrowCompletionOr<Value> Object::internal_get(PropertyKey const& property_key, Value receiver, CacheablePropertyMetadata* cacheable_metadata) const
 {
     VERIFY(!receiver.is_empty());
     VERIFY(property_key.is_valid());
@@ -856,12 +859,26 @@ ThrowCompletionOr<Value> Object::internal_get(PropertyKey const& property_key, V
             return js_undefined();
 
         // c. Return ? parent.[[Get]](P, Receiver).
-        return parent->internal_get(property_key, receiver);
+        auto value = TRY(parent->internal_get(property_key, receiver, cacheable_metadata));
+
+        // Non-standard: Only properties of the immediate prototype are cached, since their
+        // validity only depends on the shapes of this object and of its prototype.
+        if (cacheable_metadata) {
+            if (cacheable_metadata->type == CacheablePropertyMetadata::Type::OwnProperty)
+                *cacheable_metadata = { .type = CacheablePropertyMetadata::Type::InPrototypeChain, .property_offset = cacheable_metadata->property_offset, .prototype = parent };
+            else
+                *cacheable_metadata = {};
+        }
+
+        return value;
     }
 
     // 3. If IsDataDescriptor(desc) is true, return desc.[[Value]].
-    if (descriptor->is_data_descriptor())
+    if (descriptor->is_data_descriptor()) {
+        if (cacheable_metadata && descriptor->property_offset.has_value())
+            *cacheable_metadata = { .type = CacheablePropertyMetadata::Type::OwnProperty, .property_offset = descriptor->property_offset, .prototype = nullptr };
         return *descriptor->value;
+    }
 
     // 4. Assert: IsAccessorDescriptor(desc) is true.
     VERIFY(descriptor->is_accessor_descriptor());
@@ -878,7 +895,7 @@ ThrowCompletionOr<Value> Object::internal_get(PropertyKey const& property_key, V
 }
 
 // 10.1.9 [[Set]] ( P, V, Receiver ), https://tc39.es/ecma262/#sec-ordinary-object-internal-methods-and-internal-slots-set-p-v-receiver
-ThrowCompletionOr<bool> Object::internal_set(PropertyKey const& property_key, Value value, Value receiver)
+ThrowCompletionOr<bool> Object::internal_set(PropertyKey const& property_key, Value value, Value receiver, CacheablePropertyMetadata* cacheable_metadata)
 {
     VERIFY(property_key.is_valid());
     VERIFY(!value.is_empty());
@@ -887,6 +904,13 @@ ThrowCompletionOr<bool> Object::internal_set(PropertyKey const& property_key, Va
     // 2. Let ownDesc be ? O.[[GetOwnProperty]](P).
     auto own_descriptor = TRY(internal_get_own_property(property_key));
 
+    // Non-standard: Writes to a writable data property of the receiver itself only replace
+    // the value in its storage, so they can be cached.
+    if (cacheable_metadata && own_descriptor.has_value() && own_descriptor->property_offset.has_value() && own_descriptor->is_data_descriptor() && *own_descriptor->writable
+        && receiver.is_object() && &receiver.as_object() == this) {
+        *cacheable_metadata = { .type = CacheablePropertyMetadata::Type::OwnProperty, .property_offset = own_descriptor->property_offset, .prototype = nullptr };
+    }
+
     // 3. Return ? OrdinarySetWithOwnDescriptor(O, P, V, Receiver, ownDesc).
     return ordinary_set_with_own_descriptor(property_key, value, receiver, own_descriptor);
 }
@@ -1075,6 +1099,7 @@ Optional<ValueAndAttributes> Object::storage_get(PropertyKey const& property_key
 
     Value value;
     PropertyAttributes attributes;
+    Optional<u32> property_offset;
 
     if (property_key.is_number()) {
         auto value_and_attributes = m_indexed_properties.get(property_key.as_number());
@@ -1094,9 +1119,10 @@ Optional<ValueAndAttributes> Object::storage_get(PropertyKey const& property_key
 
         value = m_storage[metadata->offset];
         attributes = metadata->attributes;
+        property_offset = metadata->offset;
     }
 
-    return ValueAndAttributes { .value = value, .attributes = attributes };
+    return ValueAndAttributes { .value = value, .attributes = attributes, .property_offset = property_offset };
 }
 
 bool Object::storage_has(PropertyKey const& property_key) const
@@ -1111,7 +1137,8 @@ void Object::storage_set(PropertyKey const& property_key, ValueAndAttributes con
 {
     VERIFY(property_key.is_valid());
 
-    auto [value, attributes] = value_and_attributes;
+    auto value = value_and_attributes.value;
+    auto attributes = value_and_attributes.attributes;
 
     if (property_key.is_number()) {
         auto index = property_key.as_number();
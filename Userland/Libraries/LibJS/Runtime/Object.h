@@ -39,6 +39,20 @@ struct PrivateElement {
     Handle<Value> value;
 };
 
+// Describes where [[Get]] or [[Set]] found a property, for the inline caches of the bytecode
+// interpreter. Only data properties in the shape-based storage of ordinary objects are
+// cacheable, either on the object itself or on its immediate prototype.
+struct CacheablePropertyMetadata {
+    enum class Type {
+        NotCacheable,
+        OwnProperty,
+        InPrototypeChain,
+    };
+    Type type { Type::NotCacheable };
+    Optional<u32> property_offset;
+    GCPtr<Object const> prototype;
+};
+
 class Object : public Cell {
     JS_CELL(Object, Cell);
 
@@ -118,8 +132,8 @@ public:
     virtual ThrowCompletionOr<Optional<PropertyDescriptor>> internal_get_own_property(PropertyKey const&) const;
     virtual ThrowCompletionOr<bool> internal_define_own_property(PropertyKey const&, PropertyDescriptor const&);
     virtual ThrowCompletionOr<bool> internal_has_property(PropertyKey const&) const;
-    virtual ThrowCompletionOr<Value> internal_get(PropertyKey const&, Value receiver) const;
-    virtual ThrowCompletionOr<bool> internal_set(PropertyKey const&, Value value, Value receiver);
+    virtual ThrowCompletionOr<Value> internal_get(PropertyKey const&, Value receiver, CacheablePropertyMetadata* = nullptr) const;
+    virtual ThrowCompletionOr<bool> internal_set(PropertyKey const&, Value value, Value receiver, CacheablePropertyMetadata* = nullptr);
     virtual ThrowCompletionOr<bool> internal_delete(PropertyKey const&);
     virtual ThrowCompletionOr<MarkedVector<Value>> internal_own_property_keys() const;
 
@@ -171,9 +185,15 @@ public:
     bool has_parameter_map() const { return m_has_parameter_map; }
     void set_has_parameter_map() { m_has_parameter_map = true; }
 
+    // The property lookup caches of the bytecode interpreter access the storage of any object with a cached shape directly.
+    // Exotic objects can have the same shape as ordinary objects, so the caches must not be used for objects that find
+    // or store their named properties in any other way.
+    bool may_interfere_with_property_lookup_caches() const { return m_may_interfere_with_property_lookup_caches; }
+
     virtual void visit_edges(Cell::Visitor&) override;
 
     Value get_direct(size_t index) const { return m_storage[index]; }
+    void put_direct(size_t index, Value value) { m_storage[index] = value; }
 
     IndexedProperties const& indexed_properties() const { return m_indexed_properties; }
     IndexedProperties& indexed_properties() { return m_indexed_properties; }
@@ -206,6 +226,9 @@ protected:
     // [[ParameterMap]]
     bool m_has_parameter_map { false };
 
+    // Objects which override how named properties are got or set have to set this in their constructor.
+    bool m_may_interfere_with_property_lookup_caches { false };
+
 private:
     void set_shape(Shape& shape) { m_shape = &shape; }
 
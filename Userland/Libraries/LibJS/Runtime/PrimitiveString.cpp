@@ -43,10 +43,30 @@ PrimitiveString::PrimitiveString(Utf16String string)
 
 PrimitiveString::~PrimitiveString()
 {
-    if (has_utf8_string())
-        vm().string_cache().remove(*m_utf8_string);
-    if (has_deprecated_string())
-        vm().deprecated_string_cache().remove(*m_deprecated_string);
+    remove_from_string_caches();
+}
+
+void PrimitiveString::finalize()
+{
+    Base::finalize();
+
+    // NOTE: Make sure we can't be handed out by the string caches while we're waiting to be swept.
+    remove_from_string_caches();
+}
+
+void PrimitiveString::remove_from_string_caches()
+{
+    // NOTE: The caches may map our string to another cell, e.g. one created for it after we started dying.
+    if (has_utf8_string()) {
+        auto& string_cache = vm().string_cache();
+        if (auto it = string_cache.find(*m_utf8_string); it != string_cache.end() && it->value == this)
+            string_cache.remove(it);
+    }
+    if (has_deprecated_string()) {
+        auto& string_cache = vm().deprecated_string_cache();
+        if (auto it = string_cache.find(*m_deprecated_string); it != string_cache.end() && it->value == this)
+            string_cache.remove(it);
+    }
 }
 
 void PrimitiveString::visit_edges(Cell::Visitor& visitor)
@@ -58,6 +58,9 @@ private:
     explicit PrimitiveString(Utf16String);
 
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    void remove_from_string_caches();
 
     ThrowCompletionOr<void> resolve_rope_if_needed() const;
 
@@ -40,6 +40,10 @@ public:
     Optional<bool> writable {};
     Optional<bool> enumerable {};
     Optional<bool> configurable {};
+
+    // Where the property is kept in the storage of its object, if it was read from there.
+    // Not part of the specification; used to fill the inline caches of the bytecode interpreter.
+    Optional<u32> property_offset {};
 };
 
 }
@@ -112,6 +112,14 @@ Shape::Shape(Shape& previous_shape, Object* new_prototype)
 {
 }
 
+void Shape::finalize()
+{
+    Base::finalize();
+
+    // NOTE: Make sure we can't be handed out as a cached transition while we're waiting to be swept.
+    revoke_weak_ptrs();
+}
+
 void Shape::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -197,6 +205,7 @@ void Shape::add_property_to_unique_shape(StringOrSymbol const& property_key, Pro
 
     VERIFY(m_property_count < NumericLimits<u32>::max());
     ++m_property_count;
+    ++m_unique_shape_serial_number;
 }
 
 void Shape::reconfigure_property_in_unique_shape(StringOrSymbol const& property_key, PropertyAttributes attributes)
@@ -207,6 +216,7 @@ void Shape::reconfigure_property_in_unique_shape(StringOrSymbol const& property_
     VERIFY(it != m_property_table->end());
     it->value.attributes = attributes;
     m_property_table->set(property_key, it->value);
+    ++m_unique_shape_serial_number;
 }
 
 void Shape::remove_property_from_unique_shape(StringOrSymbol const& property_key, size_t offset)
@@ -220,6 +230,7 @@ void Shape::remove_property_from_unique_shape(StringOrSymbol const& property_key
         if (it.value.offset > offset)
             --it.value.offset;
     }
+    ++m_unique_shape_serial_number;
 }
 
 void Shape::add_property_without_transition(StringOrSymbol const& property_key, PropertyAttributes attributes)
@@ -230,6 +241,7 @@ void Shape::add_property_without_transition(StringOrSymbol const& property_key,
         VERIFY(m_property_count < NumericLimits<u32>::max());
         ++m_property_count;
     }
+    ++m_unique_shape_serial_number;
 }
 
 FLATTEN void Shape::add_property_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
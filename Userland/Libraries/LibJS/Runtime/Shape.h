@@ -75,7 +75,16 @@ public:
 
     Vector<Property> property_table_ordered() const;
 
-    void set_prototype_without_transition(Object* new_prototype) { m_prototype = new_prototype; }
+    void set_prototype_without_transition(Object* new_prototype)
+    {
+        m_prototype = new_prototype;
+        ++m_unique_shape_serial_number;
+    }
+
+    // Unique shapes are changed in place instead of transitioning to a new shape. This number
+    // changes whenever that happens, so that caches can tell whether the shape they remember
+    // still has the same layout.
+    u32 unique_shape_serial_number() const { return m_unique_shape_serial_number; }
 
     void remove_property_from_unique_shape(StringOrSymbol const&, size_t offset);
     void add_property_to_unique_shape(StringOrSymbol const&, PropertyAttributes attributes);
@@ -86,6 +95,7 @@ private:
     Shape(Shape& previous_shape, StringOrSymbol const& property_key, PropertyAttributes attributes, TransitionType);
     Shape(Shape& previous_shape, Object* new_prototype);
 
+    virtual void finalize() override;
     virtual void visit_edges(Visitor&) override;
 
     Shape* get_or_prune_cached_forward_transition(TransitionKey const&);
@@ -103,6 +113,7 @@ private:
     StringOrSymbol m_property_key;
     GCPtr<Object> m_prototype;
     u32 m_property_count { 0 };
+    u32 m_unique_shape_serial_number { 0 };
 
     PropertyAttributes m_attributes { 0 };
     TransitionType m_transition_type : 6 { TransitionType::Invalid };
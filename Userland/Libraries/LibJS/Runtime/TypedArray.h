@@ -65,6 +65,7 @@ protected:
         : Object(ConstructWithPrototypeTag::Tag, prototype)
         , m_intrinsic_constructor(intrinsic_constructor)
     {
+        m_may_interfere_with_property_lookup_caches = true;
     }
 
     u32 m_array_length { 0 };
@@ -288,7 +289,7 @@ public:
     }
 
     // 10.4.5.4 [[Get]] ( P, Receiver ), 10.4.5.4 [[Get]] ( P, Receiver )
-    virtual ThrowCompletionOr<Value> internal_get(PropertyKey const& property_key, Value receiver) const override
+    virtual ThrowCompletionOr<Value> internal_get(PropertyKey const& property_key, Value receiver, CacheablePropertyMetadata* = nullptr) const override
     {
         VERIFY(!receiver.is_empty());
 
@@ -314,7 +315,7 @@ public:
     }
 
     // 10.4.5.5 [[Set]] ( P, V, Receiver ), https://tc39.es/ecma262/#sec-integer-indexed-exotic-objects-set-p-v-receiver
-    virtual ThrowCompletionOr<bool> internal_set(PropertyKey const& property_key, Value value, Value receiver) override
+    virtual ThrowCompletionOr<bool> internal_set(PropertyKey const& property_key, Value value, Value receiver, CacheablePropertyMetadata* = nullptr) override
     {
         VERIFY(!value.is_empty());
         VERIFY(!receiver.is_empty());
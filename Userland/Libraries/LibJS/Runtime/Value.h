@@ -134,6 +134,7 @@ public:
     bool is_undefined() const { return m_value.tag == UNDEFINED_TAG; }
     bool is_null() const { return m_value.tag == NULL_TAG; }
     bool is_number() const { return is_double() || is_int32(); }
+    bool is_int32() const { return m_value.tag == INT32_TAG; }
     bool is_string() const { return m_value.tag == STRING_TAG; }
     bool is_object() const { return m_value.tag == OBJECT_TAG; }
     bool is_boolean() const { return m_value.tag == BOOLEAN_TAG; }
@@ -294,6 +295,12 @@ public:
         return m_value.as_double;
     }
 
+    i32 as_i32() const
+    {
+        VERIFY(is_int32());
+        return static_cast<i32>(m_value.encoded & 0xFFFFFFFF);
+    }
+
     bool as_bool() const
     {
         VERIFY(is_boolean());
@@ -462,13 +469,6 @@ private:
     // A double is any Value which does not have the full exponent and top mantissa bit set or has
     // exactly only those bits set.
     bool is_double() const { return (m_value.encoded & CANON_NAN_BITS) != CANON_NAN_BITS || (m_value.encoded == CANON_NAN_BITS); }
-    bool is_int32() const { return m_value.tag == INT32_TAG; }
-
-    i32 as_i32() const
-    {
-        VERIFY(is_int32());
-        return static_cast<i32>(m_value.encoded & 0xFFFFFFFF);
-    }
 
     template<typename PointerType>
     PointerType* extract_pointer() const
@@ -5,6 +5,7 @@
  */
 
 #include <LibJS/AST.h>
+#include <LibJS/Bytecode/CodeCache.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
 #include <LibJS/Runtime/VM.h>
@@ -15,6 +16,14 @@ namespace JS {
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    auto& code_cache = Bytecode::CodeCache::the();
+
+    // OPTIMIZATION: Reuse the parse tree from an earlier parse of the same script, if there is one.
+    if (code_cache.is_enabled()) {
+        if (auto script = code_cache.find_program(source_text, filename, line_number_offset))
+            return realm.heap().allocate_without_realm<Script>(realm, filename, script.release_nonnull(), host_defined);
+    }
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -23,6 +32,9 @@ Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView sourc
     if (parser.has_errors())
         return parser.errors();
 
+    if (code_cache.is_enabled())
+        code_cache.add_program(script, line_number_offset);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate_without_realm<Script>(realm, filename, move(script), host_defined);
 }
@@ -0,0 +1,163 @@
+describe("searching packed arrays", () => {
+    test("int32 elements", () => {
+        const a = [1, 2, 3, 2, 1];
+        expect(a.indexOf(2)).toBe(1);
+        expect(a.lastIndexOf(2)).toBe(3);
+        expect(a.includes(3)).toBeTrue();
+        expect(a.indexOf(2.5)).toBe(-1);
+        expect(a.indexOf("2")).toBe(-1);
+        expect(a.includes(NaN)).toBeFalse();
+        expect(a.indexOf(1, 1)).toBe(4);
+        expect(a.lastIndexOf(1, -2)).toBe(0);
+        expect(a.indexOf(1, 10)).toBe(-1);
+        expect(a.lastIndexOf(1, -10)).toBe(-1);
+    });
+
+    test("zero and negative zero", () => {
+        expect([1, 0].indexOf(-0)).toBe(1);
+        expect([1, -0].indexOf(0)).toBe(1);
+        expect([1, 0].includes(-0)).toBeTrue();
+        expect([1, 0].lastIndexOf(-0)).toBe(1);
+    });
+
+    test("double elements", () => {
+        const a = [1, 2.5, NaN, 4];
+        expect(a.indexOf(2.5)).toBe(1);
+        expect(a.indexOf(4)).toBe(3);
+        expect(a.indexOf(NaN)).toBe(-1);
+        expect(a.lastIndexOf(NaN)).toBe(-1);
+        expect(a.includes(NaN)).toBeTrue();
+        expect(a.includes("4")).toBeFalse();
+    });
+
+    test("mixed elements", () => {
+        const o = {};
+        const a = [1, "foo", o, NaN, undefined, 2.5];
+        expect(a.indexOf("foo")).toBe(1);
+        expect(a.indexOf(o)).toBe(2);
+        expect(a.indexOf({})).toBe(-1);
+        expect(a.indexOf(NaN)).toBe(-1);
+        expect(a.includes(NaN)).toBeTrue();
+        expect(a.indexOf(undefined)).toBe(4);
+        expect(a.lastIndexOf(1)).toBe(0);
+        expect(a.includes(2.5)).toBeTrue();
+    });
+
+    test("element kinds become more general", () => {
+        const a = [1, 2, 3];
+        expect(a.indexOf(1.5)).toBe(-1);
+        a.push(1.5);
+        expect(a.indexOf(1.5)).toBe(3);
+        a[0] = "foo";
+        expect(a.indexOf("foo")).toBe(0);
+        a.length = 0;
+        a.push(4);
+        expect(a.indexOf(4)).toBe(0);
+    });
+});
+
+describe("holes", () => {
+    const withPrototypeElement = callback => {
+        Array.prototype[1] = "proto";
+        try {
+            callback();
+        } finally {
+            delete Array.prototype[1];
+        }
+    };
+
+    test("holes are looked up on the prototype", () => {
+        const a = [0, , 2];
+        withPrototypeElement(() => {
+            expect(a.indexOf("proto")).toBe(1);
+            expect(a.includes("proto")).toBeTrue();
+            expect(a.lastIndexOf("proto")).toBe(1);
+            expect(a.map(x => x)).toEqual([0, "proto", 2]);
+            expect(a.filter(x => typeof x === "string")).toEqual(["proto"]);
+        });
+    });
+
+    test("filling holes makes the array packed again", () => {
+        const a = [0, , 2];
+        a[1] = 1;
+        expect(a.indexOf(1)).toBe(1);
+        withPrototypeElement(() => {
+            expect(a.indexOf("proto")).toBe(-1);
+        });
+    });
+
+    test("deleting an element makes a hole", () => {
+        const a = [0, 1, 2];
+        delete a[1];
+        expect(a.includes(1)).toBeFalse();
+        withPrototypeElement(() => {
+            expect(a.indexOf("proto")).toBe(1);
+        });
+    });
+
+    test("growing the length makes holes", () => {
+        const a = [0];
+        a.length = 3;
+        expect(a.includes(undefined)).toBeTrue();
+        expect(a.indexOf(undefined)).toBe(-1);
+        a[2] = 2;
+        expect(a.indexOf(undefined)).toBe(-1);
+        withPrototypeElement(() => {
+            expect(a.indexOf("proto")).toBe(1);
+        });
+    });
+});
+
+describe("arrays changing while being used", () => {
+    test("fromIndex shrinking the array", () => {
+        let a = [1, 2, 3];
+        const shrink = {
+            valueOf() {
+                a.length = 1;
+                return 0;
+            },
+        };
+        expect(a.indexOf(3, shrink)).toBe(-1);
+
+        a = [1, 2, 3];
+        expect(a.includes(undefined, shrink)).toBeTrue();
+    });
+
+    test("map callback changing the array", () => {
+        const a = [1, 2, 3, 4];
+        const result = a.map((x, i) => {
+            if (i === 0) a.pop();
+            if (i === 1) a[2] = "changed";
+            return x;
+        });
+        expect(result).toHaveLength(4);
+        expect(result[0]).toBe(1);
+        expect(result[1]).toBe(2);
+        expect(result[2]).toBe("changed");
+        expect(3 in result).toBeFalse();
+    });
+
+    test("filter callback changing the array", () => {
+        const a = [1, 2, 3, 4];
+        const result = a.filter((x, i) => {
+            if (i === 0) delete a[1];
+            if (i === 2) a.push(5);
+            return true;
+        });
+        expect(result).toEqual([1, 3, 4]);
+    });
+});
+
+test("sorting packed and holey arrays", () => {
+    expect([3, 1, 2].sort()).toEqual([1, 2, 3]);
+    expect([3, 1.5, "a", 2].sort()).toEqual([1.5, 2, 3, "a"]);
+    expect([3, 10, 2].sort((a, b) => a - b)).toEqual([2, 3, 10]);
+
+    const holey = [3, , 1];
+    holey.sort();
+    expect(holey).toHaveLength(3);
+    expect(holey[0]).toBe(1);
+    expect(holey[1]).toBe(3);
+    expect(1 in holey).toBeTrue();
+    expect(2 in holey).toBeFalse();
+});
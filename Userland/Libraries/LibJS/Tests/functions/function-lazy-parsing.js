@@ -0,0 +1,77 @@
+test("syntax errors in function bodies are reported without calling the function", () => {
+    expect("function f() { return 1 +; }").not.toEval();
+    expect("function f() { function g() { let a; let a; } }").not.toEval();
+    expect("async function f() { function g() { await 1; } }").not.toEval();
+    expect("function* f() { function g() { yield 1; } }").not.toEval();
+    expect("function f() { 'use strict'; with ({}) {} }").not.toEval();
+    expect('"use strict"; function f() { var x = 010; }').not.toEval();
+});
+
+test("early errors that depend on the surrounding code are reported without calling the function", () => {
+    expect("function f(a) { let a; }").not.toEval();
+    expect("function f() { function g(a, b) { 'use strict'; } function h(a, a) { 'use strict'; } }").not.toEval();
+    expect("function f() { x: x: ; }").not.toEval();
+    expect("function f() { x: { function g() { break x; } } }").not.toEval();
+    expect("function f() { class A { m() { return function () { return this.#x; }; } } }").not.toEval();
+    expect("async function f() { function g(a = await 1) {} }").not.toEval();
+});
+
+test("function bodies behave the same when parsed on first call", () => {
+    function outer(a, b) {
+        var sum = a + b;
+        function inner(c) {
+            return sum * c;
+        }
+        {
+            function hoistedFromBlock() {
+                return "hoisted";
+            }
+        }
+        return [inner(2), hoistedFromBlock(), arguments.length];
+    }
+    expect(outer(1, 2)).toEqual([6, "hoisted", 2]);
+    expect(outer(3, 4)).toEqual([14, "hoisted", 2]);
+});
+
+test("strict mode of function bodies is known before they are called", () => {
+    function strict() {
+        "use strict";
+        return this;
+    }
+    function sloppy() {
+        return this;
+    }
+    expect(strict()).toBeUndefined();
+    expect(sloppy()).toBe(globalThis);
+});
+
+test("generator and async function bodies", () => {
+    function* generator() {
+        yield 1;
+        yield 2;
+    }
+    expect([...generator()]).toEqual([1, 2]);
+
+    let result;
+    async function asyncFunction() {
+        result = await 42;
+    }
+    asyncFunction();
+    runQueuedPromiseJobs();
+    expect(result).toBe(42);
+});
+
+test("function bodies inside template literals", () => {
+    const value = `${(function () {
+        return { a: `${"inner"}` }.a;
+    })()}`;
+    expect(value).toBe("inner");
+});
+
+test("source text and errors of lazily parsed functions", () => {
+    function thrower() {
+        throw new Error("from thrower");
+    }
+    expect(thrower).toThrowWithMessage(Error, "from thrower");
+    expect(thrower.toString()).toBe('function thrower() {\n        throw new Error("from thrower");\n    }');
+});
@@ -0,0 +1,66 @@
+// Dead cells are only destroyed once their heap block gets swept, some time after the collection that found them.
+// Nothing may hand them out again in the meantime.
+
+const allocateGarbage = () => {
+    for (let i = 0; i < 100_000; ++i) ({ i });
+};
+
+test("shapes of dead objects are not reused", () => {
+    const objects = [];
+    for (let i = 0; i < 10; ++i) {
+        (() => {
+            const o = {};
+            o[`unique${i}`] = i;
+            o.other = i;
+        })();
+        gc();
+
+        const o = {};
+        o[`unique${i}`] = i;
+        o.other = i;
+        objects.push(o);
+    }
+
+    allocateGarbage();
+    gc();
+    allocateGarbage();
+
+    objects.forEach((o, i) => {
+        expect(Object.keys(o)).toEqual([`unique${i}`, "other"]);
+        expect(o.other).toBe(i);
+    });
+});
+
+test("dead strings are not revived", () => {
+    const strings = [];
+    for (let i = 0; i < 10; ++i) {
+        (() => {
+            String(1234567 + i);
+        })();
+        gc();
+
+        strings.push(String(1234567 + i));
+    }
+
+    allocateGarbage();
+    gc();
+    allocateGarbage();
+
+    strings.forEach((string, i) => {
+        expect(string).toBe(`${1234567 + i}`);
+    });
+});
+
+test("dead finalization registries are not revived", () => {
+    for (let i = 0; i < 10; ++i) {
+        (() => {
+            const registry = new FinalizationRegistry(() => {
+                expect().fail();
+            });
+            registry.register({}, i);
+        })();
+        gc();
+    }
+    allocateGarbage();
+    gc();
+});
@@ -0,0 +1,101 @@
+test("int32 arithmetic that overflows", () => {
+    const max = 2147483647;
+    const min = -2147483648;
+
+    expect(max + 1).toBe(2147483648);
+    expect(min - 1).toBe(-2147483649);
+    expect(max * 2).toBe(4294967294);
+    expect(min * -1).toBe(2147483648);
+    expect(max + max).toBe(4294967294);
+
+    let value = max;
+    value++;
+    expect(value).toBe(2147483648);
+    value = min;
+    value--;
+    expect(value).toBe(-2147483649);
+});
+
+test("int32 multiplication resulting in negative zero", () => {
+    expect(Object.is(0 * -1, -0)).toBeTrue();
+    expect(Object.is(-5 * 0, -0)).toBeTrue();
+    expect(Object.is(0 * 5, 0)).toBeTrue();
+});
+
+test("mixed int32 and double operands", () => {
+    expect(1 + 0.5).toBe(1.5);
+    expect(0.5 - 1).toBe(-0.5);
+    expect(3 * 0.5).toBe(1.5);
+    expect(1 < 1.5).toBeTrue();
+    expect(2 >= 1.5).toBeTrue();
+    expect(1 === 1.0).toBeTrue();
+    expect(NaN < 1).toBeFalse();
+    expect(NaN >= NaN).toBeFalse();
+    expect(NaN === NaN).toBeFalse();
+    expect(NaN !== NaN).toBeTrue();
+});
+
+test("non-numeric operands", () => {
+    expect(1 + "2").toBe("12");
+    expect("3" - 1).toBe(2);
+    expect("3" * "2").toBe(6);
+    expect("10" < "9").toBeTrue();
+    expect(1n + 2n).toBe(3n);
+    expect(1 === "1").toBeFalse();
+    expect(() => 1n + 1).toThrowWithMessage(TypeError, "Cannot use addition operator with BigInt and other type");
+});
+
+test("loop conditions", () => {
+    let count = 0;
+    for (let i = 0; i < 10; ++i) count++;
+    expect(count).toBe(10);
+
+    count = 0;
+    for (let i = 0.5; i <= 10; i += 0.5) count++;
+    expect(count).toBe(20);
+
+    count = 0;
+    let j = 10;
+    while (j > 0) {
+        j -= 3;
+        count++;
+    }
+    expect(count).toBe(4);
+
+    count = 0;
+    do {
+        count++;
+    } while (count !== 5);
+    expect(count).toBe(5);
+
+    expect(1 < 2 ? "yes" : "no").toBe("yes");
+    expect(eval("if (3 === 3) {}")).toBeUndefined();
+    expect(eval("let k = 0; while (k < 3) { k++; }")).toBe(2);
+});
+
+test("loop conditions with side effects", () => {
+    const log = [];
+    const lhs = {
+        valueOf() {
+            log.push("lhs");
+            return 1;
+        },
+    };
+    const rhs = {
+        valueOf() {
+            log.push("rhs");
+            return 2;
+        },
+    };
+    if (lhs < rhs) log.push("taken");
+    expect(log).toEqual(["lhs", "rhs", "taken"]);
+
+    const throwing = {
+        valueOf() {
+            throw new Error("valueOf");
+        },
+    };
+    expect(() => {
+        while (throwing > 0) {}
+    }).toThrowWithMessage(Error, "valueOf");
+});
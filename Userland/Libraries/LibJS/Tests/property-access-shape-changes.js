@@ -0,0 +1,175 @@
+// Property accesses in loops are executed many times against objects of the same shape,
+// and must notice when the shape of an object or of its prototype changes.
+
+const getFoo = o => o.foo;
+const setFoo = (o, value) => {
+    o.foo = value;
+};
+
+describe("get", () => {
+    test("objects of different shapes", () => {
+        const objects = [{ foo: 1 }, { bar: 2, foo: 3 }, { baz: 4, bar: 5, foo: 6 }, { foo: 7, qux: 8 }, { x: 0, foo: 9 }, {}];
+        for (let i = 0; i < 3; ++i) {
+            expect(objects.map(getFoo)).toEqual([1, 3, 6, 7, 9, undefined]);
+        }
+    });
+
+    test("property added to the prototype", () => {
+        const prototype = {};
+        const o = Object.create(prototype);
+        expect(getFoo(o)).toBeUndefined();
+        prototype.foo = 1;
+        expect(getFoo(o)).toBe(1);
+        prototype.foo = 2;
+        expect(getFoo(o)).toBe(2);
+    });
+
+    test("prototype property shadowed by an own property", () => {
+        const prototype = { foo: 1 };
+        const o = Object.create(prototype);
+        expect(getFoo(o)).toBe(1);
+        o.foo = 2;
+        expect(getFoo(o)).toBe(2);
+        delete o.foo;
+        expect(getFoo(o)).toBe(1);
+    });
+
+    test("prototype changed", () => {
+        const o = Object.create({ foo: 1 });
+        expect(getFoo(o)).toBe(1);
+        Object.setPrototypeOf(o, { foo: 2 });
+        expect(getFoo(o)).toBe(2);
+        Object.setPrototypeOf(o, null);
+        expect(getFoo(o)).toBeUndefined();
+    });
+
+    test("property deleted", () => {
+        const o = { bar: 1, foo: 2, baz: 3 };
+        expect(getFoo(o)).toBe(2);
+        delete o.bar;
+        expect(getFoo(o)).toBe(2);
+        delete o.foo;
+        expect(getFoo(o)).toBeUndefined();
+    });
+
+    test("data property redefined as accessor", () => {
+        const o = { foo: 1 };
+        expect(getFoo(o)).toBe(1);
+        Object.defineProperty(o, "foo", { get: () => 2, configurable: true });
+        expect(getFoo(o)).toBe(2);
+    });
+
+    test("objects with unique shapes", () => {
+        const o = {};
+        for (let i = 0; i < 150; ++i) o[`property${i}`] = i;
+        o.foo = 1;
+        expect(getFoo(o)).toBe(1);
+        delete o.property0;
+        expect(getFoo(o)).toBe(1);
+        delete o.foo;
+        expect(getFoo(o)).toBeUndefined();
+        o.foo = 2;
+        expect(getFoo(o)).toBe(2);
+    });
+
+    test("primitive base values", () => {
+        const getLength = value => value.length;
+        expect(getLength("abc")).toBe(3);
+        expect(getLength([1, 2])).toBe(2);
+        expect(getLength("abcd")).toBe(4);
+
+        const toFixed = Number.prototype.toFixed;
+        const getToFixed = value => value.toFixed;
+        expect(getToFixed(1)).toBe(toFixed);
+        Number.prototype.toFixed = 1;
+        try {
+            expect(getToFixed(1)).toBe(1);
+        } finally {
+            Number.prototype.toFixed = toFixed;
+        }
+    });
+});
+
+describe("set", () => {
+    test("objects of different shapes", () => {
+        const objects = [{ foo: 1 }, { bar: 2, foo: 3 }, { baz: 4, bar: 5, foo: 6 }, {}];
+        for (let i = 0; i < 3; ++i) {
+            objects.forEach(o => setFoo(o, i));
+            expect(objects.map(getFoo)).toEqual([i, i, i, i]);
+        }
+        expect(Object.keys(objects[3])).toEqual(["foo"]);
+    });
+
+    test("property made read-only", () => {
+        const o = { foo: 1 };
+        setFoo(o, 2);
+        Object.freeze(o);
+        setFoo(o, 3);
+        expect(o.foo).toBe(2);
+    });
+
+    test("data property redefined as accessor", () => {
+        let setterValue;
+        const o = { foo: 1 };
+        setFoo(o, 2);
+        Object.defineProperty(o, "foo", {
+            set: value => {
+                setterValue = value;
+            },
+        });
+        setFoo(o, 3);
+        expect(setterValue).toBe(3);
+    });
+
+    test("setter on the prototype", () => {
+        let setterValue;
+        const prototype = {};
+        const o = Object.create(prototype);
+        setFoo(o, 1);
+        expect(Object.hasOwn(o, "foo")).toBeTrue();
+
+        const p = Object.create(prototype);
+        Object.defineProperty(prototype, "foo", {
+            set: value => {
+                setterValue = value;
+            },
+        });
+        setFoo(p, 2);
+        expect(setterValue).toBe(2);
+        expect(Object.hasOwn(p, "foo")).toBeFalse();
+    });
+});
+
+describe("exotic objects with the same shape as ordinary objects", () => {
+    const construct = (constructor, args, prototype) => {
+        function F() {}
+        F.prototype = prototype;
+        return Reflect.construct(constructor, args, F);
+    };
+
+    test("proxy", () => {
+        const getToString = o => o.toString;
+        const o = construct(Object, [], Object.prototype);
+        getToString(o);
+        getToString(o);
+        expect(getToString(new Proxy({}, { get: () => "trapped" }))).toBe("trapped");
+    });
+
+    test("typed array", () => {
+        const getInfinity = o => o.Infinity;
+        const prototype = Object.create(Uint8Array.prototype, { Infinity: { value: "from prototype" } });
+        const o = construct(Object, [], prototype);
+        expect(getInfinity(o)).toBe("from prototype");
+        expect(getInfinity(o)).toBe("from prototype");
+        expect(getInfinity(construct(Uint8Array, [4], prototype))).toBeUndefined();
+    });
+
+    test("array length", () => {
+        const getLength = o => o.length;
+        const prototype = Object.create(Array.prototype, { length: { value: "from prototype" } });
+        const o = construct(Object, [], prototype);
+        expect(getLength(o)).toBe("from prototype");
+        expect(getLength(o)).toBe("from prototype");
+        expect(getLength(construct(Array, [1, 2], prototype))).toBe(2);
+    });
+});
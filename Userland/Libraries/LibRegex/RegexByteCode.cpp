@@ -1107,4 +1107,30 @@ ALWAYS_INLINE ExecutionResult OpCode_JumpNonEmpty::execute(MatchInput const& inp
     return ExecutionResult::Continue;
 }
 
+ExecutionResult ByteCode::execute_instruction(MatchInput const& input, MatchState& state, size_t& instruction_size) const
+{
+    auto opcode_id = OpCodeId::Exit;
+    if (auto opcode_ptr = static_cast<DisjointChunks<ByteCodeValueType> const&>(*this).find(state.instruction_position))
+        opcode_id = (OpCodeId)*opcode_ptr;
+
+    auto& opcode = get_opcode_by_id(opcode_id);
+    opcode.set_state(state);
+
+    // NOTE: The qualified calls aren't virtual, so each case gets the instruction's (always inlined) implementation.
+    switch (opcode_id) {
+#define __ENUMERATE_OPCODE(OpCode)                                              \
+    case OpCodeId::OpCode: {                                                    \
+        auto const& concrete_opcode = static_cast<OpCode_##OpCode const&>(opcode); \
+        instruction_size = concrete_opcode.OpCode_##OpCode::size();             \
+        return concrete_opcode.OpCode_##OpCode::execute(input, state);          \
+    }
+
+        ENUMERATE_OPCODES
+
+#undef __ENUMERATE_OPCODE
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
 }
@@ -11,6 +11,7 @@
 #include "RegexOptions.h"
 
 #include <AK/Concepts.h>
+#include <AK/Debug.h>
 #include <AK/DisjointChunks.h>
 #include <AK/Forward.h>
 #include <AK/HashMap.h>
@@ -143,6 +144,7 @@ struct CompareTypeAndValuePair {
 };
 
 class OpCode;
+enum class ExecutionResult : u8;
 
 class ByteCode : public DisjointChunks<ByteCodeValueType> {
     using Base = DisjointChunks<ByteCodeValueType>;
@@ -507,6 +509,10 @@ public:
 
     OpCode& get_opcode(MatchState& state) const;
 
+    // Runs the instruction at the state's instruction position, dispatching on its id rather than through the virtual
+    // OpCode::execute(). `instruction_size` is set to the size of the instruction.
+    ExecutionResult execute_instruction(MatchInput const&, MatchState&, size_t& instruction_size) const;
+
 private:
     void insert_string(StringView view)
     {
@@ -551,7 +557,10 @@ public:
 
     ALWAYS_INLINE ByteCodeValueType argument(size_t offset) const
     {
-        VERIFY(state().instruction_position + offset <= m_bytecode->size());
+        // NOTE: This is on the matcher's hot path, so it is only checked in debug builds. The parser and the optimizer
+        //       always emit all arguments of an instruction, so its arguments can't be read from past the bytecode.
+        if constexpr (REGEX_DEBUG)
+            VERIFY(state().instruction_position + 1 + offset < m_bytecode->size());
         return m_bytecode->at(state().instruction_position + 1 + offset);
     }
 
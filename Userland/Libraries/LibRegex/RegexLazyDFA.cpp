@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/Debug.h>
+#include <AK/HashFunctions.h>
+#include <AK/QuickSort.h>
+#include <LibRegex/RegexByteCode.h>
+#include <LibRegex/RegexLazyDFA.h>
+
+namespace regex {
+
+static bool is_string_compare(ByteCode const& bytecode, size_t instruction_position)
+{
+    return bytecode.at(instruction_position + 1) == 1
+        && static_cast<CharacterCompareType>(bytecode.at(instruction_position + 3)) == CharacterCompareType::String;
+}
+
+static size_t string_length_of_compare(ByteCode const& bytecode, size_t instruction_position)
+{
+    return bytecode.at(instruction_position + 4);
+}
+
+static u32 string_character_of_compare(ByteCode const& bytecode, size_t instruction_position, size_t index)
+{
+    return bytecode.at(instruction_position + 5 + index);
+}
+
+// Only Compares that consume exactly one character (or a string of ASCII characters) can be turned into DFA transitions.
+static bool can_run_compare(OpCode_Compare const& compare, ByteCode const& bytecode, size_t instruction_position)
+{
+    if (is_string_compare(bytecode, instruction_position)) {
+        auto length = string_length_of_compare(bytecode, instruction_position);
+        if (length > LazyDFA::max_string_length)
+            return false;
+        for (size_t i = 0; i < length; ++i) {
+            if (bytecode.at(instruction_position + 5 + i) >= 0x80)
+                return false;
+        }
+        return true;
+    }
+
+    size_t offset = instruction_position + 3;
+    for (size_t i = 0; i < compare.arguments_count(); ++i) {
+        switch (static_cast<CharacterCompareType>(bytecode.at(offset++))) {
+        case CharacterCompareType::String:
+        case CharacterCompareType::Reference:
+            return false;
+        case CharacterCompareType::LookupTable:
+            offset += bytecode.at(offset) + 1;
+            break;
+        case CharacterCompareType::Char:
+        case CharacterCompareType::CharClass:
+        case CharacterCompareType::CharRange:
+        case CharacterCompareType::Property:
+        case CharacterCompareType::GeneralCategory:
+        case CharacterCompareType::Script:
+        case CharacterCompareType::ScriptExtension:
+            ++offset;
+            break;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+static FlagsUnderlyingType compare_options_of(AllOptions options)
+{
+    constexpr auto compare_flags = (FlagsUnderlyingType)AllFlags::Insensitive
+        | (FlagsUnderlyingType)AllFlags::SingleLine
+        | (FlagsUnderlyingType)AllFlags::Internal_ConsiderNewline
+        | (FlagsUnderlyingType)AllFlags::Internal_ECMA262DotSemantics;
+    return (FlagsUnderlyingType)options.value() & compare_flags;
+}
+
+static void sort_and_remove_duplicates(Vector<u64>& threads)
+{
+    quick_sort(threads);
+    size_t unique_count = 0;
+    for (size_t i = 0; i < threads.size(); ++i) {
+        if (unique_count == 0 || threads[unique_count - 1] != threads[i])
+            threads[unique_count++] = threads[i];
+    }
+    threads.shrink(unique_count);
+}
+
+unsigned LazyDFA::StateKeyTraits::hash(StateKey const& key)
+{
+    unsigned hash = key.unanchored ? 1 : 0;
+    for (auto thread : key.threads)
+        hash = pair_int_hash(hash, u64_hash(thread));
+    return hash;
+}
+
+OwnPtr<LazyDFA> LazyDFA::try_create(ByteCode const& bytecode)
+{
+    MatchState state;
+    auto bytecode_size = bytecode.size();
+    while (state.instruction_position < bytecode_size) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Save:
+        case OpCodeId::Restore:
+        case OpCodeId::GoBack:
+        case OpCodeId::FailForks:
+            // Lookaround needs to look at the input independently of the current position.
+            return nullptr;
+        case OpCodeId::Compare:
+            if (!can_run_compare(static_cast<OpCode_Compare const&>(opcode), bytecode, state.instruction_position))
+                return nullptr;
+            break;
+        default:
+            break;
+        }
+        state.instruction_position += opcode.size();
+    }
+
+    return adopt_own(*new LazyDFA);
+}
+
+LazyDFA::Result LazyDFA::could_match_at(ByteCode const& bytecode, MatchInput const& input, size_t position)
+{
+    size_t match_end = 0;
+    return scan(bytecode, input, position, false, match_end);
+}
+
+LazyDFA::Result LazyDFA::could_match_after(ByteCode const& bytecode, MatchInput const& input, size_t position, size_t& match_end)
+{
+    return scan(bytecode, input, position, true, match_end);
+}
+
+LazyDFA::Result LazyDFA::scan(ByteCode const& bytecode, MatchInput const& input, size_t position, bool unanchored, size_t& match_end)
+{
+    if (m_gave_up)
+        return Result::Unknown;
+
+    // Positions are used as code unit offsets below, just like the VM does for the position it starts matching at.
+    auto length = input.view.length();
+    if (length != input.view.length_in_code_units())
+        return Result::Unknown;
+
+    auto compare_options = compare_options_of(input.regex_options);
+    if (m_cached_compare_options != compare_options) {
+        clear_cache();
+        m_cached_compare_options = compare_options;
+    }
+
+    m_cache_clears_in_scan = 0;
+    auto* state = start_state(bytecode, unanchored);
+
+    for (;;) {
+        if (state->accepting) {
+            match_end = position;
+            return Result::PossibleMatch;
+        }
+        if (state->key.threads.is_empty() || position >= length)
+            return Result::NoMatch;
+
+        auto code_point = input.view[position];
+        auto* next_state = code_point < state->ascii_transitions.size() ? state->ascii_transitions[code_point] : nullptr;
+        if (!next_state) {
+            next_state = transition(bytecode, input, *state, position, code_point);
+            if (!next_state) {
+                dbgln_if(REGEX_DEBUG, "[LazyDFA] Giving up, the state cache was cleared {} times in a single scan", m_cache_clears_in_scan);
+                m_gave_up = true;
+                clear_cache();
+                return Result::Unknown;
+            }
+        }
+
+        state = next_state;
+        ++position;
+    }
+}
+
+LazyDFA::State* LazyDFA::start_state(ByteCode const& bytecode, bool unanchored)
+{
+    auto*& start = unanchored ? m_unanchored_start : m_anchored_start;
+    if (!start) {
+        StateKey key;
+        key.unanchored = unanchored;
+        HashTable<size_t> visited;
+        add_threads_from(bytecode, 0, key.threads, visited);
+        sort_and_remove_duplicates(key.threads);
+        start = intern(bytecode, move(key));
+    }
+    return start;
+}
+
+LazyDFA::State* LazyDFA::transition(ByteCode const& bytecode, MatchInput const& input, State& state, size_t position, u32 code_point)
+{
+    StateKey key;
+    key.unanchored = state.key.unanchored;
+    HashTable<size_t> visited;
+
+    auto insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
+    MatchState match_state;
+
+    for (auto thread : state.key.threads) {
+        auto instruction_position = instruction_position_of(thread);
+        if (is_string_compare(bytecode, instruction_position)) {
+            auto index = string_index_of(thread);
+            auto character = string_character_of_compare(bytecode, instruction_position, index);
+            auto matches = insensitive ? to_ascii_lowercase(code_point) == to_ascii_lowercase(character) : code_point == character;
+            if (!matches)
+                continue;
+
+            auto string_length = string_length_of_compare(bytecode, instruction_position);
+            if (index + 1 < string_length)
+                key.threads.append(make_thread(instruction_position, index + 1));
+            else
+                add_threads_from(bytecode, instruction_position + string_length + 5, key.threads, visited);
+            continue;
+        }
+
+        match_state.string_position = position;
+        match_state.string_position_in_code_units = position;
+        match_state.instruction_position = instruction_position;
+        auto& opcode = bytecode.get_opcode(match_state);
+        if (opcode.execute(input, match_state) == ExecutionResult::Continue)
+            add_threads_from(bytecode, instruction_position + opcode.size(), key.threads, visited);
+    }
+
+    // An unanchored scan can also start a new match at the next position.
+    if (key.unanchored)
+        add_threads_from(bytecode, 0, key.threads, visited);
+
+    sort_and_remove_duplicates(key.threads);
+
+    if (auto it = m_states.find(key); it != m_states.end()) {
+        if (code_point < state.ascii_transitions.size())
+            state.ascii_transitions[code_point] = it->value.ptr();
+        return it->value.ptr();
+    }
+
+    if (m_cache_size > max_cache_size) {
+        if (++m_cache_clears_in_scan > max_cache_clears_per_scan)
+            return nullptr;
+        // NOTE: This invalidates `state`, so the transition isn't cached.
+        clear_cache();
+        return intern(bytecode, move(key));
+    }
+
+    auto* next_state = intern(bytecode, move(key));
+    if (code_point < state.ascii_transitions.size())
+        state.ascii_transitions[code_point] = next_state;
+    return next_state;
+}
+
+LazyDFA::State* LazyDFA::intern(ByteCode const& bytecode, StateKey&& key)
+{
+    auto accept_thread = make_thread(bytecode.size(), 0);
+    auto state = make<State>();
+    state->accepting = key.threads.contains_slow(accept_thread);
+    state->key = key;
+
+    m_cache_size += sizeof(State) + 2 * key.threads.size() * sizeof(u64);
+
+    auto* state_ptr = state.ptr();
+    m_states.set(move(key), move(state));
+    return state_ptr;
+}
+
+// Adds the threads that the VM could reach from `instruction_position` without consuming any input.
+void LazyDFA::add_threads_from(ByteCode const& bytecode, size_t instruction_position, Vector<u64>& threads, HashTable<size_t>& visited) const
+{
+    auto bytecode_size = bytecode.size();
+    Vector<size_t, 16> worklist;
+    worklist.append(instruction_position);
+
+    MatchState state;
+    while (!worklist.is_empty()) {
+        auto position = worklist.take_last();
+        if (position >= bytecode_size)
+            position = bytecode_size;
+        if (visited.set(position) != HashSetResult::InsertedNewEntry)
+            continue;
+
+        if (position == bytecode_size) {
+            threads.append(make_thread(bytecode_size, 0));
+            continue;
+        }
+
+        state.instruction_position = position;
+        auto& opcode = bytecode.get_opcode(state);
+        auto next_position = position + opcode.size();
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            if (is_string_compare(bytecode, position) && string_length_of_compare(bytecode, position) == 0)
+                worklist.append(next_position);
+            else
+                threads.append(make_thread(position, 0));
+            break;
+        case OpCodeId::Jump:
+            worklist.append(next_position + static_cast<OpCode_Jump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+            worklist.append(next_position);
+            worklist.append(next_position + static_cast<OpCode_ForkJump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay:
+            worklist.append(next_position + static_cast<OpCode_ForkStay const&>(opcode).offset());
+            worklist.append(next_position);
+            break;
+        case OpCodeId::JumpNonEmpty:
+            // Whether the loop is taken again depends on the input consumed since the checkpoint, so assume it could be.
+            worklist.append(next_position);
+            worklist.append(next_position + static_cast<OpCode_JumpNonEmpty const&>(opcode).offset());
+            break;
+        case OpCodeId::Repeat:
+            // The repetition count isn't tracked, so assume the loop could either end or run again.
+            worklist.append(next_position);
+            worklist.append(position - static_cast<OpCode_Repeat const&>(opcode).offset());
+            break;
+        case OpCodeId::Exit:
+            // An Exit within the bytecode fails the match.
+            break;
+        case OpCodeId::Save:
+        case OpCodeId::Restore:
+        case OpCodeId::GoBack:
+        case OpCodeId::FailForks:
+            VERIFY_NOT_REACHED();
+        default:
+            // Assertions are assumed to pass, and capture groups don't affect whether there is a match.
+            worklist.append(next_position);
+            break;
+        }
+    }
+}
+
+void LazyDFA::clear_cache()
+{
+    m_states.clear();
+    m_anchored_start = nullptr;
+    m_unanchored_start = nullptr;
+    m_cache_size = 0;
+}
+
+}
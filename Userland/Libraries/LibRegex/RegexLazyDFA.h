@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "Forward.h"
+#include "RegexMatch.h"
+
+#include <AK/Array.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/Traits.h>
+#include <AK/Vector.h>
+
+namespace regex {
+
+// A DFA that is built lazily from the bytecode of patterns without backreferences and lookaround.
+// Each DFA state is the set of Compare instructions ("threads") that the VM could run next, and states are only
+// created once some input leads to them. Transitions on ASCII characters are cached in the states, so most of the
+// input is scanned with one table lookup per character.
+//
+// NOTE: The DFA over-approximates the pattern: Assertions, repetition counts and the checks for empty loop iterations
+//       are treated as if they always passed. It never rejects an input that the backtracking VM would match, but it
+//       may accept some that the VM then rejects. The matcher uses it to skip the positions where no match can start.
+class LazyDFA {
+public:
+    enum class Result : u8 {
+        NoMatch,
+        PossibleMatch,
+        Unknown, // The DFA can't handle this input, or gave up because its cache kept overflowing.
+    };
+
+    static OwnPtr<LazyDFA> try_create(ByteCode const&);
+
+    static constexpr size_t max_string_length = 0xffff;
+
+    // Whether a match could start at `position`.
+    Result could_match_at(ByteCode const&, MatchInput const&, size_t position);
+
+    // Whether a match could start anywhere at or after `position`. If so, `match_end` is set to the end of the first
+    // possible match, i.e. no match starting at or after `position` can end before it.
+    Result could_match_after(ByteCode const&, MatchInput const&, size_t position, size_t& match_end);
+
+private:
+    LazyDFA() = default;
+
+    // A thread is the instruction position of a Compare, and the index into its string for String compares.
+    static constexpr u64 make_thread(size_t instruction_position, size_t string_index) { return (static_cast<u64>(instruction_position) << 16) | string_index; }
+    static constexpr size_t instruction_position_of(u64 thread) { return thread >> 16; }
+    static constexpr size_t string_index_of(u64 thread) { return thread & 0xffff; }
+
+    struct StateKey {
+        Vector<u64> threads; // Sorted, contains the thread for the end of the bytecode if the state is accepting.
+        bool unanchored { false };
+
+        bool operator==(StateKey const&) const = default;
+    };
+
+    struct StateKeyTraits : public GenericTraits<StateKey> {
+        static unsigned hash(StateKey const&);
+    };
+
+    struct State {
+        StateKey key;
+        bool accepting { false };
+        Array<State*, 128> ascii_transitions {};
+    };
+
+    Result scan(ByteCode const&, MatchInput const&, size_t position, bool unanchored, size_t& match_end);
+    State* start_state(ByteCode const&, bool unanchored);
+    State* transition(ByteCode const&, MatchInput const&, State&, size_t position, u32 code_point);
+    State* intern(ByteCode const&, StateKey&&);
+    void add_threads_from(ByteCode const&, size_t instruction_position, Vector<u64>& threads, HashTable<size_t>& visited) const;
+    void clear_cache();
+
+    static constexpr size_t max_cache_size = 2 * MiB;
+    static constexpr size_t max_cache_clears_per_scan = 8;
+
+    HashMap<StateKey, NonnullOwnPtr<State>, StateKeyTraits> m_states;
+    State* m_anchored_start { nullptr };
+    State* m_unanchored_start { nullptr };
+    size_t m_cache_size { 0 };
+    size_t m_cache_clears_in_scan { 0 };
+
+    // The options that change which characters a Compare accepts, the cached transitions are only valid for those.
+    Optional<FlagsUnderlyingType> m_cached_compare_options;
+    bool m_gave_up { false };
+};
+
+}
@@ -450,6 +450,16 @@ public:
             });
     }
 
+    // Note: offset and the returned position are code unit offsets, and the needle must only contain ASCII characters.
+    Optional<size_t> find_ascii_string(StringView needle, size_t offset) const
+    {
+        return m_view.visit(
+            [&](StringView view) { return find_ascii_string_in_code_units(view.bytes(), needle, offset); },
+            [&](Utf8View const& view) { return find_ascii_string_in_code_units(view.as_string().bytes(), needle, offset); },
+            [&](Utf16View const& view) { return find_ascii_string_in_code_units(ReadonlySpan<u16> { view.data(), view.length_in_code_units() }, needle, offset); },
+            [&](Utf32View const& view) { return find_ascii_string_in_code_units(ReadonlySpan<u32> { view.code_points(), view.length() }, needle, offset); });
+    }
+
     bool operator==(char const* cstring) const
     {
         return m_view.visit(
@@ -571,6 +581,25 @@ public:
     }
 
 private:
+    template<typename T>
+    static Optional<size_t> find_ascii_string_in_code_units(ReadonlySpan<T> code_units, StringView needle, size_t offset)
+    {
+        Vector<T, 32> needle_code_units;
+        for (auto ch : needle)
+            needle_code_units.append(static_cast<T>(ch));
+
+        while (offset + needle_code_units.size() <= code_units.size()) {
+            auto position = AK::memmem_optional(code_units.offset(offset), (code_units.size() - offset) * sizeof(T), needle_code_units.data(), needle_code_units.size() * sizeof(T));
+            if (!position.has_value())
+                return {};
+            // memmem doesn't know about code units, so it could find the needle in the middle of one.
+            if (*position % sizeof(T) == 0)
+                return offset + *position / sizeof(T);
+            offset += *position / sizeof(T) + 1;
+        }
+        return {};
+    }
+
     Variant<StringView, Utf8View, Utf16View, Utf32View> m_view { StringView {} };
     bool m_unicode { false };
 };
@@ -5,8 +5,11 @@
  */
 
 #include <AK/BumpAllocator.h>
+#include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/DeprecatedString.h>
+#include <AK/HashFunctions.h>
+#include <AK/HashMap.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
 #include <LibRegex/RegexParser.h>
@@ -30,16 +33,56 @@ regex::Parser::Result Regex<Parser>::parse_pattern(StringView pattern, typename
     return parser.parse();
 }
 
+struct CompiledPatternKey {
+    DeprecatedString pattern;
+    FlagsUnderlyingType options;
+
+    bool operator==(CompiledPatternKey const&) const = default;
+};
+
+struct CompiledPatternKeyTraits : public GenericTraits<CompiledPatternKey> {
+    static unsigned hash(CompiledPatternKey const& key) { return pair_int_hash(key.pattern.hash(), u64_hash(key.options)); }
+};
+
+// The same patterns tend to be compiled over and over again (e.g. by RegExp objects that are created in a loop), so the
+// parsed and optimized bytecode of the most recently compiled ones is kept around, and copied into new Regex objects.
+// NOTE: The bytecode and parser result may point into the pattern string, so the cached string is shared with them.
+static constexpr size_t max_compiled_pattern_cache_size = 64;
+
+template<class Parser>
+static HashMap<CompiledPatternKey, regex::Parser::Result, CompiledPatternKeyTraits>& compiled_pattern_cache()
+{
+    static HashMap<CompiledPatternKey, regex::Parser::Result, CompiledPatternKeyTraits> cache;
+    return cache;
+}
+
 template<class Parser>
 Regex<Parser>::Regex(DeprecatedString pattern, typename ParserTraits<Parser>::OptionsType regex_options)
     : pattern_value(move(pattern))
 {
-    regex::Lexer lexer(pattern_value);
+    auto& cache = compiled_pattern_cache<Parser>();
+    CompiledPatternKey key { pattern_value, static_cast<FlagsUnderlyingType>(regex_options.value()) };
 
-    Parser parser(lexer, regex_options);
-    parser_result = parser.parse();
+    if (auto it = cache.find(key); it != cache.end()) {
+        pattern_value = it->key.pattern;
+        parser_result = regex::Parser::Result { it->value };
+
+        // The lazy DFA caches its states for the inputs of this Regex, so it isn't shared.
+        if (parser_result.error == regex::Error::NoError)
+            lazy_dfa = LazyDFA::try_create(parser_result.bytecode);
+    } else {
+        regex::Lexer lexer(pattern_value);
+
+        Parser parser(lexer, regex_options);
+        parser_result = parser.parse();
+
+        run_optimization_passes();
+
+        if (cache.size() >= max_compiled_pattern_cache_size)
+            cache.clear();
+        cache.set(move(key), regex::Parser::Result { parser_result });
+    }
 
-    run_optimization_passes();
     if (parser_result.error == regex::Error::NoError)
         matcher = make<Matcher<Parser>>(this, static_cast<decltype(regex_options.value())>(parser_result.options.value()));
 }
@@ -59,6 +102,7 @@ Regex<Parser>::Regex(Regex&& regex)
     : pattern_value(move(regex.pattern_value))
     , parser_result(move(regex.parser_result))
     , matcher(move(regex.matcher))
+    , lazy_dfa(move(regex.lazy_dfa))
     , start_offset(regex.start_offset)
 {
     if (matcher)
@@ -73,6 +117,7 @@ Regex<Parser>& Regex<Parser>::operator=(Regex&& regex)
     matcher = move(regex.matcher);
     if (matcher)
         matcher->reset_pattern({}, this);
+    lazy_dfa = move(regex.lazy_dfa);
     start_offset = regex.start_offset;
     return *this;
 }
@@ -114,6 +159,56 @@ RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename Parse
     return match(views, regex_options);
 }
 
+// Returns the first position at or after `view_index` where a match could start according to the optimization data,
+// or nothing if no match can start there. The positions of the literals are cached across calls for the same view.
+template<typename Parser>
+Optional<size_t> Matcher<Parser>::find_next_candidate_position(MatchInput const& input, size_t view_index, bool can_search_for_literals, Optional<size_t>& literal_prefix_position, Optional<size_t>& required_literal_position) const
+{
+    auto const& optimization_data = m_pattern->parser_result.optimization_data;
+    auto const& view = input.view;
+
+    if (can_search_for_literals) {
+        // A match that starts at or after view_index has to contain the required literal after that position as well.
+        if (optimization_data.required_literal.has_value() && (!required_literal_position.has_value() || *required_literal_position < view_index)) {
+            required_literal_position = view.find_ascii_string(*optimization_data.required_literal, view_index);
+            if (!required_literal_position.has_value())
+                return {};
+        }
+
+        if (optimization_data.literal_prefix.has_value()) {
+            if (!literal_prefix_position.has_value() || *literal_prefix_position < view_index)
+                literal_prefix_position = view.find_ascii_string(*optimization_data.literal_prefix, view_index);
+            return literal_prefix_position;
+        }
+    }
+
+    if (!optimization_data.starting_ranges.has_value())
+        return view_index;
+
+    // NOTE: This folds case like the Compare instructions do, i.e. only for ASCII characters.
+    auto insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
+    auto is_in_starting_ranges = [&](u32 code_point) {
+        for (auto const& range : *optimization_data.starting_ranges) {
+            if (code_point >= range.from && code_point <= range.to)
+                return true;
+            if (insensitive && to_ascii_lowercase(code_point) >= to_ascii_lowercase(range.from) && to_ascii_lowercase(code_point) <= to_ascii_lowercase(range.to))
+                return true;
+        }
+        return false;
+    };
+
+    auto view_length = view.length_in_code_units();
+    for (; view_index < view_length; ++view_index) {
+        auto code_point = view[view_index];
+        // NOTE: For surrogate pairs in UTF-16, this is the whole code point rather than the code unit that the VM compares.
+        if (code_point > 0xffff || is_in_starting_ranges(code_point))
+            return view_index;
+        if (insensitive && (is_in_starting_ranges(to_ascii_lowercase(code_point)) || is_in_starting_ranges(to_ascii_uppercase(code_point))))
+            return view_index;
+    }
+    return {};
+}
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -185,6 +280,9 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
 
+    auto& bytecode = m_pattern->parser_result.bytecode;
+    auto* lazy_dfa = m_pattern->lazy_dfa.ptr();
+
     for (auto const& view : views) {
         if (lines_to_skip != 0) {
             ++input.line;
@@ -200,6 +298,15 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         state.string_position_in_code_units = view_index;
         bool succeeded = false;
 
+        // Once the lazy DFA found that a match could end here, it doesn't have to look for one again until we've passed it.
+        Optional<size_t> possible_match_end;
+
+        // The prefilters work on code unit offsets, and the literals are compared case-sensitively.
+        bool can_skip_to_candidates = continue_search && view_length == view.length_in_code_units();
+        bool can_search_for_literals = can_skip_to_candidates && !input.regex_options.has_flag_set(AllFlags::Insensitive);
+        Optional<size_t> literal_prefix_position;
+        Optional<size_t> required_literal_position;
+
         if (view_index == view_length && m_pattern->parser_result.match_length_minimum == 0) {
             // Run the code until it tries to consume something.
             // This allows non-consuming code to run on empty strings, for instance
@@ -232,6 +339,13 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         }
 
         for (; view_index <= view_length; ++view_index) {
+            if (can_skip_to_candidates) {
+                auto candidate = find_next_candidate_position(input, view_index, can_search_for_literals, literal_prefix_position, required_literal_position);
+                if (!candidate.has_value())
+                    break;
+                view_index = *candidate;
+            }
+
             if (view_index == view_length && input.regex_options.has_flag_set(AllFlags::Multiline))
                 break;
 
@@ -248,6 +362,21 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             input.column = match_count;
             input.match_index = match_count;
 
+            if (lazy_dfa) {
+                if (continue_search && (!possible_match_end.has_value() || view_index > *possible_match_end)) {
+                    size_t match_end = 0;
+                    auto result = lazy_dfa->could_match_after(bytecode, input, view_index, match_end);
+                    if (result == LazyDFA::Result::NoMatch)
+                        break;
+                    possible_match_end = result == LazyDFA::Result::PossibleMatch ? match_end : view_length;
+                }
+                if (lazy_dfa->could_match_at(bytecode, input, view_index) == LazyDFA::Result::NoMatch) {
+                    if (!continue_search)
+                        break;
+                    continue;
+                }
+            }
+
             state.string_position = view_index;
             state.string_position_in_code_units = view_index;
             state.instruction_position = 0;
@@ -427,26 +556,29 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
     auto& bytecode = m_pattern->parser_result.bytecode;
 
     for (;;) {
-        auto& opcode = bytecode.get_opcode(state);
         ++operations;
 
 #if REGEX_DEBUG
+        auto& opcode = bytecode.get_opcode(state);
         s_regex_dbg.print_opcode("VM", opcode, state, recursion_level, false);
 #endif
 
+        auto instruction_position = state.instruction_position;
+        size_t instruction_size = 0;
         ExecutionResult result;
         if (input.fail_counter > 0) {
+            // NOTE: The instruction isn't run, and the state is replaced by the next one to try.
             --input.fail_counter;
             result = ExecutionResult::Failed_ExecuteLowPrioForks;
         } else {
-            result = opcode.execute(input, state);
+            result = bytecode.execute_instruction(input, state, instruction_size);
         }
 
 #if REGEX_DEBUG
         s_regex_dbg.print_result(opcode, bytecode, input, state, result);
 #endif
 
-        state.instruction_position += opcode.size();
+        state.instruction_position += instruction_size;
 
         switch (result) {
         case ExecutionResult::Fork_PrioLow: {
@@ -465,7 +597,7 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
             }
             if (!found) {
                 states_to_try_next.append(state);
-                states_to_try_next.last().initiating_fork = state.instruction_position - opcode.size();
+                states_to_try_next.last().initiating_fork = instruction_position;
                 states_to_try_next.last().instruction_position = state.fork_at_position;
             }
             continue;
@@ -485,7 +617,7 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
             }
             if (!found) {
                 states_to_try_next.append(state);
-                states_to_try_next.last().initiating_fork = state.instruction_position - opcode.size();
+                states_to_try_next.last().initiating_fork = instruction_position;
             }
             state.instruction_position = state.fork_at_position;
 #if REGEX_DEBUG
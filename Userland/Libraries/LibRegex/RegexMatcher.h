@@ -7,6 +7,7 @@
 #pragma once
 
 #include "RegexByteCode.h"
+#include "RegexLazyDFA.h"
 #include "RegexMatch.h"
 #include "RegexOptions.h"
 #include "RegexParser.h"
@@ -74,6 +75,7 @@ public:
 
 private:
     bool execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+    Optional<size_t> find_next_candidate_position(MatchInput const&, size_t view_index, bool can_search_for_literals, Optional<size_t>& literal_prefix_position, Optional<size_t>& required_literal_position) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
@@ -85,6 +87,7 @@ public:
     DeprecatedString pattern_value;
     regex::Parser::Result parser_result;
     OwnPtr<Matcher<Parser>> matcher { nullptr };
+    mutable OwnPtr<LazyDFA> lazy_dfa { nullptr };
     mutable size_t start_offset { 0 };
 
     static regex::Parser::Result parse_pattern(StringView pattern, typename ParserTraits<Parser>::OptionsType regex_options = {});
@@ -231,6 +234,7 @@ public:
 private:
     void run_optimization_passes();
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
+    void fill_optimization_data();
 };
 
 // free standing functions for match, search and has_match
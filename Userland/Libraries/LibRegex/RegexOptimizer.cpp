@@ -29,6 +29,13 @@ void Regex<Parser>::run_optimization_passes()
     attempt_rewrite_loops_as_atomic_groups(split_basic_blocks(parser_result.bytecode));
 
     parser_result.bytecode.flatten();
+
+    fill_optimization_data();
+
+    // Patterns without backreferences and lookaround can be run on a DFA, which lets the matcher skip the positions
+    // (and whole inputs) where no match can start without backtracking.
+    if (parser_result.error == Error::NoError)
+        lazy_dfa = LazyDFA::try_create(parser_result.bytecode);
 }
 
 template<typename Parser>
@@ -655,6 +662,224 @@ void Regex<Parser>::attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&
     }
 }
 
+// Returns the target of the jump or fork at `instruction_position`, if it is one.
+static Optional<size_t> jump_target_of(OpCode const& opcode, size_t instruction_position)
+{
+    auto next_position = instruction_position + opcode.size();
+    switch (opcode.opcode_id()) {
+    case OpCodeId::Jump:
+        return next_position + static_cast<OpCode_Jump const&>(opcode).offset();
+    case OpCodeId::ForkJump:
+    case OpCodeId::ForkReplaceJump:
+        return next_position + static_cast<OpCode_ForkJump const&>(opcode).offset();
+    case OpCodeId::ForkStay:
+    case OpCodeId::ForkReplaceStay:
+        return next_position + static_cast<OpCode_ForkStay const&>(opcode).offset();
+    case OpCodeId::JumpNonEmpty:
+        return next_position + static_cast<OpCode_JumpNonEmpty const&>(opcode).offset();
+    case OpCodeId::Repeat:
+        return instruction_position - static_cast<OpCode_Repeat const&>(opcode).offset();
+    default:
+        return {};
+    }
+}
+
+// Returns the characters of a Compare that matches a literal ASCII string (or a single ASCII character).
+static Optional<DeprecatedString> literal_of_compare(ByteCode const& bytecode, size_t instruction_position)
+{
+    if (bytecode.at(instruction_position + 1) != 1)
+        return {};
+
+    StringBuilder builder;
+    auto type = static_cast<CharacterCompareType>(bytecode.at(instruction_position + 3));
+    if (type == CharacterCompareType::Char) {
+        auto ch = bytecode.at(instruction_position + 4);
+        if (ch >= 0x80)
+            return {};
+        builder.append(static_cast<char>(ch));
+    } else if (type == CharacterCompareType::String) {
+        auto length = bytecode.at(instruction_position + 4);
+        for (size_t i = 0; i < length; ++i) {
+            auto ch = bytecode.at(instruction_position + 5 + i);
+            if (ch >= 0x80)
+                return {};
+            builder.append(static_cast<char>(ch));
+        }
+    } else {
+        return {};
+    }
+
+    if (builder.is_empty())
+        return {};
+    return builder.to_deprecated_string();
+}
+
+// Adds the characters that a Compare could consume to `ranges`, or returns false if they can't be described that way.
+static bool append_starting_ranges_of_compare(OpCode_Compare const& compare, Vector<CharRange>& ranges)
+{
+    for (auto const& pair : compare.flat_compares()) {
+        switch (pair.type) {
+        case CharacterCompareType::Char:
+            if (pair.value > 0x10ffff)
+                return false;
+            ranges.append({ static_cast<u32>(pair.value), static_cast<u32>(pair.value) });
+            break;
+        case CharacterCompareType::String:
+            // NOTE: flat_compares() only includes the first character of the string, and nothing at all for empty strings.
+            //       Strings are compared in the encoding of the input, so only ASCII characters are known to be a single code unit.
+            if (compare.arguments_count() != 1 || pair.value >= 0x80)
+                return false;
+            ranges.append({ static_cast<u32>(pair.value), static_cast<u32>(pair.value) });
+            break;
+        case CharacterCompareType::CharRange:
+            ranges.append(CharRange { pair.value });
+            break;
+        case CharacterCompareType::CharClass:
+            if (static_cast<CharClass>(pair.value) != CharClass::Digit)
+                return false;
+            ranges.append({ '0', '9' });
+            break;
+        default:
+            return false;
+        }
+    }
+    return !ranges.is_empty();
+}
+
+template<typename Parser>
+void Regex<Parser>::fill_optimization_data()
+{
+    auto& optimization_data = parser_result.optimization_data;
+    optimization_data.required_literal.clear();
+    optimization_data.literal_prefix.clear();
+    optimization_data.starting_ranges.clear();
+
+    if (parser_result.error != Error::NoError)
+        return;
+
+    auto const& bytecode = parser_result.bytecode;
+    auto bytecode_size = bytecode.size();
+
+    // Every path through the bytecode runs an instruction unless there is a jump or fork over it, as backwards jumps can
+    // only lead to instructions that have already been passed once. Count the jumps over each position to find those.
+    Vector<int> jumps_over_position;
+    jumps_over_position.resize(bytecode_size + 1);
+
+    MatchState state;
+    for (state.instruction_position = 0; state.instruction_position < bytecode_size;) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Save:
+        case OpCodeId::Restore:
+        case OpCodeId::GoBack:
+        case OpCodeId::FailForks:
+            // Lookaround compares the input at other positions, and negative lookaround has to fail to match.
+            return;
+        default:
+            break;
+        }
+
+        auto next_position = state.instruction_position + opcode.size();
+        auto target = jump_target_of(opcode, state.instruction_position);
+        if (target.has_value() && *target > next_position) {
+            ++jumps_over_position[next_position];
+            --jumps_over_position[min(*target, bytecode_size)];
+        }
+        state.instruction_position = next_position;
+    }
+    for (size_t i = 1; i < jumps_over_position.size(); ++i)
+        jumps_over_position[i] += jumps_over_position[i - 1];
+
+    // Literals are made up of Compares that every path runs, with nothing in between that could consume input.
+    StringBuilder literal;
+    bool literal_is_prefix = false;
+    bool has_seen_compare = false;
+    auto finish_literal = [&] {
+        if (literal.is_empty())
+            return;
+        auto string = literal.to_deprecated_string();
+        literal.clear();
+        if (literal_is_prefix)
+            optimization_data.literal_prefix = string;
+        else if (!optimization_data.required_literal.has_value() || optimization_data.required_literal->length() < string.length())
+            optimization_data.required_literal = string;
+    };
+
+    for (state.instruction_position = 0; state.instruction_position < bytecode_size;) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            auto string = jumps_over_position[state.instruction_position] == 0 ? literal_of_compare(bytecode, state.instruction_position) : Optional<DeprecatedString> {};
+            if (!string.has_value()) {
+                finish_literal();
+            } else {
+                if (literal.is_empty())
+                    literal_is_prefix = !has_seen_compare;
+                literal.append(*string);
+            }
+            has_seen_compare = true;
+            break;
+        }
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::Checkpoint:
+            break;
+        default:
+            finish_literal();
+            break;
+        }
+        state.instruction_position += opcode.size();
+    }
+    finish_literal();
+
+    // The characters a match can start with are those of the Compares that can run before any input is consumed.
+    Vector<CharRange> starting_ranges;
+    HashTable<size_t> visited;
+    Vector<size_t> worklist;
+    worklist.append(0);
+    while (!worklist.is_empty()) {
+        auto position = worklist.take_last();
+        // If the end can be reached without consuming anything, the pattern matches the empty string anywhere.
+        if (position >= bytecode_size)
+            return;
+        if (visited.set(position) != HashSetResult::InsertedNewEntry)
+            continue;
+
+        state.instruction_position = position;
+        auto& opcode = bytecode.get_opcode(state);
+        auto next_position = position + opcode.size();
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            if (!append_starting_ranges_of_compare(static_cast<OpCode_Compare const&>(opcode), starting_ranges))
+                return;
+            break;
+        case OpCodeId::Jump:
+            worklist.append(*jump_target_of(opcode, position));
+            break;
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay:
+        case OpCodeId::JumpNonEmpty:
+        case OpCodeId::Repeat:
+            worklist.append(next_position);
+            worklist.append(*jump_target_of(opcode, position));
+            break;
+        case OpCodeId::Exit:
+            break;
+        default:
+            // Assertions only make the set of starting characters smaller.
+            worklist.append(next_position);
+            break;
+        }
+    }
+
+    if (!starting_ranges.is_empty())
+        optimization_data.starting_ranges = move(starting_ranges);
+}
+
 void Optimizer::append_alternation(ByteCode& target, ByteCode&& left, ByteCode&& right)
 {
     Array<ByteCode, 2> alternatives;
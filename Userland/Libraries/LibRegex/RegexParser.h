@@ -55,6 +55,18 @@ public:
         Token error_token;
         Vector<DeprecatedFlyString> capture_groups;
         AllOptions options;
+
+        // Filled in by the optimizer, lets the matcher skip the input positions where no match can start.
+        struct {
+            // An ASCII string that every match starts with.
+            Optional<DeprecatedString> literal_prefix;
+
+            // Another ASCII string that every match contains (the longest one, if there are several).
+            Optional<DeprecatedString> required_literal;
+
+            // If populated, every match starts with a character in these ranges.
+            Optional<Vector<CharRange>> starting_ranges;
+        } optimization_data {};
     };
 
     explicit Parser(Lexer& lexer)
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AK/DeprecatedString.h>
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
@@ -71,18 +73,21 @@ private:
 
 class ColumnDefinition : public ASTNode {
 public:
-    ColumnDefinition(DeprecatedString name, NonnullRefPtr<TypeName> type_name)
+    ColumnDefinition(DeprecatedString name, NonnullRefPtr<TypeName> type_name, bool is_primary_key = false)
         : m_name(move(name))
         , m_type_name(move(type_name))
+        , m_is_primary_key(is_primary_key)
     {
     }
 
     DeprecatedString const& name() const { return m_name; }
     NonnullRefPtr<TypeName> const& type_name() const { return m_type_name; }
+    bool is_primary_key() const { return m_is_primary_key; }
 
 private:
     DeprecatedString m_name;
     NonnullRefPtr<TypeName> m_type_name;
+    bool m_is_primary_key { false };
 };
 
 class CommonTableExpression : public ASTNode {
@@ -297,11 +302,22 @@ private:
 // Expressions
 //==================================================================================================
 
+using ResultBatchCallback = Function<ErrorOr<void>(ResultSet&)>;
+
 struct ExecutionContext {
     NonnullRefPtr<Database> database;
     Statement const* statement { nullptr };
     ReadonlySpan<Value> placeholder_values {};
     Tuple* current_row { nullptr };
+
+    // When set, a SELECT passes its rows to this callback in batches of `result_batch_size`
+    // rows while it is still producing them, instead of collecting them in its ResultSet.
+    ResultBatchCallback* on_result_batch { nullptr };
+    size_t result_batch_size { 0 };
+
+    // The aggregates computed by the HashAggregate operator of a SELECT. Their values follow
+    // the columns of the rows which the operator produces, in this order.
+    Vector<AggregateExpression const*> aggregates {};
 };
 
 class Expression : public ASTNode {
@@ -584,6 +600,53 @@ private:
     Vector<NonnullRefPtr<Expression>> m_expressions;
 };
 
+#define __enum_AggregateFunction(S) \
+    S(Count, "COUNT")                \
+    S(Sum, "SUM")                    \
+    S(Min, "MIN")                    \
+    S(Max, "MAX")                    \
+    S(Avg, "AVG")
+
+enum class AggregateFunction {
+#undef __AggregateFunction
+#define __AggregateFunction(code, name) code,
+    __enum_AggregateFunction(__AggregateFunction)
+#undef __AggregateFunction
+};
+
+constexpr char const* AggregateFunction_name(AggregateFunction function)
+{
+    switch (function) {
+#undef __AggregateFunction
+#define __AggregateFunction(code, name) \
+    case AggregateFunction::code:       \
+        return name;
+        __enum_AggregateFunction(__AggregateFunction)
+#undef __AggregateFunction
+            default : VERIFY_NOT_REACHED();
+    }
+}
+
+// A call of an aggregate function, like COUNT(*) or SUM(expression). The argument is null
+// for COUNT(*). Aggregates are not computed by evaluating the expression, but by the
+// HashAggregate operator; evaluating it reads the computed value from the current row.
+class AggregateExpression : public Expression {
+public:
+    AggregateExpression(AggregateFunction function, RefPtr<Expression> argument)
+        : m_function(function)
+        , m_argument(move(argument))
+    {
+    }
+
+    AggregateFunction function() const { return m_function; }
+    RefPtr<Expression> const& argument() const { return m_argument; }
+    virtual ResultOr<Value> evaluate(ExecutionContext&) const override;
+
+private:
+    AggregateFunction m_function;
+    RefPtr<Expression> m_argument;
+};
+
 class CastExpression : public NestedExpression {
 public:
     CastExpression(NonnullRefPtr<Expression> expression, NonnullRefPtr<TypeName> type_name)
@@ -703,6 +766,7 @@ public:
     }
 
     NonnullRefPtr<Expression> const& expression() const { return m_expression; }
+    virtual ResultOr<Value> evaluate(ExecutionContext&) const override;
 
 private:
     NonnullRefPtr<Expression> m_expression;
@@ -761,10 +825,19 @@ class Statement : public ASTNode {
 public:
     ResultOr<ResultSet> execute(AK::NonnullRefPtr<Database> database, ReadonlySpan<Value> placeholder_values = {}) const;
 
+    // Executes the statement, but passes the rows of a SELECT to `on_batch` in batches of at
+    // most `batch_size` rows as soon as they are produced. The returned ResultSet of a SELECT
+    // then does not contain any rows.
+    ResultOr<ResultSet> execute(AK::NonnullRefPtr<Database> database, ReadonlySpan<Value> placeholder_values, size_t batch_size, ResultBatchCallback on_batch) const;
+
     virtual ResultOr<ResultSet> execute(ExecutionContext&) const
     {
         return Result { SQLCommand::Unknown, SQLErrorCode::NotYetImplemented };
     }
+
+    // Builds the operator pipeline which executes the statement. Only statements which
+    // read rows from tables have a plan.
+    virtual ResultOr<NonnullOwnPtr<Operator>> plan(ExecutionContext&) const;
 };
 
 class ErrorStatement final : public Statement {
@@ -831,6 +904,36 @@ private:
     bool m_is_error_if_table_exists;
 };
 
+class CreateIndex : public Statement {
+public:
+    CreateIndex(DeprecatedString schema_name, DeprecatedString index_name, DeprecatedString table_name, Vector<DeprecatedString> column_names, bool is_unique, bool is_error_if_index_exists)
+        : m_schema_name(move(schema_name))
+        , m_index_name(move(index_name))
+        , m_table_name(move(table_name))
+        , m_column_names(move(column_names))
+        , m_is_unique(is_unique)
+        , m_is_error_if_index_exists(is_error_if_index_exists)
+    {
+    }
+
+    DeprecatedString const& schema_name() const { return m_schema_name; }
+    DeprecatedString const& index_name() const { return m_index_name; }
+    DeprecatedString const& table_name() const { return m_table_name; }
+    Vector<DeprecatedString> const& column_names() const { return m_column_names; }
+    bool is_unique() const { return m_is_unique; }
+    bool is_error_if_index_exists() const { return m_is_error_if_index_exists; }
+
+    ResultOr<ResultSet> execute(ExecutionContext&) const override;
+
+private:
+    DeprecatedString m_schema_name;
+    DeprecatedString m_index_name;
+    DeprecatedString m_table_name;
+    Vector<DeprecatedString> m_column_names;
+    bool m_is_unique;
+    bool m_is_error_if_index_exists;
+};
+
 class AlterTable : public Statement {
 public:
     DeprecatedString const& schema_name() const { return m_schema_name; }
@@ -1023,6 +1126,7 @@ public:
     RefPtr<ReturningClause> const& returning_clause() const { return m_returning_clause; }
 
     virtual ResultOr<ResultSet> execute(ExecutionContext&) const override;
+    virtual ResultOr<NonnullOwnPtr<Operator>> plan(ExecutionContext&) const override;
 
 private:
     RefPtr<CommonTableExpressionList> m_common_table_expression_list;
@@ -1050,6 +1154,7 @@ public:
     RefPtr<ReturningClause> const& returning_clause() const { return m_returning_clause; }
 
     virtual ResultOr<ResultSet> execute(ExecutionContext&) const override;
+    virtual ResultOr<NonnullOwnPtr<Operator>> plan(ExecutionContext&) const override;
 
 private:
     RefPtr<CommonTableExpressionList> m_common_table_expression_list;
@@ -1081,8 +1186,11 @@ public:
     Vector<NonnullRefPtr<OrderingTerm>> const& ordering_term_list() const { return m_ordering_term_list; }
     RefPtr<LimitClause> const& limit_clause() const { return m_limit_clause; }
     ResultOr<ResultSet> execute(ExecutionContext&) const override;
+    ResultOr<NonnullOwnPtr<Operator>> plan(ExecutionContext&) const override;
 
 private:
+    ResultOr<NonnullOwnPtr<Operator>> build_pipeline(ExecutionContext&, Vector<DeprecatedString>& column_names) const;
+
     RefPtr<CommonTableExpressionList> m_common_table_expression_list;
     bool m_select_all;
     Vector<NonnullRefPtr<ResultColumn>> m_result_column_list;
@@ -1107,4 +1215,18 @@ private:
     NonnullRefPtr<QualifiedTableName> m_qualified_table_name;
 };
 
+class Explain : public Statement {
+public:
+    Explain(NonnullRefPtr<Statement> statement)
+        : m_statement(move(statement))
+    {
+    }
+
+    NonnullRefPtr<Statement> const& statement() const { return m_statement; }
+    ResultOr<ResultSet> execute(ExecutionContext&) const override;
+
+private:
+    NonnullRefPtr<Statement> m_statement;
+};
+
 }
@@ -6,6 +6,7 @@
 
 #include <LibSQL/AST/AST.h>
 #include <LibSQL/Database.h>
+#include <LibSQL/Meta.h>
 
 namespace SQL::AST {
 
@@ -13,6 +14,7 @@ ResultOr<ResultSet> CreateTable::execute(ExecutionContext& context) const
 {
     auto schema_def = TRY(context.database->get_schema(m_schema_name));
     auto table_def = TableDef::construct(schema_def, m_table_name);
+    Optional<size_t> primary_key_column_index;
 
     for (auto const& column : m_columns) {
         SQLType type;
@@ -29,11 +31,29 @@ ResultOr<ResultSet> CreateTable::execute(ExecutionContext& context) const
             return Result { SQLCommand::Create, SQLErrorCode::InvalidType, column->type_name()->name() };
 
         table_def->append_column(column->name(), type);
+
+        if (column->is_primary_key()) {
+            // FIXME: Support the PRIMARY KEY table constraint, which may span several columns.
+            if (primary_key_column_index.has_value())
+                return Result { SQLCommand::Create, SQLErrorCode::SyntaxError, "Table has more than one primary key"sv };
+            primary_key_column_index = table_def->num_columns() - 1;
+        }
     }
 
     if (auto result = context.database->add_table(*table_def); result.is_error()) {
         if (result.error().error() != SQLErrorCode::TableExists || m_is_error_if_table_exists)
             return result.release_error();
+        return ResultSet { SQLCommand::Create };
+    }
+
+    // The primary key is enforced by a unique index on the primary key column.
+    if (primary_key_column_index.has_value()) {
+        auto created_table_def = TRY(context.database->get_table(m_schema_name, m_table_name));
+        auto const& column = created_table_def->columns()[*primary_key_column_index];
+
+        auto index_def = IndexDef::construct(created_table_def, DeprecatedString::formatted("{}_PRIMARY_KEY", m_table_name), true);
+        index_def->append_column(column->name(), column->type());
+        TRY(context.database->add_index(*index_def));
     }
 
     return ResultSet { SQLCommand::Create };
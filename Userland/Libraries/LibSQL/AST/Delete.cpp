@@ -7,27 +7,46 @@
 #include <LibSQL/AST/AST.h>
 #include <LibSQL/Database.h>
 #include <LibSQL/Meta.h>
+#include <LibSQL/Operator.h>
+#include <LibSQL/Planner.h>
 #include <LibSQL/Row.h>
 
 namespace SQL::AST {
 
+ResultOr<NonnullOwnPtr<Operator>> Delete::plan(ExecutionContext& context) const
+{
+    auto const& schema_name = m_qualified_table_name->schema_name();
+    auto const& table_name = m_qualified_table_name->table_name();
+    auto table_def = TRY(context.database->get_table(schema_name, table_name));
+
+    Vector<NonnullRefPtr<Expression const>> predicates;
+    if (auto const& where_clause = this->where_clause())
+        collect_conjuncts(*where_clause, predicates);
+
+    return plan_table_access(context, move(table_def), move(predicates));
+}
+
 ResultOr<ResultSet> Delete::execute(ExecutionContext& context) const
 {
     auto const& schema_name = m_qualified_table_name->schema_name();
     auto const& table_name = m_qualified_table_name->table_name();
     auto table_def = TRY(context.database->get_table(schema_name, table_name));
 
-    ResultSet result { SQLCommand::Delete };
+    // All matching rows are found before any of them are removed, as removing rows
+    // modifies the table and its indexes while they are being read.
+    Vector<Block::Index> matched_block_indices;
+    {
+        auto pipeline = TRY(plan(context));
 
-    for (auto& table_row : TRY(context.database->select_all(*table_def))) {
-        context.current_row = &table_row;
+        Tuple row;
+        while (TRY(pipeline->next(context, row)))
+            TRY(matched_block_indices.try_append(row.block_index()));
+    }
 
-        if (auto const& where_clause = this->where_clause()) {
-            auto where_result = TRY(where_clause->evaluate(context)).to_bool();
-            if (!where_result.has_value() || !where_result.value())
-                continue;
-        }
+    ResultSet result { SQLCommand::Delete };
 
+    for (auto block_index : matched_block_indices) {
+        auto table_row = TRY(context.database->read_row(*table_def, block_index));
         TRY(context.database->remove(table_row));
 
         // FIXME: Implement the RETURNING clause.
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibSQL/AST/AST.h>
+#include <LibSQL/Operator.h>
+#include <LibSQL/ResultSet.h>
+
+namespace SQL::AST {
+
+ResultOr<ResultSet> Explain::execute(ExecutionContext& context) const
+{
+    auto pipeline = TRY(m_statement->plan(context));
+
+    Vector<DeprecatedString> lines;
+    TRY(pipeline->explain(lines));
+
+    auto descriptor = adopt_ref(*new TupleDescriptor);
+    descriptor->append({ .name = "plan", .type = SQLType::Text });
+
+    ResultSet result { SQLCommand::Explain, { "plan" } };
+    TRY(result.try_ensure_capacity(lines.size()));
+
+    for (auto& line : lines) {
+        Tuple tuple(descriptor);
+        tuple[0] = move(line);
+
+        result.insert_row(tuple, Tuple {});
+    }
+
+    return result;
+}
+
+}
@@ -46,6 +46,17 @@ ResultOr<Value> NestedExpression::evaluate(ExecutionContext& context) const
     return expression()->evaluate(context);
 }
 
+ResultOr<Value> AggregateExpression::evaluate(ExecutionContext& context) const
+{
+    auto index = context.aggregates.find_first_index(this);
+    if (!index.has_value() || !context.current_row)
+        return Result { SQLCommand::Unknown, SQLErrorCode::AggregateMisuse, "expression"sv };
+
+    auto const& row = *context.current_row;
+    VERIFY(row.size() >= context.aggregates.size());
+    return row[row.size() - context.aggregates.size() + *index];
+}
+
 ResultOr<Value> ChainedExpression::evaluate(ExecutionContext& context) const
 {
     Vector<Value> values;
@@ -147,6 +158,16 @@ ResultOr<Value> UnaryOperatorExpression::evaluate(ExecutionContext& context) con
     }
 }
 
+ResultOr<Value> BetweenExpression::evaluate(ExecutionContext& context) const
+{
+    Value value = TRY(expression()->evaluate(context));
+    Value lhs_value = TRY(lhs()->evaluate(context));
+    Value rhs_value = TRY(rhs()->evaluate(context));
+
+    bool is_between = value.compare(lhs_value) >= 0 && value.compare(rhs_value) <= 0;
+    return Value(invert_expression() ? !is_between : is_between);
+}
+
 ResultOr<Value> ColumnNameExpression::evaluate(ExecutionContext& context) const
 {
     if (!context.current_row)
@@ -41,6 +41,8 @@ NonnullRefPtr<Statement> Parser::parse_statement()
         consume();
         if (match(TokenType::Schema))
             return parse_create_schema_statement();
+        else if (match(TokenType::Unique) || match(TokenType::Index))
+            return parse_create_index_statement();
         else
             return parse_create_table_statement();
     case TokenType::Alter:
@@ -49,6 +51,8 @@ NonnullRefPtr<Statement> Parser::parse_statement()
         return parse_drop_table_statement();
     case TokenType::Describe:
         return parse_describe_table_statement();
+    case TokenType::Explain:
+        return parse_explain_statement();
     case TokenType::Insert:
         return parse_insert_statement({});
     case TokenType::Update:
@@ -58,7 +62,7 @@ NonnullRefPtr<Statement> Parser::parse_statement()
     case TokenType::Select:
         return parse_select_statement({});
     default:
-        expected("CREATE, ALTER, DROP, DESCRIBE, INSERT, UPDATE, DELETE, or SELECT"sv);
+        expected("CREATE, ALTER, DROP, DESCRIBE, EXPLAIN, INSERT, UPDATE, DELETE, or SELECT"sv);
         return create_ast_node<ErrorStatement>();
     }
 }
@@ -129,6 +133,35 @@ NonnullRefPtr<CreateTable> Parser::parse_create_table_statement()
     return create_ast_node<CreateTable>(move(schema_name), move(table_name), move(column_definitions), is_temporary, is_error_if_table_exists);
 }
 
+NonnullRefPtr<CreateIndex> Parser::parse_create_index_statement()
+{
+    // https://sqlite.org/lang_createindex.html
+    bool is_unique = consume_if(TokenType::Unique);
+    consume(TokenType::Index);
+
+    bool is_error_if_index_exists = true;
+    if (consume_if(TokenType::If)) {
+        consume(TokenType::Not);
+        consume(TokenType::Exists);
+        is_error_if_index_exists = false;
+    }
+
+    DeprecatedString schema_name;
+    DeprecatedString index_name;
+    parse_schema_and_table_name(schema_name, index_name);
+
+    consume(TokenType::On);
+    DeprecatedString table_name = consume(TokenType::Identifier).value();
+
+    // FIXME: Parse the collation and sort order of "indexed-column".
+    Vector<DeprecatedString> column_names;
+    parse_comma_separated_list(true, [&]() { column_names.append(consume(TokenType::Identifier).value()); });
+
+    // FIXME: Parse the WHERE clause of partial indexes.
+
+    return create_ast_node<CreateIndex>(move(schema_name), move(index_name), move(table_name), move(column_names), is_unique, is_error_if_index_exists);
+}
+
 NonnullRefPtr<AlterTable> Parser::parse_alter_table_statement()
 {
     // https://sqlite.org/lang_altertable.html
@@ -194,6 +227,18 @@ NonnullRefPtr<DescribeTable> Parser::parse_describe_table_statement()
     return create_ast_node<DescribeTable>(move(table_name));
 }
 
+NonnullRefPtr<Explain> Parser::parse_explain_statement()
+{
+    // https://sqlite.org/lang_explain.html
+    consume(TokenType::Explain);
+
+    if (consume_if(TokenType::Query))
+        consume(TokenType::Plan);
+
+    auto statement = parse_statement();
+    return create_ast_node<Explain>(move(statement));
+}
+
 NonnullRefPtr<Insert> Parser::parse_insert_statement(RefPtr<CommonTableExpressionList> common_table_expression_list)
 {
     // https://sqlite.org/lang_insert.html
@@ -577,6 +622,9 @@ RefPtr<Expression> Parser::parse_column_name_expression(DeprecatedString with_pa
     else
         first_identifier = move(with_parsed_identifier);
 
+    if (!with_parsed_period && match(TokenType::ParenOpen))
+        return parse_aggregate_expression(move(first_identifier));
+
     DeprecatedString schema_name;
     DeprecatedString table_name;
     DeprecatedString column_name;
@@ -599,6 +647,36 @@ RefPtr<Expression> Parser::parse_column_name_expression(DeprecatedString with_pa
     return create_ast_node<ColumnNameExpression>(move(schema_name), move(table_name), move(column_name));
 }
 
+RefPtr<Expression> Parser::parse_aggregate_expression(DeprecatedString function_name)
+{
+    // https://sqlite.org/lang_aggfunc.html
+    consume(TokenType::ParenOpen);
+
+    Optional<AggregateFunction> aggregate_function;
+    if (function_name.equals_ignoring_ascii_case("COUNT"sv))
+        aggregate_function = AggregateFunction::Count;
+    else if (function_name.equals_ignoring_ascii_case("SUM"sv))
+        aggregate_function = AggregateFunction::Sum;
+    else if (function_name.equals_ignoring_ascii_case("MIN"sv))
+        aggregate_function = AggregateFunction::Min;
+    else if (function_name.equals_ignoring_ascii_case("MAX"sv))
+        aggregate_function = AggregateFunction::Max;
+    else if (function_name.equals_ignoring_ascii_case("AVG"sv))
+        aggregate_function = AggregateFunction::Avg;
+
+    if (!aggregate_function.has_value()) {
+        syntax_error(DeprecatedString::formatted("Unknown function {}", function_name));
+        return create_ast_node<ErrorExpression>();
+    }
+
+    RefPtr<Expression> argument;
+    if (aggregate_function != AggregateFunction::Count || !consume_if(TokenType::Asterisk))
+        argument = parse_expression();
+
+    consume(TokenType::ParenClose);
+    return create_ast_node<AggregateExpression>(*aggregate_function, move(argument));
+}
+
 RefPtr<Expression> Parser::parse_unary_operator_expression()
 {
     if (consume_if(TokenType::Minus))
@@ -901,9 +979,14 @@ NonnullRefPtr<ColumnDefinition> Parser::parse_column_definition()
         // https://www.sqlite.org/datatype3.html: If no type is specified then the column has affinity BLOB.
         : create_ast_node<TypeName>("BLOB", Vector<NonnullRefPtr<SignedNumber>> {});
 
-    // FIXME: Parse "column-constraint".
+    // FIXME: Parse the remaining kinds of "column-constraint".
+    bool is_primary_key = false;
+    if (consume_if(TokenType::Primary)) {
+        consume(TokenType::Key);
+        is_primary_key = true;
+    }
 
-    return create_ast_node<ColumnDefinition>(move(name), move(type_name));
+    return create_ast_node<ColumnDefinition>(move(name), move(type_name), is_primary_key);
 }
 
 NonnullRefPtr<TypeName> Parser::parse_type_name()
@@ -1020,10 +1103,16 @@ NonnullRefPtr<ResultColumn> Parser::parse_result_column()
             return create_ast_node<ResultColumn>(move(table_name));
     }
 
-    auto expression = table_name.is_null()
+    // An expression which started with an identifier may continue with an operator, as in
+    // "SUM(x) / COUNT(*)".
+    bool parsed_identifier = !table_name.is_null();
+    auto expression = !parsed_identifier
         ? parse_expression()
         : static_cast<NonnullRefPtr<Expression>>(*parse_column_name_expression(move(table_name), parsed_period));
 
+    if (parsed_identifier && match_secondary_expression())
+        expression = parse_secondary_expression(move(expression));
+
     DeprecatedString column_alias;
     if (consume_if(TokenType::As) || match(TokenType::Identifier))
         column_alias = consume(TokenType::Identifier).value();
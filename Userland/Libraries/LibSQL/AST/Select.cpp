@@ -4,10 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Checked.h>
 #include <AK/NumericLimits.h>
 #include <LibSQL/AST/AST.h>
 #include <LibSQL/Database.h>
 #include <LibSQL/Meta.h>
+#include <LibSQL/Operator.h>
+#include <LibSQL/Planner.h>
 #include <LibSQL/Row.h>
 
 namespace SQL::AST {
@@ -27,6 +30,11 @@ static DeprecatedString result_column_name(ResultColumn const& column, size_t co
             return column_name_expression.column_name();
         }
 
+        if (is<AggregateExpression>(*column.expression())) {
+            auto const& aggregate_expression = verify_cast<AggregateExpression>(*column.expression());
+            return AggregateFunction_name(aggregate_expression.function());
+        }
+
         // FIXME: Generate column names from other result column expressions.
         return fallback_column_name();
     }
@@ -37,10 +45,168 @@ static DeprecatedString result_column_name(ResultColumn const& column, size_t co
     return fallback_column_name();
 }
 
-ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
+struct TableRange {
+    size_t first { NumericLimits<size_t>::max() };
+    size_t last { 0 };
+
+    void include(size_t index)
+    {
+        first = min(first, index);
+        last = max(last, index);
+    }
+};
+
+static bool collect_referenced_tables(Expression const& expression, Vector<NonnullRefPtr<TableDef>> const& tables, TableRange& range)
+{
+    if (is<NumericLiteral>(expression) || is<StringLiteral>(expression) || is<BooleanLiteral>(expression) || is<NullLiteral>(expression) || is<Placeholder>(expression))
+        return true;
+
+    if (is<ColumnNameExpression>(expression)) {
+        auto const& column_name_expression = static_cast<ColumnNameExpression const&>(expression);
+        bool found = false;
+
+        for (size_t i = 0; i < tables.size(); ++i) {
+            if (!column_name_expression.table_name().is_empty() && tables[i]->name() != column_name_expression.table_name())
+                continue;
+
+            auto has_column = tables[i]->columns().find_if([&](auto const& column) { return column->name() == column_name_expression.column_name(); });
+            if (has_column.is_end())
+                continue;
+
+            range.include(i);
+            found = true;
+        }
+
+        return found;
+    }
+
+    if (is<BetweenExpression>(expression)) {
+        auto const& between_expression = static_cast<BetweenExpression const&>(expression);
+        return collect_referenced_tables(*between_expression.expression(), tables, range)
+            && collect_referenced_tables(*between_expression.lhs(), tables, range)
+            && collect_referenced_tables(*between_expression.rhs(), tables, range);
+    }
+
+    if (is<MatchExpression>(expression)) {
+        auto const& match_expression = static_cast<MatchExpression const&>(expression);
+        if (match_expression.escape() && !collect_referenced_tables(*match_expression.escape(), tables, range))
+            return false;
+    }
+
+    if (is<BinaryOperatorExpression>(expression) || is<MatchExpression>(expression)) {
+        auto const& nested_expression = static_cast<NestedDoubleExpression const&>(expression);
+        return collect_referenced_tables(*nested_expression.lhs(), tables, range)
+            && collect_referenced_tables(*nested_expression.rhs(), tables, range);
+    }
+
+    if (is<UnaryOperatorExpression>(expression) || (is<NestedExpression>(expression) && !is<InvertibleNestedExpression>(expression)))
+        return collect_referenced_tables(*static_cast<NestedExpression const&>(expression).expression(), tables, range);
+
+    if (is<ChainedExpression>(expression)) {
+        for (auto const& chained_expression : static_cast<ChainedExpression const&>(expression).expressions()) {
+            if (!collect_referenced_tables(*chained_expression, tables, range))
+                return false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+// Collects the aggregates within an expression. Returns false if an aggregate is nested
+// within the argument of another aggregate.
+static bool collect_aggregates(Expression const& expression, Vector<NonnullRefPtr<AggregateExpression const>>& aggregates)
+{
+    if (is<AggregateExpression>(expression)) {
+        auto const& aggregate_expression = static_cast<AggregateExpression const&>(expression);
+        if (aggregate_expression.argument()) {
+            Vector<NonnullRefPtr<AggregateExpression const>> nested_aggregates;
+            if (!collect_aggregates(*aggregate_expression.argument(), nested_aggregates) || !nested_aggregates.is_empty())
+                return false;
+        }
+
+        aggregates.append(aggregate_expression);
+        return true;
+    }
+
+    if (is<BetweenExpression>(expression)) {
+        auto const& between_expression = static_cast<BetweenExpression const&>(expression);
+        if (!collect_aggregates(*between_expression.expression(), aggregates))
+            return false;
+    }
+
+    if (is<MatchExpression>(expression)) {
+        auto const& match_expression = static_cast<MatchExpression const&>(expression);
+        if (match_expression.escape() && !collect_aggregates(*match_expression.escape(), aggregates))
+            return false;
+    }
+
+    if (is<NestedDoubleExpression>(expression)) {
+        auto const& nested_expression = static_cast<NestedDoubleExpression const&>(expression);
+        return collect_aggregates(*nested_expression.lhs(), aggregates)
+            && collect_aggregates(*nested_expression.rhs(), aggregates);
+    }
+
+    if (is<InChainedExpression>(expression)) {
+        auto const& in_chained_expression = static_cast<InChainedExpression const&>(expression);
+        if (!collect_aggregates(*in_chained_expression.expression_chain(), aggregates))
+            return false;
+    }
+
+    if (is<NestedExpression>(expression))
+        return collect_aggregates(*static_cast<NestedExpression const&>(expression).expression(), aggregates);
+
+    if (is<ChainedExpression>(expression)) {
+        for (auto const& chained_expression : static_cast<ChainedExpression const&>(expression).expressions()) {
+            if (!collect_aggregates(*chained_expression, aggregates))
+                return false;
+        }
+        return true;
+    }
+
+    if (is<CaseExpression>(expression)) {
+        auto const& case_expression = static_cast<CaseExpression const&>(expression);
+        if (case_expression.case_expression() && !collect_aggregates(*case_expression.case_expression(), aggregates))
+            return false;
+
+        for (auto const& clause : case_expression.when_then_clauses()) {
+            if (!collect_aggregates(*clause.when, aggregates) || !collect_aggregates(*clause.then, aggregates))
+                return false;
+        }
+
+        return !case_expression.else_expression() || collect_aggregates(*case_expression.else_expression(), aggregates);
+    }
+
+    return true;
+}
+
+static bool contains_aggregates(Expression const& expression)
+{
+    Vector<NonnullRefPtr<AggregateExpression const>> aggregates;
+    return !collect_aggregates(expression, aggregates) || !aggregates.is_empty();
+}
+
+// Determines the range of tables (by position in the FROM clause) referenced by an expression.
+// Returns an empty optional if the expression cannot be evaluated before all tables are joined.
+static Optional<TableRange> referenced_tables(Expression const& expression, Vector<NonnullRefPtr<TableDef>> const& tables)
+{
+    if (tables.is_empty())
+        return {};
+
+    TableRange range;
+    if (!collect_referenced_tables(expression, tables, range))
+        return {};
+
+    // Expressions which do not reference any table can be evaluated on the first table scan.
+    if (range.first > range.last)
+        return TableRange { 0, 0 };
+    return range;
+}
+
+ResultOr<NonnullOwnPtr<Operator>> Select::build_pipeline(ExecutionContext& context, Vector<DeprecatedString>& column_names) const
 {
     Vector<NonnullRefPtr<ResultColumn const>> columns;
-    Vector<DeprecatedString> column_names;
+    Vector<NonnullRefPtr<TableDef>> tables;
 
     auto const& result_column_list = this->result_column_list();
     VERIFY(!result_column_list.is_empty());
@@ -64,6 +230,9 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
                 column_names.unchecked_append(col->name());
             }
         }
+
+        if (table_def->num_columns() > 0)
+            TRY(tables.try_append(move(table_def)));
     }
 
     if (result_column_list.size() != 1 || result_column_list[0]->type() != ResultType::All) {
@@ -83,77 +252,92 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
         }
     }
 
-    ResultSet result { SQLCommand::Select, move(column_names) };
-
-    auto descriptor = adopt_ref(*new TupleDescriptor);
-    Tuple tuple(descriptor);
-    Vector<Tuple> rows;
-    descriptor->empend("__unity__"sv);
-    tuple.append(Value { true });
-    rows.append(tuple);
-
-    for (auto& table_descriptor : table_or_subquery_list()) {
-        if (!table_descriptor->is_table())
-            return Result { SQLCommand::Select, SQLErrorCode::NotYetImplemented, "Sub-selects are not yet implemented"sv };
-
-        auto table_def = TRY(context.database->get_table(table_descriptor->schema_name(), table_descriptor->table_name()));
-        if (table_def->num_columns() == 0)
-            continue;
+    // Aggregates may be used in the result columns, the HAVING clause and the ORDER BY clause,
+    // which are all evaluated against the rows produced by the HashAggregate operator.
+    Vector<NonnullRefPtr<AggregateExpression const>> aggregates;
+    auto collect_aggregates_in = [&](Expression const& expression) -> ResultOr<void> {
+        if (!collect_aggregates(expression, aggregates))
+            return Result { SQLCommand::Select, SQLErrorCode::AggregateMisuse, "aggregate function argument"sv };
+        return {};
+    };
 
-        auto old_descriptor_size = descriptor->size();
-        descriptor->extend(table_def->to_tuple_descriptor());
+    for (auto const& column : columns)
+        TRY(collect_aggregates_in(*column->expression()));
+    if (m_group_by_clause && m_group_by_clause->having_clause())
+        TRY(collect_aggregates_in(*m_group_by_clause->having_clause()));
+    for (auto const& ordering_term : m_ordering_term_list)
+        TRY(collect_aggregates_in(*ordering_term->expression()));
 
-        while (!rows.is_empty() && (rows.first().size() == old_descriptor_size)) {
-            auto cartesian_row = rows.take_first();
-            auto table_rows = TRY(context.database->select_all(*table_def));
+    if (where_clause() && contains_aggregates(*where_clause()))
+        return Result { SQLCommand::Select, SQLErrorCode::AggregateMisuse, "WHERE clause"sv };
 
-            for (auto& table_row : table_rows) {
-                auto new_row = cartesian_row;
-                new_row.extend(table_row);
-                rows.append(new_row);
-            }
+    if (m_group_by_clause) {
+        for (auto const& expression : m_group_by_clause->group_by_list()) {
+            if (contains_aggregates(*expression))
+                return Result { SQLCommand::Select, SQLErrorCode::AggregateMisuse, "GROUP BY clause"sv };
         }
     }
 
-    bool has_ordering { false };
-    auto sort_descriptor = adopt_ref(*new TupleDescriptor);
-    for (auto& term : m_ordering_term_list) {
-        sort_descriptor->append(TupleElementDescriptor { .order = term->order() });
-        has_ordering = true;
+    // Split the WHERE clause into its conjuncts, and apply each conjunct as soon as
+    // all of the tables it references are available in the pipeline.
+    Vector<NonnullRefPtr<Expression const>> conjuncts;
+    if (where_clause())
+        collect_conjuncts(*where_clause(), conjuncts);
+
+    Vector<Vector<NonnullRefPtr<Expression const>>> scan_predicates;
+    Vector<Vector<NonnullRefPtr<Expression const>>> join_predicates;
+    Vector<NonnullRefPtr<Expression const>> final_predicates;
+    TRY(scan_predicates.try_resize(max<size_t>(tables.size(), 1)));
+    TRY(join_predicates.try_resize(max<size_t>(tables.size(), 1)));
+
+    for (auto& conjunct : conjuncts) {
+        auto references = referenced_tables(*conjunct, tables);
+        if (!references.has_value())
+            TRY(final_predicates.try_append(move(conjunct)));
+        else if (references->first == references->last)
+            TRY(scan_predicates[references->first].try_append(move(conjunct)));
+        else
+            TRY(join_predicates[references->last].try_append(move(conjunct)));
     }
-    Tuple sort_key(sort_descriptor);
 
-    for (auto& row : rows) {
-        context.current_row = &row;
+    auto apply_predicates = [](NonnullOwnPtr<Operator> input, Vector<NonnullRefPtr<Expression const>>& predicates) -> ResultOr<NonnullOwnPtr<Operator>> {
+        for (auto& predicate : predicates)
+            input = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) Filter(move(input), move(predicate))));
+        return input;
+    };
 
-        if (where_clause()) {
-            auto where_result = TRY(where_clause()->evaluate(context)).to_bool();
-            if (!where_result.has_value() || !where_result.value())
-                continue;
-        }
+    NonnullOwnPtr<Operator> pipeline = tables.is_empty()
+        ? TRY(apply_predicates(TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) SingleRow)), scan_predicates[0]))
+        : TRY(plan_joins(context, tables, move(scan_predicates), move(join_predicates)));
 
-        tuple.clear();
+    pipeline = TRY(apply_predicates(move(pipeline), final_predicates));
 
-        for (auto& col : columns) {
-            auto value = TRY(col->expression()->evaluate(context));
-            tuple.append(value);
-        }
+    if (m_group_by_clause || !aggregates.is_empty()) {
+        // Without any input rows, the aggregates of a SELECT without a GROUP BY clause are
+        // computed over a single row of NULL values.
+        auto empty_row_descriptor = adopt_ref(*new TupleDescriptor);
+        for (auto const& table : tables)
+            empty_row_descriptor->extend(*table->to_tuple_descriptor());
 
-        if (has_ordering) {
-            sort_key.clear();
-            for (auto& term : m_ordering_term_list) {
-                auto value = TRY(term->expression()->evaluate(context));
-                sort_key.append(value);
-            }
-        }
+        Vector<NonnullRefPtr<Expression>> group_by;
+        if (m_group_by_clause)
+            group_by = m_group_by_clause->group_by_list();
+
+        context.aggregates.clear();
+        TRY(context.aggregates.try_ensure_capacity(aggregates.size()));
+        for (auto const& aggregate : aggregates)
+            context.aggregates.unchecked_append(aggregate.ptr());
 
-        result.insert_row(tuple, sort_key);
+        pipeline = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) HashAggregate(move(pipeline), move(group_by), move(aggregates), move(empty_row_descriptor))));
+
+        if (m_group_by_clause && m_group_by_clause->having_clause())
+            pipeline = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) Filter(move(pipeline), *m_group_by_clause->having_clause())));
     }
 
-    if (m_limit_clause != nullptr) {
-        size_t limit_value = NumericLimits<size_t>::max();
-        size_t offset_value = 0;
+    size_t limit_value = NumericLimits<size_t>::max();
+    size_t offset_value = 0;
 
+    if (m_limit_clause != nullptr) {
         auto limit = TRY(m_limit_clause->limit_expression()->evaluate(context));
         if (!limit.is_null()) {
             auto limit_value_maybe = limit.to_int<size_t>();
@@ -173,8 +357,48 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
                 offset_value = offset_value_maybe.value();
             }
         }
+    }
+
+    if (!m_ordering_term_list.is_empty()) {
+        // With a LIMIT, only the rows up to the last one which is produced have to be sorted.
+        if (limit_value != NumericLimits<size_t>::max() && !Checked<size_t>::addition_would_overflow(offset_value, limit_value))
+            pipeline = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) TopN(move(pipeline), m_ordering_term_list, offset_value + limit_value)));
+        else
+            pipeline = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) Sort(move(pipeline), m_ordering_term_list)));
+    }
+
+    if (m_limit_clause != nullptr)
+        pipeline = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) Limit(move(pipeline), offset_value, limit_value)));
+
+    return TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) Project(move(pipeline), move(columns))));
+}
+
+ResultOr<NonnullOwnPtr<Operator>> Select::plan(ExecutionContext& context) const
+{
+    Vector<DeprecatedString> column_names;
+    return build_pipeline(context, column_names);
+}
+
+ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
+{
+    Vector<DeprecatedString> column_names;
+    auto pipeline = TRY(build_pipeline(context, column_names));
+
+    ResultSet result { SQLCommand::Select, move(column_names) };
+
+    Tuple row;
+    while (TRY(pipeline->next(context, row))) {
+        result.insert_row(row, {});
+
+        if (context.on_result_batch && result.size() >= context.result_batch_size) {
+            TRY((*context.on_result_batch)(result));
+            result.clear();
+        }
+    }
 
-        result.limit(offset_value, limit_value);
+    if (context.on_result_batch && !result.is_empty()) {
+        TRY((*context.on_result_batch)(result));
+        result.clear();
     }
 
     return result;
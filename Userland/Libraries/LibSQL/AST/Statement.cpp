@@ -7,6 +7,7 @@
 #include <LibSQL/AST/AST.h>
 #include <LibSQL/Database.h>
 #include <LibSQL/Meta.h>
+#include <LibSQL/Operator.h>
 #include <LibSQL/Row.h>
 
 namespace SQL::AST {
@@ -22,4 +23,22 @@ ResultOr<ResultSet> Statement::execute(AK::NonnullRefPtr<Database> database, Rea
     return result;
 }
 
+ResultOr<ResultSet> Statement::execute(AK::NonnullRefPtr<Database> database, ReadonlySpan<Value> placeholder_values, size_t batch_size, ResultBatchCallback on_batch) const
+{
+    VERIFY(batch_size > 0);
+
+    ExecutionContext context { move(database), this, placeholder_values, nullptr, &on_batch, batch_size };
+    auto result = TRY(execute(context));
+
+    // FIXME: When transactional sessions are supported, don't auto-commit modifications.
+    TRY(context.database->commit());
+
+    return result;
+}
+
+ResultOr<NonnullOwnPtr<Operator>> Statement::plan(ExecutionContext&) const
+{
+    return Result { SQLCommand::Unknown, SQLErrorCode::NotYetImplemented, "Only SELECT, UPDATE, and DELETE statements can be explained"sv };
+}
+
 }
@@ -7,29 +7,39 @@
 #include <LibSQL/AST/AST.h>
 #include <LibSQL/Database.h>
 #include <LibSQL/Meta.h>
+#include <LibSQL/Operator.h>
+#include <LibSQL/Planner.h>
 #include <LibSQL/Row.h>
 
 namespace SQL::AST {
 
-ResultOr<ResultSet> Update::execute(ExecutionContext& context) const
+ResultOr<NonnullOwnPtr<Operator>> Update::plan(ExecutionContext& context) const
 {
     auto const& schema_name = m_qualified_table_name->schema_name();
     auto const& table_name = m_qualified_table_name->table_name();
     auto table_def = TRY(context.database->get_table(schema_name, table_name));
 
-    Vector<Row> matched_rows;
+    Vector<NonnullRefPtr<Expression const>> predicates;
+    if (auto const& where_clause = this->where_clause())
+        collect_conjuncts(*where_clause, predicates);
 
-    for (auto& table_row : TRY(context.database->select_all(*table_def))) {
-        context.current_row = &table_row;
+    return plan_table_access(context, move(table_def), move(predicates));
+}
 
-        if (auto const& where_clause = this->where_clause()) {
-            auto where_result = TRY(where_clause->evaluate(context)).to_bool();
-            if (!where_result.has_value() || !where_result.value())
-                continue;
-        }
+ResultOr<ResultSet> Update::execute(ExecutionContext& context) const
+{
+    auto const& schema_name = m_qualified_table_name->schema_name();
+    auto const& table_name = m_qualified_table_name->table_name();
+    auto table_def = TRY(context.database->get_table(schema_name, table_name));
 
-        TRY(matched_rows.try_append(move(table_row)));
-    }
+    // All matching rows are found before any of them are updated, as updating rows
+    // modifies the indexes of the table while they are being read.
+    auto pipeline = TRY(plan(context));
+    Vector<Row> matched_rows;
+
+    Tuple row;
+    while (TRY(pipeline->next(context, row)))
+        TRY(matched_rows.try_append(TRY(context.database->read_row(*table_def, row.block_index()))));
 
     ResultSet result { SQLCommand::Update };
 
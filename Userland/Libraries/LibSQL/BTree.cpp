@@ -68,6 +68,83 @@ bool BTree::insert(Key const& key)
     return m_root->insert(key);
 }
 
+// Inserts keys which are already in sort order. When the tree is still empty, it is built
+// bottom-up: the keys are packed into leaves from left to right, the key following each
+// leaf moves up as separator, and the separators are packed into the next level the same
+// way until a level fits into the root. Nodes are only filled to three quarters, so that
+// later inserts do not split every node straight away.
+bool BTree::insert_sorted(Vector<Key> keys)
+{
+    if (!m_root)
+        initialize_root();
+
+    if (m_root->size() > 0) {
+        for (auto const& key : keys) {
+            if (!insert(key))
+                return false;
+        }
+        return true;
+    }
+
+    if (keys.is_empty())
+        return true;
+
+    if (!duplicates_allowed()) {
+        for (size_t i = 1; i < keys.size(); ++i) {
+            if (keys[i - 1] == keys[i])
+                return false;
+        }
+    }
+
+    static constexpr size_t fill_limit = Block::DATA_SIZE * 3 / 4;
+
+    auto entries = move(keys);
+    Vector<Block::Index> children;
+    children.resize(entries.size() + 1);
+
+    while (true) {
+        Vector<Key> separators;
+        Vector<Block::Index> nodes;
+
+        for (size_t first = 0; first < entries.size();) {
+            // A node must not end right before the last entry, since that entry would
+            // then become a separator with an empty node to its right.
+            size_t length = sizeof(u32);
+            size_t end = first;
+            while (end < entries.size()) {
+                auto entry_length = sizeof(u32) + entries[end].length();
+                if (end > first && length + entry_length > fill_limit && end + 1 < entries.size())
+                    break;
+                length += entry_length;
+                ++end;
+            }
+
+            bool is_root = first == 0 && end == entries.size();
+            auto node = make<TreeNode>(*this, is_root ? block_index() : request_new_block_index());
+            node->m_is_leaf = children[first] == 0;
+            for (auto ix = first; ix < end; ++ix) {
+                node->m_entries.append(move(entries[ix]));
+                node->m_down.empend(node.ptr(), children[ix]);
+            }
+            node->m_down.empend(node.ptr(), children[end]);
+            serializer().serialize_and_write(*node);
+
+            if (is_root) {
+                m_root = move(node);
+                return true;
+            }
+
+            nodes.append(node->block_index());
+            if (end < entries.size())
+                separators.append(move(entries[end]));
+            first = end + 1;
+        }
+
+        entries = move(separators);
+        children = move(nodes);
+    }
+}
+
 bool BTree::update_key_pointer(Key const& key)
 {
     if (!m_root)
@@ -98,6 +175,28 @@ BTreeIterator BTree::find(Key const& key)
     return end();
 }
 
+BTreeIterator BTree::lower_bound(Key const& key)
+{
+    if (!m_root)
+        initialize_root();
+
+    // Walk down the tree, remembering the leftmost entry not less than the key on
+    // every level. Entries further down are always smaller than the one remembered
+    // one level up, so the last remembered entry is the lower bound.
+    auto result = end();
+    for (auto* node = m_root.ptr(); node;) {
+        size_t ix = 0;
+        while (ix < node->size() && (*node)[ix] < key)
+            ix++;
+        if (ix < node->size())
+            result = BTreeIterator(node, (int)ix);
+        if (node->is_leaf())
+            break;
+        node = node->down_node(ix);
+    }
+    return result;
+}
+
 void BTree::list_tree()
 {
     if (!m_root)
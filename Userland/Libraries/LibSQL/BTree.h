@@ -99,9 +99,11 @@ public:
 
     Block::Index root() const { return m_root ? m_root->block_index() : 0; }
     bool insert(Key const&);
+    bool insert_sorted(Vector<Key>);
     bool update_key_pointer(Key const&);
     Optional<u32> get(Key&);
     BTreeIterator find(Key const& key);
+    BTreeIterator lower_bound(Key const& key);
     BTreeIterator begin();
     static BTreeIterator end();
     void list_tree();
@@ -125,6 +127,7 @@ public:
     [[nodiscard]] bool is_end() const { return m_where == Where::End; }
     [[nodiscard]] size_t index() const { return m_index; }
     bool update(Key const&);
+    void update_block_index(Block::Index);
 
     bool operator==(BTreeIterator const& other) const { return cmp(other) == 0; }
     bool operator!=(BTreeIterator const& other) const { return cmp(other) != 0; }
@@ -234,6 +234,16 @@ bool BTreeIterator::update(Key const& new_value)
     return true;
 }
 
+void BTreeIterator::update_block_index(Block::Index block_index)
+{
+    VERIFY(!is_end());
+    auto& entry = m_current->m_entries[m_index];
+    if (entry.block_index() == block_index)
+        return;
+    entry.set_block_index(block_index);
+    m_current->tree().serializer().serialize_and_write(*m_current);
+}
+
 BTreeIterator& BTreeIterator::operator=(BTreeIterator const& other)
 {
     if (&other != this) {
@@ -5,7 +5,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/DeprecatedString.h>
+#include <AK/QuickSort.h>
+#include <AK/TypeCasts.h>
 #include <LibSQL/BTree.h>
 #include <LibSQL/Database.h>
 #include <LibSQL/Heap.h>
@@ -41,6 +44,11 @@ ResultOr<void> Database::open()
         m_heap->set_table_columns_root(m_table_columns->root());
     };
 
+    m_table_indexes = BTree::construct(m_serializer, IndexDef::index_def()->to_tuple_descriptor(), m_heap->table_indexes_root());
+    m_table_indexes->on_new_root = [&]() {
+        m_heap->set_table_indexes_root(m_table_indexes->root());
+    };
+
     m_open = true;
 
     auto ensure_schema_exists = [&](auto schema_name) -> ResultOr<NonnullRefPtr<SchemaDef>> {
@@ -166,9 +174,113 @@ ResultOr<NonnullRefPtr<TableDef>> Database::get_table(DeprecatedString const& sc
     for (auto it = m_table_columns->find(column_key); !it.is_end() && ((*it)["table_hash"].to_int<u32>() == table_hash); ++it)
         table_def->append_column(*it);
 
+    auto index_key = IndexDef::make_key(table_def);
+    for (auto it = m_table_indexes->find(index_key); !it.is_end() && ((*it)["table_hash"].to_int<u32>() == table_hash); ++it) {
+        auto index_def = IndexDef::construct(table_def, (*it)["index_name"].to_deprecated_string(), (*it)["unique"].to_int<u32>() == 1u, (*it).block_index());
+
+        auto index_hash = index_def->hash();
+        auto index_column_key = ColumnDef::make_key(index_def);
+        for (auto column_it = m_table_columns->find(index_column_key); !column_it.is_end() && ((*column_it)["table_hash"].to_int<u32>() == index_hash); ++column_it)
+            index_def->append_column(*column_it);
+
+        table_def->append_index(move(index_def));
+    }
+
     return table_def;
 }
 
+static Key make_index_key(NonnullRefPtr<TupleDescriptor> const& descriptor, IndexDef const& index, Row const& row)
+{
+    Key key(descriptor);
+    for (size_t i = 0; i < index.size(); ++i)
+        key[i] = row[index.key_definition()[i]->name()];
+    key.set_block_index(row.block_index());
+    return key;
+}
+
+static bool has_null_part(Key const& key)
+{
+    for (size_t i = 0; i < key.size(); ++i) {
+        if (key[i].is_null())
+            return true;
+    }
+    return false;
+}
+
+// Checks that the keys of the rows do not collide with each other. Collisions with keys
+// which are already stored in the index are found by check_unique_constraints().
+static ResultOr<void> check_unique_keys(IndexDef const& index, Vector<Row> const& rows)
+{
+    auto descriptor = index.to_tuple_descriptor();
+
+    Vector<Key> keys;
+    TRY(keys.try_ensure_capacity(rows.size()));
+    for (auto const& row : rows) {
+        auto key = make_index_key(descriptor, index, row);
+        if (!has_null_part(key))
+            keys.unchecked_append(move(key));
+    }
+
+    quick_sort(keys, [](auto const& lhs, auto const& rhs) { return lhs < rhs; });
+    for (size_t i = 1; i < keys.size(); ++i) {
+        if (keys[i - 1] == keys[i])
+            return Result { SQLCommand::Unknown, SQLErrorCode::UniqueConstraintViolated, index.name() };
+    }
+
+    return {};
+}
+
+ResultOr<void> Database::add_index(IndexDef& index)
+{
+    VERIFY(is_open());
+
+    auto& table = verify_cast<TableDef>(*index.parent());
+    VERIFY(m_table_cache.get(table.key().hash()).has_value());
+
+    if (any_of(table.indexes(), [&](auto const& existing) { return existing->name() == index.name(); }))
+        return Result { SQLCommand::Unknown, SQLErrorCode::IndexExists, index.name() };
+
+    auto rows = TRY(select_all(table));
+
+    // The rows which are already stored in the table must not violate the constraint
+    // before the index is registered, since an index can not be removed again.
+    if (index.unique())
+        TRY(check_unique_keys(index, rows));
+
+    if (!m_table_indexes->insert(index.key()))
+        return Result { SQLCommand::Unknown, SQLErrorCode::IndexExists, index.name() };
+
+    for (auto& column : index.key_definition()) {
+        if (!m_table_columns->insert(column->key()))
+            VERIFY_NOT_REACHED();
+    }
+
+    table.append_index(index);
+    TRY(insert_index_keys(index, rows));
+
+    return {};
+}
+
+NonnullRefPtr<BTree> Database::get_index_tree(IndexDef& index)
+{
+    VERIFY(is_open());
+
+    auto index_hash = index.hash();
+    if (auto it = m_index_trees.find(index_hash); it != m_index_trees.end())
+        return it->value;
+
+    // Unique constraints are enforced by check_unique_constraints(), so the tree itself allows
+    // duplicate keys. This lets the key of a removed row remain next to the key of a new row.
+    auto tree = BTree::construct(m_serializer, index.to_tuple_descriptor(), false, index.block_index());
+    tree->on_new_root = [this, &index, tree = tree.ptr()]() {
+        index.set_block_index(tree->root());
+        VERIFY(m_table_indexes->update_key_pointer(index.key()));
+    };
+
+    m_index_trees.set(index_hash, tree);
+    return tree;
+}
+
 ErrorOr<Vector<Row>> Database::select_all(TableDef& table)
 {
     VERIFY(m_table_cache.get(table.key().hash()).has_value());
@@ -178,6 +290,12 @@ ErrorOr<Vector<Row>> Database::select_all(TableDef& table)
     return ret;
 }
 
+ErrorOr<Row> Database::read_row(TableDef& table, Block::Index block_index)
+{
+    VERIFY(m_table_cache.get(table.key().hash()).has_value());
+    return m_serializer.deserialize_block<Row>(block_index, table, block_index);
+}
+
 ErrorOr<Vector<Row>> Database::match(TableDef& table, Key const& key)
 {
     VERIFY(m_table_cache.get(table.key().hash()).has_value());
@@ -194,16 +312,18 @@ ErrorOr<Vector<Row>> Database::match(TableDef& table, Key const& key)
     return ret;
 }
 
-ErrorOr<void> Database::insert(Row& row)
+ResultOr<void> Database::insert(Row& row)
 {
     VERIFY(m_table_cache.get(row.table().key().hash()).has_value());
-    // TODO: implement table constraints such as unique, foreign key, etc.
+    // TODO: implement table constraints such as foreign key, etc.
+    TRY(check_unique_constraints(row, 0));
 
     row.set_block_index(m_heap->request_new_block_index());
     row.set_next_block_index(row.table().block_index());
-    TRY(update(row));
+    TRY(write_row(row));
 
-    // TODO update indexes defined on table.
+    for (auto& index : row.table().indexes())
+        insert_index_key(*index, row);
 
     auto table_key = row.table().key();
     table_key.set_block_index(row.block_index());
@@ -212,11 +332,54 @@ ErrorOr<void> Database::insert(Row& row)
     return {};
 }
 
+// Inserts rows of a single table at once. The constraints are checked for all rows before
+// any of them is written, the rows are stored in consecutive blocks, and the indexes are
+// only updated after all rows have been written.
+ResultOr<void> Database::bulk_insert(Vector<Row>& rows)
+{
+    if (rows.is_empty())
+        return {};
+
+    auto& table = rows.first().table();
+    VERIFY(m_table_cache.get(table.key().hash()).has_value());
+
+    for (auto const& row : rows)
+        TRY(check_unique_constraints(row, 0));
+    for (auto& index : table.indexes()) {
+        if (index->unique())
+            TRY(check_unique_keys(*index, rows));
+    }
+
+    for (auto& row : rows)
+        row.set_block_index(m_heap->request_new_block_index());
+
+    // Every row points to the row inserted before it, just as if the rows were inserted
+    // one by one.
+    auto next_block_index = table.block_index();
+    for (auto& row : rows) {
+        row.set_next_block_index(next_block_index);
+        TRY(write_row(row));
+        next_block_index = row.block_index();
+    }
+
+    for (auto& index : table.indexes())
+        TRY(insert_index_keys(*index, rows));
+
+    auto table_key = table.key();
+    table_key.set_block_index(next_block_index);
+    VERIFY(m_tables->update_key_pointer(table_key));
+    table.set_block_index(next_block_index);
+    return {};
+}
+
 ErrorOr<void> Database::remove(Row& row)
 {
     auto& table = row.table();
     VERIFY(m_table_cache.get(table.key().hash()).has_value());
 
+    for (auto& index : table.indexes())
+        TRY(remove_index_key(*index, row));
+
     TRY(m_heap->free_storage(row.block_index()));
 
     if (table.block_index() == row.block_index()) {
@@ -233,7 +396,7 @@ ErrorOr<void> Database::remove(Row& row)
 
         if (current.next_block_index() == row.block_index()) {
             current.set_next_block_index(row.next_block_index());
-            TRY(update(current));
+            TRY(write_row(current));
             break;
         }
 
@@ -243,16 +406,112 @@ ErrorOr<void> Database::remove(Row& row)
     return {};
 }
 
-ErrorOr<void> Database::update(Row& tuple)
+ResultOr<void> Database::update(Row& row)
 {
-    VERIFY(m_table_cache.get(tuple.table().key().hash()).has_value());
-    // TODO: implement table constraints such as unique, foreign key, etc.
+    auto& table = row.table();
+    VERIFY(m_table_cache.get(table.key().hash()).has_value());
+    // TODO: implement table constraints such as foreign key, etc.
 
+    if (table.num_indexes() > 0) {
+        TRY(check_unique_constraints(row, row.block_index()));
+
+        auto stored_row = TRY(read_row(table, row.block_index()));
+        for (auto& index : table.indexes()) {
+            auto descriptor = index->to_tuple_descriptor();
+            if (make_index_key(descriptor, *index, stored_row) == make_index_key(descriptor, *index, row))
+                continue;
+
+            TRY(remove_index_key(*index, stored_row));
+            insert_index_key(*index, row);
+        }
+    }
+
+    TRY(write_row(row));
+    return {};
+}
+
+ErrorOr<void> Database::write_row(Row& row)
+{
     m_serializer.reset();
-    m_serializer.serialize_and_write<Tuple>(tuple);
+    m_serializer.serialize_and_write<Tuple>(row);
+    return {};
+}
+
+ResultOr<void> Database::check_unique_constraints(Row const& row, Block::Index row_block_index)
+{
+    for (auto& index : row.table().indexes()) {
+        if (!index->unique())
+            continue;
+
+        auto tree = get_index_tree(*index);
+        auto key = make_index_key(tree->descriptor(), *index, row);
+
+        // NULL values are distinct from each other, so they never violate the constraint.
+        if (has_null_part(key))
+            continue;
+
+        for (auto it = tree->lower_bound(key); !it.is_end() && ((*it).compare(key) == 0); ++it) {
+            auto block_index = (*it).block_index();
+            if (block_index != 0 && block_index != row_block_index)
+                return Result { SQLCommand::Unknown, SQLErrorCode::UniqueConstraintViolated, index->name() };
+        }
+    }
+
+    return {};
+}
+
+void Database::insert_index_key(IndexDef& index, Row const& row)
+{
+    auto tree = get_index_tree(index);
+    VERIFY(tree->insert(make_index_key(tree->descriptor(), index, row)));
+}
+
+// Sorts the keys of the rows before they are added to the index, so that an empty index is
+// built bottom-up and consecutive keys of a populated index end up in the same leaves.
+ErrorOr<void> Database::insert_index_keys(IndexDef& index, Vector<Row> const& rows)
+{
+    auto tree = get_index_tree(index);
 
-    // TODO update indexes defined on table.
+    Vector<Key> keys;
+    TRY(keys.try_ensure_capacity(rows.size()));
+    for (auto const& row : rows)
+        keys.unchecked_append(make_index_key(tree->descriptor(), index, row));
+
+    quick_sort(keys, [](auto const& lhs, auto const& rhs) { return lhs < rhs; });
+    VERIFY(tree->insert_sorted(move(keys)));
     return {};
 }
 
+ErrorOr<void> Database::remove_index_key(IndexDef& index, Row const& row)
+{
+    auto tree = get_index_tree(index);
+    auto key = make_index_key(tree->descriptor(), index, row);
+
+    // NULL does not compare equal to anything, so the key is located through its leading
+    // parts which are not NULL, and then identified by the row it points to.
+    auto prefix_descriptor = adopt_ref(*new TupleDescriptor);
+    for (size_t i = 0; i < key.size() && !key[i].is_null(); ++i)
+        prefix_descriptor->append((*key.descriptor())[i]);
+
+    Key prefix(prefix_descriptor);
+    for (size_t i = 0; i < prefix.size(); ++i)
+        prefix[i] = key[i];
+
+    for (auto it = prefix.size() > 0 ? tree->lower_bound(prefix) : tree->begin(); !it.is_end(); ++it) {
+        auto const& entry = *it;
+        if (prefix.size() > 0 ? (entry.compare(prefix) != 0) : !entry[0].is_null())
+            break;
+
+        if (entry.block_index() == row.block_index()) {
+            // FIXME: BTree does not support removing keys yet. Until it does, the key is kept
+            //        as a tombstone which does not point to any row.
+            it.update_block_index(0);
+            return {};
+        }
+    }
+
+    // The index does not agree with the table, e.g. because the heap file was corrupted.
+    return Error::from_string_literal("Database::remove_index_key(): Index has no key for the row");
+}
+
 }
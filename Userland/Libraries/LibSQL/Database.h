@@ -34,6 +34,7 @@ public:
     bool is_open() const { return m_open; }
     ErrorOr<void> commit();
     ErrorOr<size_t> file_size_in_bytes() const { return m_heap->file_size_in_bytes(); }
+    Heap::CacheStatistics const& cache_statistics() const { return m_heap->cache_statistics(); }
 
     ResultOr<void> add_schema(SchemaDef const&);
     static Key get_schema_key(DeprecatedString const&);
@@ -43,24 +44,45 @@ public:
     static Key get_table_key(DeprecatedString const&, DeprecatedString const&);
     ResultOr<NonnullRefPtr<TableDef>> get_table(DeprecatedString const&, DeprecatedString const&);
 
+    ResultOr<void> add_index(IndexDef&);
+    NonnullRefPtr<BTree> get_index_tree(IndexDef&);
+
     ErrorOr<Vector<Row>> select_all(TableDef&);
+    ErrorOr<Row> read_row(TableDef&, Block::Index);
     ErrorOr<Vector<Row>> match(TableDef&, Key const&);
-    ErrorOr<void> insert(Row&);
+    ResultOr<void> insert(Row&);
+    ResultOr<void> bulk_insert(Vector<Row>&);
     ErrorOr<void> remove(Row&);
-    ErrorOr<void> update(Row&);
+    ResultOr<void> update(Row&);
+
+    // The number of bytes of rows which a sort holds in memory before it writes them to a
+    // temporary file.
+    static constexpr size_t default_sort_memory_budget = 16 * MiB;
+    size_t sort_memory_budget() const { return m_sort_memory_budget; }
+    void set_sort_memory_budget(size_t budget) { m_sort_memory_budget = budget; }
 
 private:
     explicit Database(DeprecatedString);
 
+    ErrorOr<void> write_row(Row&);
+    ResultOr<void> check_unique_constraints(Row const&, Block::Index);
+    void insert_index_key(IndexDef&, Row const&);
+    ErrorOr<void> insert_index_keys(IndexDef&, Vector<Row> const&);
+    ErrorOr<void> remove_index_key(IndexDef&, Row const&);
+
     bool m_open { false };
     NonnullRefPtr<Heap> m_heap;
     Serializer m_serializer;
     RefPtr<BTree> m_schemas;
     RefPtr<BTree> m_tables;
     RefPtr<BTree> m_table_columns;
+    RefPtr<BTree> m_table_indexes;
 
     HashMap<u32, NonnullRefPtr<SchemaDef>> m_schema_cache;
     HashMap<u32, NonnullRefPtr<TableDef>> m_table_cache;
+    HashMap<u32, NonnullRefPtr<BTree>> m_index_trees;
+
+    size_t m_sort_memory_budget { default_sort_memory_budget };
 };
 
 }
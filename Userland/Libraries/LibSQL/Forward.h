@@ -21,6 +21,7 @@ class IndexNode;
 class IndexDef;
 class Key;
 class KeyPartDef;
+class Operator;
 class Relation;
 class Result;
 class ResultSet;
@@ -37,6 +38,7 @@ class Value;
 
 namespace SQL::AST {
 class AddColumn;
+class AggregateExpression;
 class AlterTable;
 class ASTNode;
 class BetweenExpression;
@@ -50,6 +52,7 @@ class ColumnDefinition;
 class ColumnNameExpression;
 class CommonTableExpression;
 class CommonTableExpressionList;
+class CreateIndex;
 class CreateTable;
 class Delete;
 class DropColumn;
@@ -57,6 +60,7 @@ class DropTable;
 class ErrorExpression;
 class ErrorStatement;
 class ExistsExpression;
+class Explain;
 class Expression;
 class GroupByClause;
 class InChainedExpression;
@@ -9,11 +9,47 @@
 #include <AK/Format.h>
 #include <AK/QuickSort.h>
 #include <LibCore/System.h>
+#include <LibCrypto/Checksum/CRC32.h>
 #include <LibSQL/Heap.h>
 #include <sys/stat.h>
 
 namespace SQL {
 
+// Every record in the write-ahead log starts with a header holding the record's type, the
+// index of the block it contains, and a CRC32 checksum over the type, the block index and the
+// block's data. Block records are followed by the block's data; commit records have no data.
+enum class WriteAheadLogRecordType : u32 {
+    Block = 0x4b4c4257,
+    Commit = 0x4d4d4357,
+};
+
+static constexpr size_t WRITE_AHEAD_LOG_RECORD_HEADER_SIZE = 3 * sizeof(u32);
+
+static DeprecatedString write_ahead_log_path(DeprecatedString const& heap_path)
+{
+    return DeprecatedString::formatted("{}-wal", heap_path);
+}
+
+static u32 write_ahead_log_checksum(WriteAheadLogRecordType type, Block::Index index, ReadonlyBytes data)
+{
+    Crypto::Checksum::CRC32 checksum;
+    checksum.update({ &type, sizeof(type) });
+    checksum.update({ &index, sizeof(index) });
+    checksum.update(data);
+    return checksum.digest();
+}
+
+static ErrorOr<void> append_write_ahead_log_record(ByteBuffer& records, WriteAheadLogRecordType type, Block::Index index, ReadonlyBytes data)
+{
+    auto checksum = write_ahead_log_checksum(type, index, data);
+
+    TRY(records.try_append(&type, sizeof(type)));
+    TRY(records.try_append(&index, sizeof(index)));
+    TRY(records.try_append(&checksum, sizeof(checksum)));
+    TRY(records.try_append(data));
+    return {};
+}
+
 Heap::Heap(DeprecatedString file_name)
 {
     set_name(move(file_name));
@@ -21,10 +57,18 @@ Heap::Heap(DeprecatedString file_name)
 
 Heap::~Heap()
 {
-    if (m_file && !m_write_ahead_log.is_empty()) {
-        if (auto maybe_error = flush(); maybe_error.is_error())
-            warnln("~Heap({}): {}", name(), maybe_error.error());
+    if (!m_file)
+        return;
+
+    // Once everything has been checkpointed into the heap file, the write-ahead log is no longer needed.
+    if (auto maybe_error = checkpoint(); maybe_error.is_error()) {
+        warnln("~Heap({}): {}", name(), maybe_error.error());
+        return;
     }
+
+    m_write_ahead_log = nullptr;
+    if (auto maybe_error = Core::System::unlink(write_ahead_log_path(name())); maybe_error.is_error())
+        warnln("~Heap({}): {}", name(), maybe_error.error());
 }
 
 ErrorOr<void> Heap::open()
@@ -44,41 +88,86 @@ ErrorOr<void> Heap::open()
     } else {
         file_size = stat_buffer.st_size;
     }
+
+    auto file = TRY(Core::File::open(name(), Core::File::OpenMode::ReadWrite));
+    m_file_fd = file->fd();
+    m_file = TRY(Core::InputBufferedFile::create(move(file)));
+
+    auto log_path = write_ahead_log_path(name());
+    struct stat log_stat_buffer;
+    bool log_existed = stat(log_path.characters(), &log_stat_buffer) == 0;
+
+    // Don't leave a log behind next to a file which could not be opened as a heap.
+    auto close_after_error = [&](Error error) -> Error {
+        m_file = nullptr;
+        m_write_ahead_log = nullptr;
+        m_logged_block_offsets.clear();
+        if (!log_existed)
+            (void)Core::System::unlink(log_path);
+        return error;
+    };
+
+    // Make sure this is a heap file before a log is created next to it. The file ID never
+    // changes once written, so a log can't hold a zero block that would make it valid.
+    if (file_size > 0) {
+        auto zero_block = read_raw_blocks_from_file(0, 1);
+        if (zero_block.is_error())
+            return close_after_error(zero_block.release_error());
+        if (auto error_maybe = verify_file_id(zero_block.value()); error_maybe.is_error())
+            return close_after_error(error_maybe.release_error());
+    }
+
+    // A log left behind next to a heap file which no longer exists does not belong to this heap.
+    if (auto error_maybe = open_write_ahead_log(file_size == 0); error_maybe.is_error())
+        return close_after_error(error_maybe.release_error());
+
+    file_size = TRY(file_size_in_bytes());
     if (file_size > 0) {
         m_next_block = file_size / Block::SIZE;
         m_highest_block_written = m_next_block - 1;
     }
 
-    auto file = TRY(Core::File::open(name(), Core::File::OpenMode::ReadWrite));
-    m_file = TRY(Core::InputBufferedFile::create(move(file)));
-
     if (file_size > 0) {
-        if (auto error_maybe = read_zero_block(); error_maybe.is_error()) {
-            m_file = nullptr;
-            return error_maybe.release_error();
-        }
+        if (auto error_maybe = read_zero_block(); error_maybe.is_error())
+            return close_after_error(error_maybe.release_error());
     } else {
+        // A new heap file is given its zero block right away, since a log next to an empty
+        // heap file is discarded when the heap is opened.
         TRY(initialize_zero_block());
+        TRY(checkpoint());
     }
 
     // FIXME: We should more gracefully handle version incompatibilities. For now, we drop the database.
     if (m_version != VERSION) {
         dbgln_if(SQL_DEBUG, "Heap file {} opened has incompatible version {}. Deleting for version {}.", name(), m_version, VERSION);
         m_file = nullptr;
+        m_write_ahead_log = nullptr;
+        m_cached_blocks.clear();
+        m_cached_block_slots.clear();
+        m_clock_hand = 0;
+        m_last_read_block.clear();
 
         TRY(Core::System::unlink(name()));
         return open();
     }
 
-    // Perform a heap scan to find all free blocks
+    // Perform a heap scan to find all free blocks. The blocks are read directly from the file,
+    // since caching them would only evict the blocks which are going to be used.
     // FIXME: this is very inefficient; store free blocks in a persistent heap structure
-    for (Block::Index index = 1; index <= m_highest_block_written; ++index) {
-        auto block_data = TRY(read_raw_block(index));
-        auto size_in_bytes = *reinterpret_cast<u32*>(block_data.data());
-        if (size_in_bytes == 0)
-            TRY(m_free_block_indices.try_append(index));
+    for (Block::Index first_index = 1; first_index <= m_highest_block_written; first_index += READ_AHEAD_BLOCKS) {
+        auto count = min<size_t>(READ_AHEAD_BLOCKS, m_highest_block_written - first_index + 1);
+        auto blocks = TRY(read_raw_blocks_from_file(first_index, count));
+
+        for (size_t i = 0; i < count; ++i) {
+            auto size_in_bytes = *reinterpret_cast<u32*>(blocks.offset_pointer(i * Block::SIZE));
+            if (size_in_bytes == 0)
+                TRY(m_free_block_indices.try_append(first_index + i));
+        }
     }
 
+    // The zero block is updated whenever one of the roots changes, so it is kept in the cache.
+    TRY(pin_block(0));
+
     dbgln_if(SQL_DEBUG, "Heap file {} opened; number of blocks = {}; free blocks = {}", name(), m_highest_block_written, m_free_block_indices.size());
     return {};
 }
@@ -86,12 +175,18 @@ ErrorOr<void> Heap::open()
 ErrorOr<size_t> Heap::file_size_in_bytes() const
 {
     TRY(m_file->seek(0, SeekMode::FromEndPosition));
-    return TRY(m_file->tell());
+    auto file_size = TRY(m_file->tell());
+
+    // Blocks which are only in the write-ahead log are added to the file by the next checkpoint.
+    for (auto const& logged_block : m_logged_block_offsets)
+        file_size = max(file_size, (static_cast<size_t>(logged_block.key) + 1) * Block::SIZE);
+
+    return file_size;
 }
 
 bool Heap::has_block(Block::Index index) const
 {
-    return (index <= m_highest_block_written || m_write_ahead_log.contains(index))
+    return (index <= m_highest_block_written || m_cached_block_slots.contains(index) || m_logged_block_offsets.contains(index))
         && !m_free_block_indices.contains_slow(index);
 }
 
@@ -171,11 +266,56 @@ ErrorOr<ByteBuffer> Heap::read_raw_block(Block::Index index)
     VERIFY(m_file);
     VERIFY(index < m_next_block);
 
-    if (auto wal_entry = m_write_ahead_log.get(index); wal_entry.has_value())
-        return wal_entry.value();
+    auto previous_block = m_last_read_block;
+    m_last_read_block = index;
 
-    TRY(m_file->seek(index * Block::SIZE, SeekMode::SetPosition));
-    auto buffer = TRY(ByteBuffer::create_uninitialized(Block::SIZE));
+    if (auto* cached_block = find_cached_block(index)) {
+        ++m_cache_statistics.hits;
+        cached_block->is_referenced = true;
+        return cached_block->data;
+    }
+    ++m_cache_statistics.misses;
+
+    if (m_logged_block_offsets.contains(index)) {
+        auto data = TRY(read_block_from_write_ahead_log(index));
+        TRY(cache_block({ .index = index, .data = data, .is_referenced = true }));
+        return data;
+    }
+
+    // If the previous block read was adjacent to this one, blocks are likely being read in
+    // sequence, so the blocks which follow in the same direction are read along with it.
+    Block::Index first_index = index;
+    size_t count = 1;
+    if (previous_block.has_value() && *previous_block + 1 == index && index < m_highest_block_written) {
+        count = min<size_t>(READ_AHEAD_BLOCKS, m_highest_block_written - index + 1);
+    } else if (previous_block.has_value() && *previous_block == index + 1 && index > 1) {
+        first_index = index - min<size_t>(READ_AHEAD_BLOCKS - 1, index - 1);
+        count = index - first_index + 1;
+    }
+
+    auto blocks = TRY(read_raw_blocks_from_file(first_index, count));
+
+    for (size_t i = 0; i < count; ++i) {
+        auto block_index = static_cast<Block::Index>(first_index + i);
+        if (block_index == index || m_cached_block_slots.contains(block_index) || m_logged_block_offsets.contains(block_index))
+            continue;
+
+        auto data = TRY(blocks.slice(i * Block::SIZE, Block::SIZE));
+        TRY(cache_block({ .index = block_index, .data = move(data) }));
+        ++m_cache_statistics.blocks_read_ahead;
+    }
+
+    auto data = TRY(blocks.slice((index - first_index) * Block::SIZE, Block::SIZE));
+    TRY(cache_block({ .index = index, .data = data, .is_referenced = true }));
+    return data;
+}
+
+ErrorOr<ByteBuffer> Heap::read_raw_blocks_from_file(Block::Index first_index, size_t count)
+{
+    VERIFY(m_file);
+
+    TRY(m_file->seek(first_index * Block::SIZE, SeekMode::SetPosition));
+    auto buffer = TRY(ByteBuffer::create_uninitialized(count * Block::SIZE));
     TRY(m_file->read_until_filled(buffer));
     return buffer;
 }
@@ -208,17 +348,121 @@ ErrorOr<void> Heap::write_raw_block(Block::Index index, ReadonlyBytes data)
     return {};
 }
 
-ErrorOr<void> Heap::write_raw_block_to_wal(Block::Index index, ByteBuffer&& data)
+ErrorOr<void> Heap::write_raw_block_to_cache(Block::Index index, ByteBuffer&& data)
 {
     dbgln_if(SQL_DEBUG, "{}({})", __FUNCTION__, index);
     VERIFY(index < m_next_block);
     VERIFY(data.size() == Block::SIZE);
 
-    TRY(m_write_ahead_log.try_set(index, move(data)));
+    if (auto* cached_block = find_cached_block(index)) {
+        cached_block->data = move(data);
+        cached_block->is_dirty = true;
+        cached_block->is_referenced = true;
+        return {};
+    }
+
+    return cache_block({ .index = index, .data = move(data), .is_dirty = true, .is_referenced = true });
+}
+
+Heap::CachedBlock* Heap::find_cached_block(Block::Index index)
+{
+    auto slot = m_cached_block_slots.get(index);
+    if (!slot.has_value())
+        return nullptr;
+    return &m_cached_blocks[*slot];
+}
 
+ErrorOr<void> Heap::cache_block(CachedBlock block)
+{
+    VERIFY(!m_cached_block_slots.contains(block.index));
+    auto index = block.index;
+
+    if (m_cached_blocks.size() >= m_cache_capacity) {
+        if (auto slot = TRY(evict_block()); slot.has_value()) {
+            m_cached_blocks[*slot] = move(block);
+            TRY(m_cached_block_slots.try_set(index, *slot));
+            return {};
+        }
+    }
+
+    // If all cached blocks are pinned, the cache grows beyond its capacity.
+    TRY(m_cached_blocks.try_append(move(block)));
+    TRY(m_cached_block_slots.try_set(index, m_cached_blocks.size() - 1));
     return {};
 }
 
+ErrorOr<Optional<size_t>> Heap::evict_block()
+{
+    // The clock hand clears the reference bit of every block it passes, so every unpinned
+    // block is evicted once the hand has gone around twice.
+    for (size_t i = 0; i < 2 * m_cached_blocks.size(); ++i) {
+        auto slot = m_clock_hand;
+        m_clock_hand = (m_clock_hand + 1) % m_cached_blocks.size();
+
+        auto& block = m_cached_blocks[slot];
+        if (block.pin_count > 0)
+            continue;
+        if (block.is_referenced) {
+            block.is_referenced = false;
+            continue;
+        }
+
+        // Evicted blocks are logged without a commit record, so they are discarded by
+        // recovery unless the transaction they are part of is committed.
+        if (block.is_dirty) {
+            ByteBuffer record;
+            TRY(append_block_record(record, block.index, block.data));
+            TRY(append_to_write_ahead_log(record));
+            m_has_uncommitted_records = true;
+        }
+
+        m_cached_block_slots.remove(block.index);
+        ++m_cache_statistics.evictions;
+        return Optional<size_t> { slot };
+    }
+
+    return Optional<size_t> {};
+}
+
+ErrorOr<void> Heap::set_cache_capacity(size_t capacity)
+{
+    VERIFY(capacity > 0);
+    m_cache_capacity = capacity;
+
+    while (m_cached_blocks.size() > m_cache_capacity) {
+        auto slot = TRY(evict_block());
+        if (!slot.has_value())
+            break;
+
+        auto last_block = m_cached_blocks.take_last();
+        if (*slot < m_cached_blocks.size()) {
+            m_cached_block_slots.set(last_block.index, *slot);
+            m_cached_blocks[*slot] = move(last_block);
+        }
+
+        if (m_clock_hand >= m_cached_blocks.size())
+            m_clock_hand = 0;
+    }
+
+    return {};
+}
+
+ErrorOr<void> Heap::pin_block(Block::Index index)
+{
+    if (!m_cached_block_slots.contains(index))
+        (void)TRY(read_raw_block(index));
+
+    ++find_cached_block(index)->pin_count;
+    return {};
+}
+
+void Heap::unpin_block(Block::Index index)
+{
+    auto* cached_block = find_cached_block(index);
+    VERIFY(cached_block && cached_block->pin_count > 0);
+    --cached_block->pin_count;
+}
+
 ErrorOr<void> Heap::write_block(Block const& block)
 {
     dbgln_if(SQL_DEBUG, "{}({})", __FUNCTION__, block.index());
@@ -236,7 +480,7 @@ ErrorOr<void> Heap::write_block(Block const& block)
 
     block.data().bytes().copy_to(heap_data.bytes().slice(Block::HEADER_SIZE));
 
-    return write_raw_block_to_wal(block.index(), move(heap_data));
+    return write_raw_block_to_cache(block.index(), move(heap_data));
 }
 
 ErrorOr<void> Heap::free_storage(Block::Index index)
@@ -262,44 +506,203 @@ ErrorOr<void> Heap::free_block(Block const& block)
 
     // Zero out freed blocks to facilitate a free block scan upon opening the database later
     auto zeroed_data = TRY(ByteBuffer::create_zeroed(Block::SIZE));
-    TRY(write_raw_block_to_wal(index, move(zeroed_data)));
+    TRY(write_raw_block_to_cache(index, move(zeroed_data)));
 
     return m_free_block_indices.try_append(index);
 }
 
 ErrorOr<void> Heap::flush()
+{
+    TRY(commit_dirty_blocks());
+
+    if (m_logged_block_offsets.size() >= CHECKPOINT_THRESHOLD)
+        TRY(checkpoint_committed_blocks());
+    return {};
+}
+
+ErrorOr<void> Heap::checkpoint()
+{
+    TRY(commit_dirty_blocks());
+    return checkpoint_committed_blocks();
+}
+
+ErrorOr<void> Heap::commit_dirty_blocks()
 {
     VERIFY(m_file);
-    auto indices = m_write_ahead_log.keys();
+
+    Vector<size_t> dirty_slots;
+    for (size_t slot = 0; slot < m_cached_blocks.size(); ++slot) {
+        if (m_cached_blocks[slot].is_dirty)
+            TRY(dirty_slots.try_append(slot));
+    }
+
+    if (dirty_slots.is_empty() && !m_has_uncommitted_records)
+        return {};
+
+    quick_sort(dirty_slots, [&](auto lhs, auto rhs) { return m_cached_blocks[lhs].index < m_cached_blocks[rhs].index; });
+
+    ByteBuffer records;
+    for (auto slot : dirty_slots) {
+        auto const& block = m_cached_blocks[slot];
+        dbgln_if(SQL_DEBUG, "Logging block {}", block.index);
+        TRY(append_block_record(records, block.index, block.data));
+    }
+    TRY(append_write_ahead_log_record(records, WriteAheadLogRecordType::Commit, 0, {}));
+    TRY(append_to_write_ahead_log(records));
+
+    for (auto slot : dirty_slots)
+        m_cached_blocks[slot].is_dirty = false;
+    m_has_uncommitted_records = false;
+    m_write_ahead_log_needs_sync = true;
+
+    return sync_write_ahead_log();
+}
+
+ErrorOr<void> Heap::sync_write_ahead_log()
+{
+    if (!m_write_ahead_log_needs_sync)
+        return {};
+
+    TRY(Core::System::fsync(m_write_ahead_log->fd()));
+    m_write_ahead_log_needs_sync = false;
+    return {};
+}
+
+ErrorOr<void> Heap::checkpoint_committed_blocks()
+{
+    VERIFY(!m_has_uncommitted_records);
+    if (m_write_ahead_log_size == 0)
+        return {};
+
+    // The log has to be durable before the heap file is changed, so that an interrupted
+    // checkpoint can be completed by recovery.
+    TRY(sync_write_ahead_log());
+
+    auto indices = m_logged_block_offsets.keys();
     quick_sort(indices);
     for (auto index : indices) {
-        dbgln_if(SQL_DEBUG, "Flushing block {}", index);
-        auto& data = m_write_ahead_log.get(index).value();
+        dbgln_if(SQL_DEBUG, "Checkpointing block {}", index);
+        auto data = TRY(read_block_from_write_ahead_log(index));
         TRY(write_raw_block(index, data));
     }
-    m_write_ahead_log.clear();
-    dbgln_if(SQL_DEBUG, "WAL flushed; new number of blocks = {}", m_highest_block_written);
+    TRY(Core::System::fsync(m_file_fd));
+
+    TRY(Core::System::ftruncate(m_write_ahead_log->fd(), 0));
+    m_write_ahead_log_size = 0;
+    m_logged_block_offsets.clear();
+
+    dbgln_if(SQL_DEBUG, "Write-ahead log checkpointed; new number of blocks = {}", m_highest_block_written);
     return {};
 }
 
+ErrorOr<void> Heap::open_write_ahead_log(bool discard_existing_log)
+{
+    m_write_ahead_log = TRY(Core::File::open(write_ahead_log_path(name()), Core::File::OpenMode::ReadWrite));
+    m_write_ahead_log_size = 0;
+    m_logged_block_offsets.clear();
+    m_has_uncommitted_records = false;
+    m_write_ahead_log_needs_sync = false;
+
+    if (discard_existing_log)
+        return Core::System::ftruncate(m_write_ahead_log->fd(), 0);
+    return recover_from_write_ahead_log();
+}
+
+ErrorOr<void> Heap::recover_from_write_ahead_log()
+{
+    TRY(m_write_ahead_log->seek(0, SeekMode::SetPosition));
+    auto log = TRY(m_write_ahead_log->read_until_eof());
+    m_write_ahead_log_size = log.size();
+
+    // Records are replayed up to the last commit record. A record which fails its checksum was
+    // only partially written, so neither it nor anything after it was committed.
+    HashMap<Block::Index, u64> uncommitted_block_offsets;
+    size_t committed_transactions = 0;
+    size_t offset = 0;
+
+    while (offset + WRITE_AHEAD_LOG_RECORD_HEADER_SIZE <= log.size()) {
+        WriteAheadLogRecordType type;
+        Block::Index index;
+        u32 checksum;
+        memcpy(&type, log.offset_pointer(offset), sizeof(type));
+        memcpy(&index, log.offset_pointer(offset + sizeof(type)), sizeof(index));
+        memcpy(&checksum, log.offset_pointer(offset + sizeof(type) + sizeof(index)), sizeof(checksum));
+
+        if (type != WriteAheadLogRecordType::Block && type != WriteAheadLogRecordType::Commit)
+            break;
+
+        size_t data_size = type == WriteAheadLogRecordType::Block ? Block::SIZE : 0;
+        if (offset + WRITE_AHEAD_LOG_RECORD_HEADER_SIZE + data_size > log.size())
+            break;
+
+        auto data = log.bytes().slice(offset + WRITE_AHEAD_LOG_RECORD_HEADER_SIZE, data_size);
+        if (checksum != write_ahead_log_checksum(type, index, data))
+            break;
+
+        if (type == WriteAheadLogRecordType::Block) {
+            TRY(uncommitted_block_offsets.try_set(index, offset));
+        } else {
+            for (auto const& block_offset : uncommitted_block_offsets)
+                TRY(m_logged_block_offsets.try_set(block_offset.key, block_offset.value));
+            uncommitted_block_offsets.clear();
+            ++committed_transactions;
+        }
+
+        offset += WRITE_AHEAD_LOG_RECORD_HEADER_SIZE + data_size;
+    }
+
+    dbgln_if(SQL_DEBUG, "Recovered {} transactions with {} blocks from the write-ahead log of {}", committed_transactions, m_logged_block_offsets.size(), name());
+    return checkpoint_committed_blocks();
+}
+
+ErrorOr<void> Heap::append_to_write_ahead_log(ReadonlyBytes records)
+{
+    TRY(m_write_ahead_log->seek(m_write_ahead_log_size, SeekMode::SetPosition));
+    TRY(m_write_ahead_log->write_until_depleted(records));
+    m_write_ahead_log_size += records.size();
+    return {};
+}
+
+// Appends a block record to `records`, which are going to be appended to the log next.
+ErrorOr<void> Heap::append_block_record(ByteBuffer& records, Block::Index index, ReadonlyBytes data)
+{
+    TRY(m_logged_block_offsets.try_set(index, m_write_ahead_log_size + records.size()));
+    return append_write_ahead_log_record(records, WriteAheadLogRecordType::Block, index, data);
+}
+
+ErrorOr<ByteBuffer> Heap::read_block_from_write_ahead_log(Block::Index index)
+{
+    auto offset = m_logged_block_offsets.get(index).value();
+
+    TRY(m_write_ahead_log->seek(offset + WRITE_AHEAD_LOG_RECORD_HEADER_SIZE, SeekMode::SetPosition));
+    auto buffer = TRY(ByteBuffer::create_uninitialized(Block::SIZE));
+    TRY(m_write_ahead_log->read_until_filled(buffer));
+    return buffer;
+}
+
 constexpr static auto FILE_ID = "SerenitySQL "sv;
 constexpr static auto VERSION_OFFSET = FILE_ID.length();
 constexpr static auto SCHEMAS_ROOT_OFFSET = VERSION_OFFSET + sizeof(u32);
 constexpr static auto TABLES_ROOT_OFFSET = SCHEMAS_ROOT_OFFSET + sizeof(u32);
 constexpr static auto TABLE_COLUMNS_ROOT_OFFSET = TABLES_ROOT_OFFSET + sizeof(u32);
-constexpr static auto USER_VALUES_OFFSET = TABLE_COLUMNS_ROOT_OFFSET + sizeof(u32);
+constexpr static auto TABLE_INDEXES_ROOT_OFFSET = TABLE_COLUMNS_ROOT_OFFSET + sizeof(u32);
+constexpr static auto USER_VALUES_OFFSET = TABLE_INDEXES_ROOT_OFFSET + sizeof(u32);
+
+ErrorOr<void> Heap::verify_file_id(ReadonlyBytes zero_block) const
+{
+    if (zero_block.size() < FILE_ID.length() || StringView { zero_block.trim(FILE_ID.length()) } != FILE_ID) {
+        warnln("{}: Zero page corrupt. This is probably not a {} heap file"sv, name(), FILE_ID);
+        return Error::from_string_literal("Heap()::read_zero_block(): Zero page corrupt. This is probably not a SerenitySQL heap file");
+    }
+    return {};
+}
 
 ErrorOr<void> Heap::read_zero_block()
 {
     dbgln_if(SQL_DEBUG, "Read zero block from {}", name());
 
     auto block = TRY(read_raw_block(0));
-    auto file_id_buffer = TRY(block.slice(0, FILE_ID.length()));
-    auto file_id = StringView(file_id_buffer);
-    if (file_id != FILE_ID) {
-        warnln("{}: Zero page corrupt. This is probably not a {} heap file"sv, name(), FILE_ID);
-        return Error::from_string_literal("Heap()::read_zero_block(): Zero page corrupt. This is probably not a SerenitySQL heap file");
-    }
+    TRY(verify_file_id(block));
 
     memcpy(&m_version, block.offset_pointer(VERSION_OFFSET), sizeof(u32));
     dbgln_if(SQL_DEBUG, "Version: {}.{}", (m_version & 0xFFFF0000) >> 16, (m_version & 0x0000FFFF));
@@ -313,6 +716,9 @@ ErrorOr<void> Heap::read_zero_block()
     memcpy(&m_table_columns_root, block.offset_pointer(TABLE_COLUMNS_ROOT_OFFSET), sizeof(u32));
     dbgln_if(SQL_DEBUG, "Table columns root node: {}", m_table_columns_root);
 
+    memcpy(&m_table_indexes_root, block.offset_pointer(TABLE_INDEXES_ROOT_OFFSET), sizeof(u32));
+    dbgln_if(SQL_DEBUG, "Table indexes root node: {}", m_table_indexes_root);
+
     memcpy(m_user_values.data(), block.offset_pointer(USER_VALUES_OFFSET), m_user_values.size() * sizeof(u32));
     for (auto ix = 0u; ix < m_user_values.size(); ix++) {
         if (m_user_values[ix])
@@ -328,6 +734,7 @@ ErrorOr<void> Heap::update_zero_block()
     dbgln_if(SQL_DEBUG, "Schemas root node: {}", m_schemas_root);
     dbgln_if(SQL_DEBUG, "Tables root node: {}", m_tables_root);
     dbgln_if(SQL_DEBUG, "Table Columns root node: {}", m_table_columns_root);
+    dbgln_if(SQL_DEBUG, "Table Indexes root node: {}", m_table_indexes_root);
     for (auto ix = 0u; ix < m_user_values.size(); ix++) {
         if (m_user_values[ix] > 0)
             dbgln_if(SQL_DEBUG, "User value {}: {}", ix, m_user_values[ix]);
@@ -340,9 +747,10 @@ ErrorOr<void> Heap::update_zero_block()
     buffer_bytes.overwrite(SCHEMAS_ROOT_OFFSET, &m_schemas_root, sizeof(u32));
     buffer_bytes.overwrite(TABLES_ROOT_OFFSET, &m_tables_root, sizeof(u32));
     buffer_bytes.overwrite(TABLE_COLUMNS_ROOT_OFFSET, &m_table_columns_root, sizeof(u32));
+    buffer_bytes.overwrite(TABLE_INDEXES_ROOT_OFFSET, &m_table_indexes_root, sizeof(u32));
     buffer_bytes.overwrite(USER_VALUES_OFFSET, m_user_values.data(), m_user_values.size() * sizeof(u32));
 
-    return write_raw_block_to_wal(0, move(buffer));
+    return write_raw_block_to_cache(0, move(buffer));
 }
 
 ErrorOr<void> Heap::initialize_zero_block()
@@ -351,6 +759,7 @@ ErrorOr<void> Heap::initialize_zero_block()
     m_schemas_root = 0;
     m_tables_root = 0;
     m_table_columns_root = 0;
+    m_table_indexes_root = 0;
     m_next_block = 1;
     for (auto& user : m_user_values)
         user = 0u;
@@ -11,6 +11,7 @@
 #include <AK/Debug.h>
 #include <AK/DeprecatedString.h>
 #include <AK/HashMap.h>
+#include <AK/Optional.h>
 #include <AK/Vector.h>
 #include <LibCore/File.h>
 #include <LibCore/Object.h>
@@ -63,12 +64,45 @@ private:
  *
  * A Heap can be thought of the backing storage of a single database. It's
  * assumed that a single SQL database is backed by a single Heap.
+ *
+ * Blocks are read and written through a cache which holds a bounded number of
+ * blocks in memory. Written blocks are kept in the cache as dirty blocks until
+ * the Heap is flushed, or until they are evicted to make room for other blocks.
+ * Blocks are evicted using the CLOCK algorithm, which approximates evicting the
+ * least recently used block. Pinned blocks are never evicted. When consecutive
+ * blocks are read, as happens while scanning a table, the blocks following them
+ * are read into the cache ahead of time.
+ *
+ * Changes are made durable through a write-ahead log, which is kept in a file
+ * next to the heap file. Flushing the Heap commits a transaction: all dirty
+ * blocks are appended to the log, followed by a commit record, and the log is
+ * synced to disk. The heap file itself is only written when the log is
+ * checkpointed, which copies the logged blocks into the heap file once the log
+ * has grown large enough. Every record in the log carries a checksum, so that a
+ * record which was only partially written before a crash is detected. When the
+ * Heap is opened, the blocks of all committed transactions in the log are copied
+ * into the heap file, and anything logged after the last commit is discarded.
+ *
+ * Syncing the log can be deferred by a short delay, so that transactions which
+ * are committed in quick succession (for example by several clients of
+ * SQLServer) share a single sync. Transactions which were committed during the
+ * delay may be lost in a crash, but the heap is never left inconsistent.
  */
 class Heap : public Core::Object {
     C_OBJECT(Heap);
 
 public:
-    static constexpr u32 VERSION = 4;
+    static constexpr u32 VERSION = 5;
+    static constexpr size_t DEFAULT_CACHE_CAPACITY = 1024;
+    static constexpr size_t READ_AHEAD_BLOCKS = 8;
+    static constexpr size_t CHECKPOINT_THRESHOLD = 1024;
+
+    struct CacheStatistics {
+        u64 hits { 0 };
+        u64 misses { 0 };
+        u64 evictions { 0 };
+        u64 blocks_read_ahead { 0 };
+    };
 
     virtual ~Heap() override;
 
@@ -101,6 +135,14 @@ public:
         m_table_columns_root = root;
         update_zero_block().release_value_but_fixme_should_propagate_errors();
     }
+
+    Block::Index table_indexes_root() const { return m_table_indexes_root; }
+
+    void set_table_indexes_root(Block::Index root)
+    {
+        m_table_indexes_root = root;
+        update_zero_block().release_value_but_fixme_should_propagate_errors();
+    }
     u32 version() const { return m_version; }
 
     u32 user_value(size_t index) const
@@ -118,33 +160,81 @@ public:
     ErrorOr<void> write_storage(Block::Index, ReadonlyBytes);
     ErrorOr<void> free_storage(Block::Index);
 
+    // A flush syncs the write-ahead log before it returns, so a successful flush is durable.
     ErrorOr<void> flush();
+    ErrorOr<void> checkpoint();
+
+    // The capacity of the cache is given in blocks.
+    size_t cache_capacity() const { return m_cache_capacity; }
+    ErrorOr<void> set_cache_capacity(size_t);
+    CacheStatistics const& cache_statistics() const { return m_cache_statistics; }
+
+    // A pinned block stays in the cache until it is unpinned as often as it was pinned.
+    ErrorOr<void> pin_block(Block::Index);
+    void unpin_block(Block::Index);
 
 private:
+    struct CachedBlock {
+        Block::Index index { 0 };
+        ByteBuffer data;
+        u32 pin_count { 0 };
+        bool is_dirty { false };
+        bool is_referenced { false };
+    };
+
     explicit Heap(DeprecatedString);
 
     ErrorOr<ByteBuffer> read_raw_block(Block::Index);
+    ErrorOr<ByteBuffer> read_raw_blocks_from_file(Block::Index first_index, size_t count);
     ErrorOr<void> write_raw_block(Block::Index, ReadonlyBytes);
-    ErrorOr<void> write_raw_block_to_wal(Block::Index, ByteBuffer&&);
+    ErrorOr<void> write_raw_block_to_cache(Block::Index, ByteBuffer&&);
+
+    ErrorOr<void> open_write_ahead_log(bool discard_existing_log);
+    ErrorOr<void> recover_from_write_ahead_log();
+    ErrorOr<void> append_to_write_ahead_log(ReadonlyBytes records);
+    ErrorOr<void> append_block_record(ByteBuffer& records, Block::Index, ReadonlyBytes data);
+    ErrorOr<ByteBuffer> read_block_from_write_ahead_log(Block::Index);
+    ErrorOr<void> commit_dirty_blocks();
+    ErrorOr<void> sync_write_ahead_log();
+    ErrorOr<void> checkpoint_committed_blocks();
+
+    CachedBlock* find_cached_block(Block::Index);
+    ErrorOr<void> cache_block(CachedBlock);
+    ErrorOr<Optional<size_t>> evict_block();
 
     ErrorOr<Block> read_block(Block::Index);
     ErrorOr<void> write_block(Block const&);
     ErrorOr<void> free_block(Block const&);
 
+    ErrorOr<void> verify_file_id(ReadonlyBytes zero_block) const;
     ErrorOr<void> read_zero_block();
     ErrorOr<void> initialize_zero_block();
     ErrorOr<void> update_zero_block();
 
     OwnPtr<Core::InputBufferedFile> m_file;
+    int m_file_fd { -1 };
     Block::Index m_highest_block_written { 0 };
     Block::Index m_next_block { 1 };
     Block::Index m_schemas_root { 0 };
     Block::Index m_tables_root { 0 };
     Block::Index m_table_columns_root { 0 };
+    Block::Index m_table_indexes_root { 0 };
     u32 m_version { VERSION };
     Array<u32, 16> m_user_values { 0 };
-    HashMap<Block::Index, ByteBuffer> m_write_ahead_log;
     Vector<Block::Index> m_free_block_indices;
+
+    Vector<CachedBlock> m_cached_blocks;
+    HashMap<Block::Index, size_t> m_cached_block_slots;
+    size_t m_cache_capacity { DEFAULT_CACHE_CAPACITY };
+    size_t m_clock_hand { 0 };
+    Optional<Block::Index> m_last_read_block;
+    CacheStatistics m_cache_statistics;
+
+    OwnPtr<Core::File> m_write_ahead_log;
+    u64 m_write_ahead_log_size { 0 };
+    HashMap<Block::Index, u64> m_logged_block_offsets;
+    bool m_has_uncommitted_records { false };
+    bool m_write_ahead_log_needs_sync { false };
 };
 
 }
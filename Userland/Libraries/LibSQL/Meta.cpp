@@ -71,10 +71,10 @@ void ColumnDef::set_default_value(Value const& default_value)
     m_default = default_value;
 }
 
-Key ColumnDef::make_key(TableDef const& table_def)
+Key ColumnDef::make_key(Relation const& relation)
 {
     Key key(index_def());
-    key["table_hash"] = table_def.key().hash();
+    key["table_hash"] = relation.key().hash();
     return key;
 }
 
@@ -114,6 +114,14 @@ void IndexDef::append_column(DeprecatedString name, SQLType sql_type, Order sort
     m_key_definition.append(part);
 }
 
+void IndexDef::append_column(Key const& column)
+{
+    auto column_type = column["column_type"].to_int<UnderlyingType<SQLType>>();
+    VERIFY(column_type.has_value());
+
+    append_column(column["column_name"].to_deprecated_string(), static_cast<SQLType>(*column_type));
+}
+
 NonnullRefPtr<TupleDescriptor> IndexDef::to_tuple_descriptor() const
 {
     NonnullRefPtr<TupleDescriptor> ret = adopt_ref(*new TupleDescriptor);
@@ -129,6 +137,7 @@ Key IndexDef::key() const
     key["table_hash"] = parent_relation()->key().hash();
     key["index_name"] = name();
     key["unique"] = unique() ? 1 : 0;
+    key.set_block_index(block_index());
     return key;
 }
 
@@ -189,6 +198,12 @@ void TableDef::append_column(Key const& column)
     append_column(column["column_name"].to_deprecated_string(), static_cast<SQLType>(*column_type));
 }
 
+void TableDef::append_index(NonnullRefPtr<IndexDef> index)
+{
+    VERIFY(index->parent() == this);
+    m_indexes.append(move(index));
+}
+
 Key TableDef::make_key(SchemaDef const& schema_def)
 {
     return TableDef::make_key(schema_def.key());
@@ -0,0 +1,834 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibSQL/Database.h>
+#include <LibSQL/Meta.h>
+#include <LibSQL/Operator.h>
+#include <LibSQL/Row.h>
+
+namespace SQL {
+
+// Writes the concatenation of `left` and `right` into `row`. Once `row` has the shape
+// of the concatenation, the values are overwritten in place to avoid rebuilding the
+// tuple's descriptor for every produced row.
+static void concatenate_into(Tuple& row, Tuple const& left, Tuple const& right)
+{
+    if (row.size() != left.size() + right.size()) {
+        row = left;
+        row.extend(right);
+        return;
+    }
+
+    for (size_t i = 0; i < left.size(); ++i)
+        row[i] = left[i];
+    for (size_t i = 0; i < right.size(); ++i)
+        row[left.size() + i] = right[i];
+}
+
+// Moves the values of a row read from the heap into `row`. The descriptor of a row read
+// from the heap does not know which table it belongs to, so the row is produced with the
+// table's descriptor instead.
+static void move_table_row_into(Tuple& row, NonnullRefPtr<TupleDescriptor> const& descriptor, Row& table_row)
+{
+    if (row.size() != descriptor->size())
+        row = Tuple { descriptor };
+
+    auto values = table_row.take_data();
+    VERIFY(values.size() == row.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+        row[i] = move(values[i]);
+    row.set_block_index(table_row.block_index());
+}
+
+ErrorOr<void> Operator::explain(Vector<DeprecatedString>& lines, size_t depth) const
+{
+    TRY(lines.try_append(DeprecatedString::formatted("{}{}", DeprecatedString::repeated(' ', depth * 2), description())));
+
+    for (auto const* input : inputs())
+        TRY(input->explain(lines, depth + 1));
+
+    return {};
+}
+
+ResultOr<bool> SingleRow::next(AST::ExecutionContext&, Tuple& row)
+{
+    if (m_exhausted)
+        return false;
+    m_exhausted = true;
+
+    auto descriptor = adopt_ref(*new TupleDescriptor);
+    descriptor->empend("__unity__"sv);
+    row = Tuple { descriptor };
+    row[0] = Value { true };
+    return true;
+}
+
+ResultOr<bool> TableScan::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!m_started) {
+        m_next_block_index = m_table->block_index();
+        m_started = true;
+    }
+
+    if (m_next_block_index == 0)
+        return false;
+
+    auto table_row = TRY(context.database->read_row(*m_table, m_next_block_index));
+    m_next_block_index = table_row.next_block_index();
+
+    move_table_row_into(row, m_descriptor, table_row);
+    return true;
+}
+
+DeprecatedString TableScan::description() const
+{
+    return DeprecatedString::formatted("TableScan {}.{}", m_table->parent()->name(), m_table->name());
+}
+
+ResultOr<bool> IndexScan::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!m_iterator.has_value()) {
+        auto tree = context.database->get_index_tree(*m_index);
+
+        if (m_lower_bound.has_value()) {
+            auto descriptor = adopt_ref(*new TupleDescriptor);
+            descriptor->append(tree->descriptor()->first());
+
+            Key key(descriptor);
+            key[0] = m_lower_bound->value;
+            m_iterator = tree->lower_bound(key);
+        } else {
+            m_iterator = tree->begin();
+        }
+    }
+
+    for (; !m_iterator->is_end(); ++(*m_iterator)) {
+        auto const& entry = **m_iterator;
+
+        if (m_upper_bound.has_value()) {
+            auto comparison = entry[0].compare(m_upper_bound->value);
+            if (comparison > 0 || (comparison == 0 && !m_upper_bound->is_inclusive)) {
+                m_iterator = BTree::end();
+                break;
+            }
+        }
+
+        if (m_lower_bound.has_value() && !m_lower_bound->is_inclusive && entry[0].compare(m_lower_bound->value) == 0)
+            continue;
+
+        // Keys of removed rows remain in the index without pointing to a row.
+        if (entry.block_index() == 0)
+            continue;
+
+        auto table_row = TRY(context.database->read_row(*m_table, entry.block_index()));
+        ++(*m_iterator);
+
+        move_table_row_into(row, m_descriptor, table_row);
+        return true;
+    }
+
+    return false;
+}
+
+DeprecatedString IndexScan::description() const
+{
+    auto const& column_name = m_index->key_definition().first()->name();
+
+    auto format_value = [](Value const& value) {
+        if (value.type() == SQLType::Text)
+            return DeprecatedString::formatted("'{}'", value);
+        return value.to_deprecated_string();
+    };
+
+    StringBuilder builder;
+    builder.appendff("IndexScan {}.{} USING {}", m_table->parent()->name(), m_table->name(), m_index->name());
+
+    if (m_lower_bound.has_value() && m_upper_bound.has_value() && m_lower_bound->is_inclusive && m_upper_bound->is_inclusive && m_lower_bound->value == m_upper_bound->value) {
+        builder.appendff(" ({} = {})", column_name, format_value(m_lower_bound->value));
+    } else if (m_lower_bound.has_value() || m_upper_bound.has_value()) {
+        builder.append(" ("sv);
+        if (m_lower_bound.has_value())
+            builder.appendff("{} {} {}", column_name, m_lower_bound->is_inclusive ? ">="sv : ">"sv, format_value(m_lower_bound->value));
+        if (m_lower_bound.has_value() && m_upper_bound.has_value())
+            builder.append(" AND "sv);
+        if (m_upper_bound.has_value())
+            builder.appendff("{} {} {}", column_name, m_upper_bound->is_inclusive ? "<="sv : "<"sv, format_value(m_upper_bound->value));
+        builder.append(')');
+    }
+
+    return builder.to_deprecated_string();
+}
+
+ResultOr<bool> Filter::next(AST::ExecutionContext& context, Tuple& row)
+{
+    while (TRY(m_input->next(context, row))) {
+        context.current_row = &row;
+
+        auto result = TRY(m_predicate->evaluate(context)).to_bool();
+        if (result.has_value() && result.value())
+            return true;
+    }
+
+    return false;
+}
+
+ResultOr<bool> NestedLoopJoin::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!m_inner_materialized) {
+        Tuple inner_row;
+        while (TRY(m_inner->next(context, inner_row)))
+            TRY(m_inner_rows.try_append(inner_row));
+        m_inner_materialized = true;
+    }
+
+    if (m_inner_rows.is_empty())
+        return false;
+
+    if (!m_has_outer_row || m_inner_index == m_inner_rows.size()) {
+        m_has_outer_row = TRY(m_outer->next(context, m_outer_row));
+        if (!m_has_outer_row)
+            return false;
+        m_inner_index = 0;
+    }
+
+    concatenate_into(row, m_outer_row, m_inner_rows[m_inner_index++]);
+    return true;
+}
+
+// Evaluates a join key against a row. NULL is not equal to any value, so rows with a NULL key
+// never take part in an equi-join.
+static ResultOr<Optional<Value>> evaluate_join_key(AST::ExecutionContext& context, AST::ColumnNameExpression const& key, Tuple& row)
+{
+    context.current_row = &row;
+
+    auto value = TRY(key.evaluate(context));
+    if (value.is_null())
+        return Optional<Value> {};
+    return value;
+}
+
+// Numbers are hashed by their nearest integer, since integers and floats compare equal to
+// each other, and the values of an INTEGER column may be stored as either.
+static u32 join_key_hash(Value const& value)
+{
+    switch (value.type()) {
+    case SQLType::Integer:
+    case SQLType::Float:
+        if (auto integer = value.to_int<i64>(); integer.has_value())
+            return u64_hash(static_cast<u64>(*integer));
+        return 0;
+    default:
+        return value.hash();
+    }
+}
+
+static DeprecatedString describe_join(StringView name, AST::ColumnNameExpression const& outer_key, AST::ColumnNameExpression const& inner_key)
+{
+    auto describe_column = [](AST::ColumnNameExpression const& column) {
+        if (column.table_name().is_empty())
+            return column.column_name();
+        return DeprecatedString::formatted("{}.{}", column.table_name(), column.column_name());
+    };
+
+    return DeprecatedString::formatted("{} ON {} = {}", name, describe_column(outer_key), describe_column(inner_key));
+}
+
+ResultOr<void> HashJoin::build(AST::ExecutionContext& context)
+{
+    Vector<Tuple> outer_rows;
+    Vector<Tuple> inner_rows;
+    Tuple outer_row;
+    Tuple inner_row;
+
+    while (true) {
+        if (!TRY(m_outer->next(context, outer_row))) {
+            m_build_is_outer = true;
+            break;
+        }
+        TRY(outer_rows.try_append(outer_row));
+
+        if (!TRY(m_inner->next(context, inner_row))) {
+            m_build_is_outer = false;
+            break;
+        }
+        TRY(inner_rows.try_append(inner_row));
+    }
+
+    m_build_rows = move(m_build_is_outer ? outer_rows : inner_rows);
+    m_buffered_probe_rows = move(m_build_is_outer ? inner_rows : outer_rows);
+
+    auto const& build_key = m_build_is_outer ? m_outer_key : m_inner_key;
+
+    for (size_t i = 0; i < m_build_rows.size(); ++i) {
+        auto key = TRY(evaluate_join_key(context, *build_key, m_build_rows[i]));
+        if (!key.has_value())
+            continue;
+
+        auto& bucket = m_hash_table.ensure(join_key_hash(*key));
+        TRY(bucket.try_append(i));
+    }
+
+    return {};
+}
+
+ResultOr<bool> HashJoin::next_probe_row(AST::ExecutionContext& context)
+{
+    if (m_buffered_probe_position < m_buffered_probe_rows.size()) {
+        m_probe_row = move(m_buffered_probe_rows[m_buffered_probe_position++]);
+        return true;
+    }
+
+    if (m_probe_exhausted)
+        return false;
+
+    auto& probe_input = m_build_is_outer ? m_inner : m_outer;
+    if (!TRY(probe_input->next(context, m_probe_row))) {
+        m_probe_exhausted = true;
+        return false;
+    }
+
+    return true;
+}
+
+ResultOr<bool> HashJoin::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!m_built) {
+        TRY(build(context));
+        m_built = true;
+    }
+
+    // Without any rows to build the hash table from, no rows can be joined.
+    if (m_build_rows.is_empty())
+        return false;
+
+    while (true) {
+        if (m_matches != nullptr && m_match_position < m_matches->size()) {
+            auto const& build_row = m_build_rows[m_matches->at(m_match_position++)];
+
+            if (m_build_is_outer)
+                concatenate_into(row, build_row, m_probe_row);
+            else
+                concatenate_into(row, m_probe_row, build_row);
+            return true;
+        }
+
+        if (!TRY(next_probe_row(context)))
+            return false;
+
+        m_matches = nullptr;
+        m_match_position = 0;
+
+        auto key = TRY(evaluate_join_key(context, m_build_is_outer ? *m_inner_key : *m_outer_key, m_probe_row));
+        if (!key.has_value())
+            continue;
+
+        if (auto bucket = m_hash_table.find(join_key_hash(*key)); bucket != m_hash_table.end())
+            m_matches = &bucket->value;
+    }
+}
+
+DeprecatedString HashJoin::description() const
+{
+    return describe_join("HashJoin"sv, *m_outer_key, *m_inner_key);
+}
+
+ResultOr<void> MergeJoin::advance_outer(AST::ExecutionContext& context)
+{
+    while ((m_has_outer_row = TRY(m_outer->next(context, m_outer_row)))) {
+        if (auto key = TRY(evaluate_join_key(context, *m_outer_key, m_outer_row)); key.has_value()) {
+            m_outer_key_value = key.release_value();
+            break;
+        }
+    }
+
+    return {};
+}
+
+ResultOr<void> MergeJoin::advance_inner(AST::ExecutionContext& context)
+{
+    while ((m_has_inner_row = TRY(m_inner->next(context, m_inner_row)))) {
+        if (auto key = TRY(evaluate_join_key(context, *m_inner_key, m_inner_row)); key.has_value()) {
+            m_inner_key_value = key.release_value();
+            break;
+        }
+    }
+
+    return {};
+}
+
+ResultOr<bool> MergeJoin::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!m_started) {
+        TRY(advance_outer(context));
+        TRY(advance_inner(context));
+        m_started = true;
+    }
+
+    while (true) {
+        if (m_joining_group) {
+            if (m_group_position < m_inner_group.size()) {
+                concatenate_into(row, m_outer_row, m_inner_group[m_group_position++]);
+                return true;
+            }
+
+            TRY(advance_outer(context));
+            m_joining_group = false;
+        }
+
+        if (!m_has_outer_row)
+            return false;
+
+        // Consecutive outer rows with the same key are joined with the same group of inner rows.
+        if (!m_inner_group.is_empty() && m_outer_key_value.compare(m_inner_group_key_value) == 0) {
+            m_group_position = 0;
+            m_joining_group = true;
+            continue;
+        }
+
+        m_inner_group.clear_with_capacity();
+
+        while (m_has_inner_row && m_inner_key_value.compare(m_outer_key_value) < 0)
+            TRY(advance_inner(context));
+        if (!m_has_inner_row)
+            return false;
+
+        if (m_inner_key_value.compare(m_outer_key_value) > 0) {
+            TRY(advance_outer(context));
+            continue;
+        }
+
+        m_inner_group_key_value = m_inner_key_value;
+        while (m_has_inner_row && m_inner_key_value.compare(m_inner_group_key_value) == 0) {
+            TRY(m_inner_group.try_append(m_inner_row));
+            TRY(advance_inner(context));
+        }
+
+        m_group_position = 0;
+        m_joining_group = true;
+    }
+}
+
+DeprecatedString MergeJoin::description() const
+{
+    return describe_join("MergeJoin"sv, *m_outer_key, *m_inner_key);
+}
+
+unsigned HashAggregate::GroupKeyTraits::hash(Vector<Value> const& key)
+{
+    u32 hash = 0;
+    for (auto const& value : key)
+        hash = pair_int_hash(hash, value.is_null() ? 0 : join_key_hash(value));
+    return hash;
+}
+
+bool HashAggregate::GroupKeyTraits::equals(Vector<Value> const& lhs, Vector<Value> const& rhs)
+{
+    VERIFY(lhs.size() == rhs.size());
+
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs[i].is_null() || rhs[i].is_null()) {
+            if (lhs[i].is_null() != rhs[i].is_null())
+                return false;
+        } else if (lhs[i].compare(rhs[i]) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Folds the argument of an aggregate, evaluated against the current row, into its state.
+// NULL arguments are ignored by all aggregates, so only COUNT(*) counts rows with NULLs.
+static ResultOr<void> accumulate_aggregate(AST::ExecutionContext& context, AST::AggregateExpression const& aggregate, Value& value, double& sum, size_t& count)
+{
+    if (!aggregate.argument()) {
+        ++count;
+        return {};
+    }
+
+    auto argument = TRY(aggregate.argument()->evaluate(context));
+    if (argument.is_null())
+        return {};
+
+    switch (aggregate.function()) {
+    case AST::AggregateFunction::Count:
+        break;
+    case AST::AggregateFunction::Sum:
+        value = TRY((count == 0 ? Value { 0 } : value).add(argument));
+        break;
+    case AST::AggregateFunction::Avg: {
+        auto number = argument.to_double();
+        if (!number.has_value())
+            return Result { SQLCommand::Select, SQLErrorCode::NumericOperatorTypeMismatch, "AVG"sv };
+        sum += *number;
+        break;
+    }
+    case AST::AggregateFunction::Min:
+        if (count == 0 || argument.compare(value) < 0)
+            value = move(argument);
+        break;
+    case AST::AggregateFunction::Max:
+        if (count == 0 || argument.compare(value) > 0)
+            value = move(argument);
+        break;
+    }
+
+    ++count;
+    return {};
+}
+
+static Value aggregate_result(AST::AggregateFunction function, Value const& value, double sum, size_t count)
+{
+    if (function == AST::AggregateFunction::Count)
+        return Value { static_cast<i64>(count) };
+    if (count == 0)
+        return Value {};
+    if (function == AST::AggregateFunction::Avg)
+        return Value { sum / static_cast<double>(count) };
+    return value;
+}
+
+ResultOr<void> HashAggregate::append_group(Tuple const& row)
+{
+    Group group { row, {} };
+    TRY(group.states.try_resize(m_aggregates.size()));
+    TRY(m_groups.try_append(move(group)));
+    return {};
+}
+
+ResultOr<void> HashAggregate::materialize(AST::ExecutionContext& context)
+{
+    Tuple row;
+    Vector<Value> key;
+
+    while (TRY(m_input->next(context, row))) {
+        context.current_row = &row;
+
+        key.clear_with_capacity();
+        for (auto const& expression : m_group_by)
+            TRY(key.try_append(TRY(expression->evaluate(context))));
+
+        size_t group_index = m_groups.size();
+        if (auto it = m_group_indices.find(key); it != m_group_indices.end()) {
+            group_index = it->value;
+        } else {
+            TRY(append_group(row));
+            TRY(m_group_indices.try_set(key, group_index));
+        }
+
+        auto& group = m_groups[group_index];
+        for (size_t i = 0; i < m_aggregates.size(); ++i) {
+            auto& state = group.states[i];
+            TRY(accumulate_aggregate(context, *m_aggregates[i], state.value, state.sum, state.count));
+        }
+    }
+
+    if (m_groups.is_empty() && m_group_by.is_empty())
+        TRY(append_group(Tuple { m_empty_row_descriptor }));
+
+    m_group_indices.clear();
+    return {};
+}
+
+ResultOr<bool> HashAggregate::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!m_materialized) {
+        TRY(materialize(context));
+        m_materialized = true;
+    }
+
+    if (m_position == m_groups.size())
+        return false;
+
+    auto const& group = m_groups[m_position++];
+
+    // The values of the aggregates are appended to a fresh descriptor, since the descriptor
+    // of the group's row is shared with the rows of the input.
+    auto descriptor = adopt_ref(*new TupleDescriptor);
+    descriptor->extend(*group.row.descriptor());
+    for (size_t i = 0; i < m_aggregates.size(); ++i)
+        descriptor->append({ .type = SQLType::Null });
+
+    row = Tuple { descriptor, group.row.block_index() };
+    for (size_t i = 0; i < group.row.size(); ++i)
+        row[i] = group.row[i];
+    for (size_t i = 0; i < m_aggregates.size(); ++i) {
+        auto const& state = group.states[i];
+        row[group.row.size() + i] = aggregate_result(m_aggregates[i]->function(), state.value, state.sum, state.count);
+    }
+
+    return true;
+}
+
+// Heaps of indices are kept in a Vector, with the index for which `comes_first` holds
+// against all others at the front.
+template<typename ComesFirst>
+static void sift_up(Vector<size_t>& heap, size_t position, ComesFirst comes_first)
+{
+    while (position > 0) {
+        auto parent = (position - 1) / 2;
+        if (!comes_first(heap[position], heap[parent]))
+            break;
+
+        swap(heap[position], heap[parent]);
+        position = parent;
+    }
+}
+
+template<typename ComesFirst>
+static void sift_down(Vector<size_t>& heap, size_t position, ComesFirst comes_first)
+{
+    while (true) {
+        auto first = position;
+        auto left = 2 * position + 1;
+        auto right = left + 1;
+
+        if (left < heap.size() && comes_first(heap[left], heap[first]))
+            first = left;
+        if (right < heap.size() && comes_first(heap[right], heap[first]))
+            first = right;
+        if (first == position)
+            return;
+
+        swap(heap[position], heap[first]);
+        position = first;
+    }
+}
+
+static NonnullRefPtr<TupleDescriptor> sort_key_descriptor(Vector<NonnullRefPtr<AST::OrderingTerm>> const& ordering_terms)
+{
+    auto descriptor = adopt_ref(*new TupleDescriptor);
+    for (auto const& term : ordering_terms)
+        descriptor->append(TupleElementDescriptor { .order = term->order() });
+    return descriptor;
+}
+
+static ResultOr<void> evaluate_sort_key(AST::ExecutionContext& context, Vector<NonnullRefPtr<AST::OrderingTerm>> const& ordering_terms, Tuple& row, Tuple& sort_key)
+{
+    context.current_row = &row;
+
+    sort_key.clear();
+    for (auto const& term : ordering_terms)
+        sort_key.append(TRY(term->expression()->evaluate(context)));
+
+    return {};
+}
+
+ResultOr<void> Sort::materialize(AST::ExecutionContext& context)
+{
+    auto memory_budget = context.database->sort_memory_budget();
+    size_t memory_used = 0;
+
+    Tuple row;
+    Tuple sort_key(sort_key_descriptor(m_ordering_terms));
+
+    while (TRY(m_input->next(context, row))) {
+        TRY(evaluate_sort_key(context, m_ordering_terms, row, sort_key));
+
+        memory_used += row.length() + sort_key.length();
+        TRY(m_rows.try_append({ row, sort_key }));
+
+        if (memory_used > memory_budget) {
+            TRY(spill_rows());
+            memory_used = 0;
+        }
+    }
+
+    if (m_runs.is_empty())
+        return sort_rows();
+
+    // Once rows have been spilled, the rows which are left over form the last run.
+    if (!m_rows.is_empty())
+        TRY(spill_rows());
+
+    return start_merge();
+}
+
+ResultOr<void> Sort::sort_rows()
+{
+    m_order.clear_with_capacity();
+    TRY(m_order.try_ensure_capacity(m_rows.size()));
+    for (size_t i = 0; i < m_rows.size(); ++i)
+        m_order.unchecked_append(i);
+
+    quick_sort(m_order, [&](auto lhs, auto rhs) {
+        auto compare = m_rows[lhs].sort_key.compare(m_rows[rhs].sort_key);
+        return compare == 0 ? lhs < rhs : compare < 0;
+    });
+
+    return {};
+}
+
+ResultOr<void> Sort::spill_rows()
+{
+    TRY(sort_rows());
+
+    if (!m_run_row_shape.has_value())
+        m_run_row_shape = m_rows.first();
+
+    TRY(m_runs.try_append(TRY(SortedRun::create(m_rows, m_order))));
+
+    m_rows.clear_with_capacity();
+    m_order.clear_with_capacity();
+    return {};
+}
+
+ResultOr<void> Sort::start_merge()
+{
+    m_rows.clear();
+    m_order.clear();
+
+    TRY(m_run_heads.try_ensure_capacity(m_runs.size()));
+    TRY(m_merge_heap.try_ensure_capacity(m_runs.size()));
+
+    for (size_t i = 0; i < m_runs.size(); ++i) {
+        m_run_heads.unchecked_append(*m_run_row_shape);
+        if (TRY(m_runs[i]->read_next(m_run_heads[i])))
+            m_merge_heap.unchecked_append(i);
+    }
+
+    for (size_t i = m_merge_heap.size() / 2; i-- > 0;)
+        sift_down(m_merge_heap, i, [&](auto lhs, auto rhs) { return merge_comes_first(lhs, rhs); });
+
+    return {};
+}
+
+// Rows of earlier runs were produced earlier by the input, so they come first among
+// rows which compare equal.
+bool Sort::merge_comes_first(size_t lhs_run, size_t rhs_run) const
+{
+    auto compare = m_run_heads[lhs_run].sort_key.compare(m_run_heads[rhs_run].sort_key);
+    return compare == 0 ? lhs_run < rhs_run : compare < 0;
+}
+
+ResultOr<bool> Sort::next_merged_row(Tuple& row)
+{
+    if (m_merge_heap.is_empty())
+        return false;
+
+    auto run = m_merge_heap.first();
+    row = m_run_heads[run].row;
+
+    if (!TRY(m_runs[run]->read_next(m_run_heads[run]))) {
+        m_merge_heap.first() = m_merge_heap.last();
+        m_merge_heap.take_last();
+    }
+
+    sift_down(m_merge_heap, 0, [&](auto lhs, auto rhs) { return merge_comes_first(lhs, rhs); });
+    return true;
+}
+
+ResultOr<bool> Sort::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!m_materialized) {
+        TRY(materialize(context));
+        m_materialized = true;
+    }
+
+    if (!m_runs.is_empty())
+        return next_merged_row(row);
+
+    if (m_position == m_order.size())
+        return false;
+
+    row = m_rows[m_order[m_position++]].row;
+    return true;
+}
+
+ResultOr<void> TopN::materialize(AST::ExecutionContext& context)
+{
+    if (m_count == 0)
+        return {};
+
+    // The front of the heap is the kept row which would be produced last.
+    auto comes_later = [&](auto lhs, auto rhs) {
+        auto compare = m_rows[lhs].sort_key.compare(m_rows[rhs].sort_key);
+        return compare == 0 ? m_sequence_numbers[lhs] > m_sequence_numbers[rhs] : compare > 0;
+    };
+
+    Tuple row;
+    Tuple sort_key(sort_key_descriptor(m_ordering_terms));
+
+    for (size_t sequence_number = 0; TRY(m_input->next(context, row)); ++sequence_number) {
+        TRY(evaluate_sort_key(context, m_ordering_terms, row, sort_key));
+
+        if (m_rows.size() < m_count) {
+            TRY(m_rows.try_append({ row, sort_key }));
+            TRY(m_sequence_numbers.try_append(sequence_number));
+            TRY(m_order.try_append(m_rows.size() - 1));
+            sift_up(m_order, m_order.size() - 1, comes_later);
+            continue;
+        }
+
+        // A row which compares equal to the last kept row was produced after it, so it
+        // would be produced after it as well.
+        auto last = m_order.first();
+        if (sort_key.compare(m_rows[last].sort_key) >= 0)
+            continue;
+
+        m_rows[last] = { row, sort_key };
+        m_sequence_numbers[last] = sequence_number;
+        sift_down(m_order, 0, comes_later);
+    }
+
+    quick_sort(m_order, [&](auto lhs, auto rhs) {
+        return comes_later(rhs, lhs);
+    });
+
+    return {};
+}
+
+ResultOr<bool> TopN::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!m_materialized) {
+        TRY(materialize(context));
+        m_materialized = true;
+    }
+
+    if (m_position == m_order.size())
+        return false;
+
+    row = m_rows[m_order[m_position++]].row;
+    return true;
+}
+
+ResultOr<bool> Limit::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!m_skipped_offset) {
+        for (size_t i = 0; i < m_offset; ++i) {
+            if (!TRY(m_input->next(context, row)))
+                return false;
+        }
+        m_skipped_offset = true;
+    }
+
+    if (m_produced == m_limit)
+        return false;
+
+    if (!TRY(m_input->next(context, row)))
+        return false;
+
+    ++m_produced;
+    return true;
+}
+
+ResultOr<bool> Project::next(AST::ExecutionContext& context, Tuple& row)
+{
+    if (!TRY(m_input->next(context, m_input_row)))
+        return false;
+
+    context.current_row = &m_input_row;
+
+    row.clear();
+    for (auto const& column : m_columns)
+        row.append(TRY(column->expression()->evaluate(context)));
+
+    return true;
+}
+
+}
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibSQL/AST/AST.h>
+#include <LibSQL/BTree.h>
+#include <LibSQL/Forward.h>
+#include <LibSQL/Meta.h>
+#include <LibSQL/Result.h>
+#include <LibSQL/ResultSet.h>
+#include <LibSQL/SortedRun.h>
+#include <LibSQL/Tuple.h>
+
+namespace SQL {
+
+/**
+ * An Operator is a node in the pull-based (Volcano-style) pipeline that is built
+ * to execute a query. Every call to next() produces at most one row, so rows flow
+ * through the pipeline one at a time. Only operators which need to see all of
+ * their input before producing any output (like Sort) materialize rows.
+ */
+class Operator {
+public:
+    virtual ~Operator() = default;
+
+    // Produces the next row into `row`. Returns false once the operator is exhausted.
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) = 0;
+
+    // Appends a line describing this operator to `lines`, followed by the lines of its
+    // inputs, which are indented one level deeper. Used to implement EXPLAIN.
+    ErrorOr<void> explain(Vector<DeprecatedString>& lines, size_t depth = 0) const;
+
+protected:
+    Operator() = default;
+
+    virtual DeprecatedString description() const = 0;
+    virtual Vector<Operator const*> inputs() const { return {}; }
+};
+
+// Produces a single row which does not contain any table columns. Used as the
+// input of a SELECT statement without any tables in its FROM clause.
+class SingleRow final : public Operator {
+public:
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override { return "SingleRow"; }
+
+    bool m_exhausted { false };
+};
+
+// Reads the rows of a table from its heap storage one row at a time.
+class TableScan final : public Operator {
+public:
+    explicit TableScan(NonnullRefPtr<TableDef> table)
+        : m_table(move(table))
+        , m_descriptor(m_table->to_tuple_descriptor())
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override;
+
+    NonnullRefPtr<TableDef> m_table;
+    NonnullRefPtr<TupleDescriptor> m_descriptor;
+    Block::Index m_next_block_index { 0 };
+    bool m_started { false };
+};
+
+// Reads the rows of a table through one of its indexes, in the order of the index. Only
+// rows for which the first column of the index lies within the given bounds are read.
+class IndexScan final : public Operator {
+public:
+    struct Bound {
+        Value value;
+        bool is_inclusive { true };
+    };
+
+    IndexScan(NonnullRefPtr<TableDef> table, NonnullRefPtr<IndexDef> index, Optional<Bound> lower_bound, Optional<Bound> upper_bound)
+        : m_table(move(table))
+        , m_index(move(index))
+        , m_lower_bound(move(lower_bound))
+        , m_upper_bound(move(upper_bound))
+        , m_descriptor(m_table->to_tuple_descriptor())
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override;
+
+    NonnullRefPtr<TableDef> m_table;
+    NonnullRefPtr<IndexDef> m_index;
+    Optional<Bound> m_lower_bound;
+    Optional<Bound> m_upper_bound;
+    NonnullRefPtr<TupleDescriptor> m_descriptor;
+    Optional<BTreeIterator> m_iterator;
+};
+
+// Passes on the rows of its input for which the predicate evaluates to true.
+class Filter final : public Operator {
+public:
+    Filter(NonnullOwnPtr<Operator> input, NonnullRefPtr<AST::Expression const> predicate)
+        : m_input(move(input))
+        , m_predicate(move(predicate))
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override { return "Filter"; }
+    virtual Vector<Operator const*> inputs() const override { return { m_input.ptr() }; }
+
+    NonnullOwnPtr<Operator> m_input;
+    NonnullRefPtr<AST::Expression const> m_predicate;
+};
+
+// Combines every row of the outer input with every row of the inner input. The
+// inner input is read once and buffered, so it is not re-read for every outer row.
+class NestedLoopJoin final : public Operator {
+public:
+    NestedLoopJoin(NonnullOwnPtr<Operator> outer, NonnullOwnPtr<Operator> inner)
+        : m_outer(move(outer))
+        , m_inner(move(inner))
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override { return "NestedLoopJoin"; }
+    virtual Vector<Operator const*> inputs() const override { return { m_outer.ptr(), m_inner.ptr() }; }
+
+    NonnullOwnPtr<Operator> m_outer;
+    NonnullOwnPtr<Operator> m_inner;
+
+    Vector<Tuple> m_inner_rows;
+    bool m_inner_materialized { false };
+
+    Tuple m_outer_row;
+    bool m_has_outer_row { false };
+    size_t m_inner_index { 0 };
+};
+
+// Combines the rows of its inputs for which the values of the given key columns are
+// equal. Both inputs are read alternately until one of them is exhausted. The exhausted,
+// and thus smaller, input is then used to build a hash table, which is probed with the
+// rows of the other input. Rows whose keys merely share a hash bucket are combined as
+// well, so the join condition has to be applied as a filter to the produced rows.
+class HashJoin final : public Operator {
+public:
+    HashJoin(NonnullOwnPtr<Operator> outer, NonnullOwnPtr<Operator> inner, NonnullRefPtr<AST::ColumnNameExpression const> outer_key, NonnullRefPtr<AST::ColumnNameExpression const> inner_key)
+        : m_outer(move(outer))
+        , m_inner(move(inner))
+        , m_outer_key(move(outer_key))
+        , m_inner_key(move(inner_key))
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override;
+    virtual Vector<Operator const*> inputs() const override { return { m_outer.ptr(), m_inner.ptr() }; }
+
+    ResultOr<void> build(AST::ExecutionContext&);
+    ResultOr<bool> next_probe_row(AST::ExecutionContext&);
+
+    NonnullOwnPtr<Operator> m_outer;
+    NonnullOwnPtr<Operator> m_inner;
+    NonnullRefPtr<AST::ColumnNameExpression const> m_outer_key;
+    NonnullRefPtr<AST::ColumnNameExpression const> m_inner_key;
+    bool m_built { false };
+
+    bool m_build_is_outer { false };
+    Vector<Tuple> m_build_rows;
+    HashMap<u32, Vector<size_t>> m_hash_table;
+
+    Vector<Tuple> m_buffered_probe_rows;
+    size_t m_buffered_probe_position { 0 };
+    bool m_probe_exhausted { false };
+
+    Tuple m_probe_row;
+    Vector<size_t> const* m_matches { nullptr };
+    size_t m_match_position { 0 };
+};
+
+// Combines the rows of its inputs for which the values of the given key columns are equal.
+// Both inputs must produce their rows in ascending order of their key column, for example
+// by reading them through an index on that column. Only the rows of the inner input which
+// share the key of the current outer row are buffered.
+class MergeJoin final : public Operator {
+public:
+    MergeJoin(NonnullOwnPtr<Operator> outer, NonnullOwnPtr<Operator> inner, NonnullRefPtr<AST::ColumnNameExpression const> outer_key, NonnullRefPtr<AST::ColumnNameExpression const> inner_key)
+        : m_outer(move(outer))
+        , m_inner(move(inner))
+        , m_outer_key(move(outer_key))
+        , m_inner_key(move(inner_key))
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override;
+    virtual Vector<Operator const*> inputs() const override { return { m_outer.ptr(), m_inner.ptr() }; }
+
+    ResultOr<void> advance_outer(AST::ExecutionContext&);
+    ResultOr<void> advance_inner(AST::ExecutionContext&);
+
+    NonnullOwnPtr<Operator> m_outer;
+    NonnullOwnPtr<Operator> m_inner;
+    NonnullRefPtr<AST::ColumnNameExpression const> m_outer_key;
+    NonnullRefPtr<AST::ColumnNameExpression const> m_inner_key;
+    bool m_started { false };
+
+    Tuple m_outer_row;
+    Value m_outer_key_value;
+    bool m_has_outer_row { false };
+
+    Tuple m_inner_row;
+    Value m_inner_key_value;
+    bool m_has_inner_row { false };
+
+    Vector<Tuple> m_inner_group;
+    Value m_inner_group_key_value;
+    size_t m_group_position { 0 };
+    bool m_joining_group { false };
+};
+
+// Groups the rows of its input by the values of the GROUP BY expressions, and computes
+// the given aggregates for every group. All of the input is read into a hash table of
+// groups before any row is produced. Every produced row is the first input row of its
+// group, followed by the values of the aggregates, in the order in which they were given.
+// The groups are produced in the order in which their first rows were read. Without any
+// GROUP BY expressions, exactly one row is produced, even if the input is empty; that row
+// is then made of NULL values with the given descriptor.
+class HashAggregate final : public Operator {
+public:
+    HashAggregate(NonnullOwnPtr<Operator> input, Vector<NonnullRefPtr<AST::Expression>> group_by, Vector<NonnullRefPtr<AST::AggregateExpression const>> aggregates, NonnullRefPtr<TupleDescriptor> empty_row_descriptor)
+        : m_input(move(input))
+        , m_group_by(move(group_by))
+        , m_aggregates(move(aggregates))
+        , m_empty_row_descriptor(move(empty_row_descriptor))
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    struct AggregateState {
+        Value value;
+        double sum { 0 };
+        size_t count { 0 };
+    };
+
+    struct Group {
+        Tuple row;
+        Vector<AggregateState> states;
+    };
+
+    // NULL values are considered equal to each other when grouping rows.
+    struct GroupKeyTraits : public GenericTraits<Vector<Value>> {
+        static unsigned hash(Vector<Value> const&);
+        static bool equals(Vector<Value> const&, Vector<Value> const&);
+    };
+
+    virtual DeprecatedString description() const override { return "HashAggregate"; }
+    virtual Vector<Operator const*> inputs() const override { return { m_input.ptr() }; }
+
+    ResultOr<void> materialize(AST::ExecutionContext&);
+    ResultOr<void> append_group(Tuple const& row);
+
+    NonnullOwnPtr<Operator> m_input;
+    Vector<NonnullRefPtr<AST::Expression>> m_group_by;
+    Vector<NonnullRefPtr<AST::AggregateExpression const>> m_aggregates;
+    NonnullRefPtr<TupleDescriptor> m_empty_row_descriptor;
+
+    Vector<Group> m_groups;
+    HashMap<Vector<Value>, size_t, GroupKeyTraits> m_group_indices;
+    bool m_materialized { false };
+    size_t m_position { 0 };
+};
+
+// Sorts all rows of its input by the given ordering terms. Rows which compare
+// equal keep the order in which they were produced by the input.
+//
+// Rows are sorted in memory until they exceed the database's sort memory budget. From
+// then on, every time the budget is exceeded, the rows held in memory are sorted and
+// written to a temporary file as a sorted run. The runs are merged once the input is
+// exhausted, so only one row per run is held in memory while rows are produced.
+class Sort final : public Operator {
+public:
+    Sort(NonnullOwnPtr<Operator> input, Vector<NonnullRefPtr<AST::OrderingTerm>> ordering_terms)
+        : m_input(move(input))
+        , m_ordering_terms(move(ordering_terms))
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override { return "Sort"; }
+    virtual Vector<Operator const*> inputs() const override { return { m_input.ptr() }; }
+
+    ResultOr<void> materialize(AST::ExecutionContext&);
+    ResultOr<void> sort_rows();
+    ResultOr<void> spill_rows();
+    ResultOr<void> start_merge();
+    ResultOr<bool> next_merged_row(Tuple& row);
+    bool merge_comes_first(size_t lhs_run, size_t rhs_run) const;
+
+    NonnullOwnPtr<Operator> m_input;
+    Vector<NonnullRefPtr<AST::OrderingTerm>> m_ordering_terms;
+
+    Vector<ResultRow> m_rows;
+    Vector<size_t> m_order;
+    bool m_materialized { false };
+    size_t m_position { 0 };
+
+    Vector<NonnullOwnPtr<SortedRun>> m_runs;
+    Optional<ResultRow> m_run_row_shape;
+    Vector<ResultRow> m_run_heads;
+    Vector<size_t> m_merge_heap;
+};
+
+// Produces the first `count` rows of its input in the order given by the ordering terms,
+// like a Sort followed by a Limit would. Only `count` rows are held in memory: they are
+// kept in a heap whose front is the row which would be produced last, and which is
+// replaced whenever the input produces a row that sorts before it.
+class TopN final : public Operator {
+public:
+    TopN(NonnullOwnPtr<Operator> input, Vector<NonnullRefPtr<AST::OrderingTerm>> ordering_terms, size_t count)
+        : m_input(move(input))
+        , m_ordering_terms(move(ordering_terms))
+        , m_count(count)
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override { return DeprecatedString::formatted("TopN {}", m_count); }
+    virtual Vector<Operator const*> inputs() const override { return { m_input.ptr() }; }
+
+    ResultOr<void> materialize(AST::ExecutionContext&);
+
+    NonnullOwnPtr<Operator> m_input;
+    Vector<NonnullRefPtr<AST::OrderingTerm>> m_ordering_terms;
+    size_t m_count { 0 };
+
+    Vector<ResultRow> m_rows;
+    Vector<size_t> m_sequence_numbers;
+    Vector<size_t> m_order;
+    bool m_materialized { false };
+    size_t m_position { 0 };
+};
+
+// Skips the first `offset` rows of its input and stops pulling rows from its
+// input once `limit` rows have been produced.
+class Limit final : public Operator {
+public:
+    Limit(NonnullOwnPtr<Operator> input, size_t offset, size_t limit)
+        : m_input(move(input))
+        , m_offset(offset)
+        , m_limit(limit)
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override { return "Limit"; }
+    virtual Vector<Operator const*> inputs() const override { return { m_input.ptr() }; }
+
+    NonnullOwnPtr<Operator> m_input;
+    size_t m_offset { 0 };
+    size_t m_limit { 0 };
+    size_t m_produced { 0 };
+    bool m_skipped_offset { false };
+};
+
+// Evaluates the result columns of a SELECT statement against each input row.
+class Project final : public Operator {
+public:
+    Project(NonnullOwnPtr<Operator> input, Vector<NonnullRefPtr<AST::ResultColumn const>> columns)
+        : m_input(move(input))
+        , m_columns(move(columns))
+    {
+    }
+
+    virtual ResultOr<bool> next(AST::ExecutionContext&, Tuple& row) override;
+
+private:
+    virtual DeprecatedString description() const override { return "Project"; }
+    virtual Vector<Operator const*> inputs() const override { return { m_input.ptr() }; }
+
+    NonnullOwnPtr<Operator> m_input;
+    Vector<NonnullRefPtr<AST::ResultColumn const>> m_columns;
+    Tuple m_input_row;
+};
+
+}
@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/TypeCasts.h>
+#include <LibSQL/AST/AST.h>
+#include <LibSQL/Meta.h>
+#include <LibSQL/Operator.h>
+#include <LibSQL/Planner.h>
+#include <math.h>
+
+namespace SQL {
+
+// A parenthesized expression is parsed as a chained expression holding a single expression.
+static AST::Expression const& unwrap_parentheses(AST::Expression const& expression)
+{
+    if (is<AST::ChainedExpression>(expression)) {
+        auto const& chained_expression = static_cast<AST::ChainedExpression const&>(expression);
+        if (chained_expression.expressions().size() == 1)
+            return unwrap_parentheses(*chained_expression.expressions()[0]);
+    }
+
+    return expression;
+}
+
+void collect_conjuncts(AST::Expression const& expression, Vector<NonnullRefPtr<AST::Expression const>>& conjuncts)
+{
+    auto const& unwrapped_expression = unwrap_parentheses(expression);
+
+    if (is<AST::BinaryOperatorExpression>(unwrapped_expression)) {
+        auto const& binary_expression = static_cast<AST::BinaryOperatorExpression const&>(unwrapped_expression);
+
+        if (binary_expression.type() == AST::BinaryOperator::And) {
+            collect_conjuncts(*binary_expression.lhs(), conjuncts);
+            collect_conjuncts(*binary_expression.rhs(), conjuncts);
+            return;
+        }
+    }
+
+    conjuncts.append(unwrapped_expression);
+}
+
+namespace {
+
+struct IndexRange {
+    Optional<IndexScan::Bound> lower_bound;
+    Optional<IndexScan::Bound> upper_bound;
+
+    // Equality predicates are the most selective, followed by ranges bounded on both sides.
+    int rank() const
+    {
+        if (lower_bound.has_value() && upper_bound.has_value()) {
+            if (lower_bound->is_inclusive && upper_bound->is_inclusive && lower_bound->value == upper_bound->value)
+                return 3;
+            return 2;
+        }
+
+        return (lower_bound.has_value() || upper_bound.has_value()) ? 1 : 0;
+    }
+
+    void restrict_lower_bound(IndexScan::Bound bound)
+    {
+        if (lower_bound.has_value()) {
+            auto comparison = bound.value.compare(lower_bound->value);
+            if (comparison < 0 || (comparison == 0 && (bound.is_inclusive || !lower_bound->is_inclusive)))
+                return;
+        }
+
+        lower_bound = move(bound);
+    }
+
+    void restrict_upper_bound(IndexScan::Bound bound)
+    {
+        if (upper_bound.has_value()) {
+            auto comparison = bound.value.compare(upper_bound->value);
+            if (comparison > 0 || (comparison == 0 && (bound.is_inclusive || !upper_bound->is_inclusive)))
+                return;
+        }
+
+        upper_bound = move(bound);
+    }
+};
+
+}
+
+static bool is_constant(AST::Expression const& expression)
+{
+    auto const& unwrapped_expression = unwrap_parentheses(expression);
+    return is<AST::NumericLiteral>(unwrapped_expression) || is<AST::StringLiteral>(unwrapped_expression) || is<AST::Placeholder>(unwrapped_expression);
+}
+
+static bool is_reference_to_column(AST::Expression const& expression, TableDef const& table, KeyPartDef const& column)
+{
+    auto const& unwrapped_expression = unwrap_parentheses(expression);
+    if (!is<AST::ColumnNameExpression>(unwrapped_expression))
+        return false;
+
+    auto const& column_name_expression = static_cast<AST::ColumnNameExpression const&>(unwrapped_expression);
+    if (!column_name_expression.table_name().is_empty() && column_name_expression.table_name() != table.name())
+        return false;
+    return column_name_expression.column_name() == column.name();
+}
+
+// Converts a constant to the type of the indexed column. Returns an empty optional if the
+// constant cannot be compared to the values of the column in the order of the index.
+static Optional<Value> convert_to_column_type(Value const& value, SQLType column_type)
+{
+    if (value.is_null())
+        return {};
+
+    switch (column_type) {
+    case SQLType::Integer:
+        if (value.type() == SQLType::Integer)
+            return value;
+        if (value.type() == SQLType::Float) {
+            auto as_double = value.to_double().value();
+            if (trunc(as_double) != as_double)
+                return {};
+            if (auto as_integer = value.to_int<i64>(); as_integer.has_value())
+                return Value { *as_integer };
+        }
+        return {};
+
+    case SQLType::Float:
+        if (value.type() == SQLType::Integer || value.type() == SQLType::Float)
+            return Value { value.to_double().value() };
+        return {};
+
+    default:
+        if (value.type() == column_type)
+            return value;
+        return {};
+    }
+}
+
+static AST::BinaryOperator flip_comparison(AST::BinaryOperator type)
+{
+    switch (type) {
+    case AST::BinaryOperator::LessThan:
+        return AST::BinaryOperator::GreaterThan;
+    case AST::BinaryOperator::LessThanEquals:
+        return AST::BinaryOperator::GreaterThanEquals;
+    case AST::BinaryOperator::GreaterThan:
+        return AST::BinaryOperator::LessThan;
+    case AST::BinaryOperator::GreaterThanEquals:
+        return AST::BinaryOperator::LessThanEquals;
+    default:
+        return type;
+    }
+}
+
+static ResultOr<Optional<Value>> evaluate_bound(AST::ExecutionContext& context, AST::Expression const& expression, KeyPartDef const& column)
+{
+    auto value = TRY(unwrap_parentheses(expression).evaluate(context));
+    return convert_to_column_type(value, column.type());
+}
+
+// Narrows down the range of values of the column for which the predicate may hold.
+static ResultOr<void> restrict_range(AST::ExecutionContext& context, AST::Expression const& predicate, TableDef const& table, KeyPartDef const& column, IndexRange& range)
+{
+    if (is<AST::BetweenExpression>(predicate)) {
+        auto const& between_expression = static_cast<AST::BetweenExpression const&>(predicate);
+
+        if (between_expression.invert_expression() || !is_reference_to_column(*between_expression.expression(), table, column))
+            return {};
+        if (!is_constant(*between_expression.lhs()) || !is_constant(*between_expression.rhs()))
+            return {};
+
+        auto lower_bound = TRY(evaluate_bound(context, *between_expression.lhs(), column));
+        auto upper_bound = TRY(evaluate_bound(context, *between_expression.rhs(), column));
+        if (!lower_bound.has_value() || !upper_bound.has_value())
+            return {};
+
+        range.restrict_lower_bound({ lower_bound.release_value(), true });
+        range.restrict_upper_bound({ upper_bound.release_value(), true });
+        return {};
+    }
+
+    if (!is<AST::BinaryOperatorExpression>(predicate))
+        return {};
+
+    auto const& binary_expression = static_cast<AST::BinaryOperatorExpression const&>(predicate);
+    auto type = binary_expression.type();
+    AST::Expression const* constant = nullptr;
+
+    if (is_reference_to_column(*binary_expression.lhs(), table, column) && is_constant(*binary_expression.rhs())) {
+        constant = binary_expression.rhs().ptr();
+    } else if (is_reference_to_column(*binary_expression.rhs(), table, column) && is_constant(*binary_expression.lhs())) {
+        constant = binary_expression.lhs().ptr();
+        type = flip_comparison(type);
+    } else {
+        return {};
+    }
+
+    switch (type) {
+    case AST::BinaryOperator::Equals:
+    case AST::BinaryOperator::LessThan:
+    case AST::BinaryOperator::LessThanEquals:
+    case AST::BinaryOperator::GreaterThan:
+    case AST::BinaryOperator::GreaterThanEquals:
+        break;
+    default:
+        return {};
+    }
+
+    auto bound = TRY(evaluate_bound(context, *constant, column));
+    if (!bound.has_value())
+        return {};
+
+    switch (type) {
+    case AST::BinaryOperator::Equals:
+        range.restrict_lower_bound({ *bound, true });
+        range.restrict_upper_bound({ bound.release_value(), true });
+        break;
+    case AST::BinaryOperator::LessThan:
+    case AST::BinaryOperator::LessThanEquals:
+        range.restrict_upper_bound({ bound.release_value(), type == AST::BinaryOperator::LessThanEquals });
+        break;
+    case AST::BinaryOperator::GreaterThan:
+    case AST::BinaryOperator::GreaterThanEquals:
+        range.restrict_lower_bound({ bound.release_value(), type == AST::BinaryOperator::GreaterThanEquals });
+        break;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+    return {};
+}
+
+static ResultOr<NonnullOwnPtr<Operator>> apply_predicates(NonnullOwnPtr<Operator> input, Vector<NonnullRefPtr<AST::Expression const>> predicates)
+{
+    for (auto& predicate : predicates)
+        input = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) Filter(move(input), move(predicate))));
+    return input;
+}
+
+ResultOr<NonnullOwnPtr<Operator>> plan_table_access(AST::ExecutionContext& context, NonnullRefPtr<TableDef> table, Vector<NonnullRefPtr<AST::Expression const>> predicates, RefPtr<IndexDef> ordering_index)
+{
+    RefPtr<IndexDef> best_index;
+    IndexRange best_range;
+
+    for (auto const& index : table->indexes()) {
+        if (ordering_index && index != ordering_index)
+            continue;
+
+        auto const& column = index->key_definition().first();
+        if (column->sort_order() != Order::Ascending)
+            continue;
+
+        IndexRange range;
+        for (auto const& predicate : predicates)
+            TRY(restrict_range(context, *predicate, *table, *column, range));
+
+        if (index == ordering_index || range.rank() > best_range.rank()) {
+            best_index = index;
+            best_range = move(range);
+        }
+    }
+
+    NonnullOwnPtr<Operator> access = best_index
+        ? TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) IndexScan(table, best_index.release_nonnull(), move(best_range.lower_bound), move(best_range.upper_bound))))
+        : TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) TableScan(table)));
+
+    return apply_predicates(move(access), move(predicates));
+}
+
+namespace {
+
+struct EquiJoin {
+    NonnullRefPtr<AST::ColumnNameExpression const> outer_key;
+    NonnullRefPtr<AST::ColumnNameExpression const> inner_key;
+    size_t outer_table_index { 0 };
+};
+
+}
+
+// Finds the only table among the first `table_count` tables which has the column, and returns
+// the definition of the column.
+static Optional<size_t> resolve_column(AST::ColumnNameExpression const& column, Vector<NonnullRefPtr<TableDef>> const& tables, size_t table_count, RefPtr<ColumnDef>& column_def)
+{
+    Optional<size_t> table_index;
+
+    for (size_t i = 0; i < table_count; ++i) {
+        if (!column.table_name().is_empty() && column.table_name() != tables[i]->name())
+            continue;
+
+        auto it = tables[i]->columns().find_if([&](auto const& table_column) { return table_column->name() == column.column_name(); });
+        if (it.is_end())
+            continue;
+
+        if (table_index.has_value())
+            return {};
+
+        table_index = i;
+        column_def = *it;
+    }
+
+    return table_index;
+}
+
+// Values of these types are hashed and ordered consistently with the way they compare equal.
+static bool are_join_compatible(SQLType lhs, SQLType rhs)
+{
+    auto is_numeric = [](SQLType type) { return type == SQLType::Integer || type == SQLType::Float; };
+
+    if (is_numeric(lhs) || is_numeric(rhs))
+        return is_numeric(lhs) && is_numeric(rhs);
+    return lhs == rhs;
+}
+
+// Finds a predicate which equates a column of the table at `inner_table_index` with a column
+// of one of the tables before it.
+static Optional<EquiJoin> find_equi_join(Vector<NonnullRefPtr<AST::Expression const>> const& predicates, Vector<NonnullRefPtr<TableDef>> const& tables, size_t inner_table_index)
+{
+    for (auto const& predicate : predicates) {
+        if (!is<AST::BinaryOperatorExpression>(*predicate))
+            continue;
+
+        auto const& binary_expression = static_cast<AST::BinaryOperatorExpression const&>(*predicate);
+        if (binary_expression.type() != AST::BinaryOperator::Equals)
+            continue;
+
+        auto const& lhs = unwrap_parentheses(*binary_expression.lhs());
+        auto const& rhs = unwrap_parentheses(*binary_expression.rhs());
+        if (!is<AST::ColumnNameExpression>(lhs) || !is<AST::ColumnNameExpression>(rhs))
+            continue;
+
+        auto const& lhs_column = static_cast<AST::ColumnNameExpression const&>(lhs);
+        auto const& rhs_column = static_cast<AST::ColumnNameExpression const&>(rhs);
+
+        RefPtr<ColumnDef> lhs_column_def;
+        RefPtr<ColumnDef> rhs_column_def;
+        auto lhs_table_index = resolve_column(lhs_column, tables, inner_table_index + 1, lhs_column_def);
+        auto rhs_table_index = resolve_column(rhs_column, tables, inner_table_index + 1, rhs_column_def);
+        if (!lhs_table_index.has_value() || !rhs_table_index.has_value())
+            continue;
+        if (!are_join_compatible(lhs_column_def->type(), rhs_column_def->type()))
+            continue;
+
+        if (*lhs_table_index < inner_table_index && *rhs_table_index == inner_table_index)
+            return EquiJoin { lhs_column, rhs_column, *lhs_table_index };
+        if (*rhs_table_index < inner_table_index && *lhs_table_index == inner_table_index)
+            return EquiJoin { rhs_column, lhs_column, *rhs_table_index };
+    }
+
+    return {};
+}
+
+// Finds an index which produces the rows of the table in ascending order of the column.
+static RefPtr<IndexDef> find_ordering_index(TableDef const& table, DeprecatedString const& column_name)
+{
+    for (auto const& index : table.indexes()) {
+        auto const& column = index->key_definition().first();
+        if (column->name() == column_name && column->sort_order() == Order::Ascending)
+            return index;
+    }
+
+    return nullptr;
+}
+
+ResultOr<NonnullOwnPtr<Operator>> plan_joins(AST::ExecutionContext& context, Vector<NonnullRefPtr<TableDef>> const& tables, Vector<Vector<NonnullRefPtr<AST::Expression const>>> scan_predicates, Vector<Vector<NonnullRefPtr<AST::Expression const>>> join_predicates)
+{
+    VERIFY(!tables.is_empty());
+    VERIFY(scan_predicates.size() == tables.size());
+    VERIFY(join_predicates.size() == tables.size());
+
+    OwnPtr<Operator> pipeline;
+
+    for (size_t i = 1; i < tables.size(); ++i) {
+        auto equi_join = find_equi_join(join_predicates[i], tables, i);
+
+        // The rows of a single table can be read in the order of its index. This is no longer
+        // the case once the rows of several tables have been joined.
+        if (!pipeline && equi_join.has_value()) {
+            auto outer_index = find_ordering_index(*tables[0], equi_join->outer_key->column_name());
+            auto inner_index = find_ordering_index(*tables[1], equi_join->inner_key->column_name());
+
+            if (outer_index && inner_index) {
+                auto outer = TRY(plan_table_access(context, tables[0], move(scan_predicates[0]), move(outer_index)));
+                auto inner = TRY(plan_table_access(context, tables[1], move(scan_predicates[1]), move(inner_index)));
+
+                pipeline = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) MergeJoin(move(outer), move(inner), equi_join->outer_key, equi_join->inner_key)));
+                pipeline = TRY(apply_predicates(pipeline.release_nonnull(), move(join_predicates[i])));
+                continue;
+            }
+        }
+
+        if (!pipeline)
+            pipeline = TRY(plan_table_access(context, tables[0], move(scan_predicates[0])));
+
+        auto inner = TRY(plan_table_access(context, tables[i], move(scan_predicates[i])));
+
+        if (equi_join.has_value())
+            pipeline = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) HashJoin(pipeline.release_nonnull(), move(inner), equi_join->outer_key, equi_join->inner_key)));
+        else
+            pipeline = TRY(adopt_nonnull_own_or_enomem<Operator>(new (nothrow) NestedLoopJoin(pipeline.release_nonnull(), move(inner))));
+
+        pipeline = TRY(apply_predicates(pipeline.release_nonnull(), move(join_predicates[i])));
+    }
+
+    if (!pipeline)
+        return plan_table_access(context, tables[0], move(scan_predicates[0]));
+    return pipeline.release_nonnull();
+}
+
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibSQL/Forward.h>
+#include <LibSQL/Result.h>
+
+namespace SQL {
+
+namespace AST {
+struct ExecutionContext;
+}
+
+// Splits an expression into the terms of its top-level conjunction.
+void collect_conjuncts(AST::Expression const&, Vector<NonnullRefPtr<AST::Expression const>>& conjuncts);
+
+// Builds the operators which read the rows of a table for which all of the predicates hold.
+// If one of the predicates restricts the leading column of one of the table's indexes to a
+// constant or a range of constants, the rows are read through that index. All predicates
+// are applied as filters to the rows which are read, so the index only needs to narrow
+// down the rows which are read from the table.
+//
+// If an ordering index is given, the rows are read through that index, and are thus produced
+// in ascending order of its leading column.
+ResultOr<NonnullOwnPtr<Operator>> plan_table_access(AST::ExecutionContext&, NonnullRefPtr<TableDef>, Vector<NonnullRefPtr<AST::Expression const>> predicates, RefPtr<IndexDef> ordering_index = nullptr);
+
+// Builds the operators which join the rows of the tables, in the order in which they are given.
+// The predicates in scan_predicates[i] only reference table i, and are applied while reading
+// its rows. The predicates in join_predicates[i] reference table i and the tables before it,
+// and are applied once table i has been joined. If one of those is an equality between a
+// column of table i and a column of an earlier table, the tables are joined with a merge join
+// when both columns are indexed, or with a hash join otherwise.
+ResultOr<NonnullOwnPtr<Operator>> plan_joins(AST::ExecutionContext&, Vector<NonnullRefPtr<TableDef>> const& tables, Vector<Vector<NonnullRefPtr<AST::Expression const>>> scan_predicates, Vector<Vector<NonnullRefPtr<AST::Expression const>>> join_predicates);
+
+}
@@ -9,6 +9,7 @@
 
 #include <AK/DeprecatedString.h>
 #include <AK/Error.h>
+#include <AK/Format.h>
 #include <AK/Noncopyable.h>
 #include <LibSQL/Type.h>
 
@@ -19,6 +20,7 @@ namespace SQL {
     S(Create)                     \
     S(Delete)                     \
     S(Describe)                   \
+    S(Explain)                    \
     S(Insert)                     \
     S(Select)                     \
     S(Update)
@@ -43,11 +45,13 @@ constexpr char const* command_tag(SQLCommand command)
 }
 
 #define ENUMERATE_SQL_ERRORS(S)                                                                   \
+    S(AggregateMisuse, "Misuse of aggregate function in {}")                                      \
     S(AmbiguousColumnName, "Column name '{}' is ambiguous")                                       \
     S(BooleanOperatorTypeMismatch, "Cannot apply '{}' operator to non-boolean operands")          \
     S(ColumnDoesNotExist, "Column '{}' does not exist")                                           \
     S(DatabaseDoesNotExist, "Database '{}' does not exist")                                       \
     S(DatabaseUnavailable, "Database Unavailable")                                                \
+    S(IndexExists, "Index '{}' already exist")                                                    \
     S(IntegerOperatorTypeMismatch, "Cannot apply '{}' operator to non-numeric operands")          \
     S(IntegerOverflow, "Operation would cause integer overflow")                                  \
     S(InternalError, "{}")                                                                        \
@@ -65,7 +69,8 @@ constexpr char const* command_tag(SQLCommand command)
     S(StatementUnavailable, "Statement with id '{}' Unavailable")                                 \
     S(SyntaxError, "Syntax Error")                                                                \
     S(TableDoesNotExist, "Table '{}' does not exist")                                             \
-    S(TableExists, "Table '{}' already exist")
+    S(TableExists, "Table '{}' already exist")                                                    \
+    S(UniqueConstraintViolated, "Unique constraint of index '{}' violated")
 
 enum class SQLErrorCode {
 #undef __ENUMERATE_SQL_ERROR
@@ -130,3 +135,11 @@ template<typename ValueType>
 using ResultOr = ErrorOr<ValueType, Result>;
 
 }
+
+template<>
+struct AK::Formatter<SQL::Result> : Formatter<StringView> {
+    ErrorOr<void> format(FormatBuilder& builder, SQL::Result const& result)
+    {
+        return Formatter<StringView>::format(builder, result.error_string());
+    }
+};
@@ -34,12 +34,12 @@ public:
     SQLCommand command() const { return m_command; }
     Vector<DeprecatedString> const& column_names() const { return m_column_names; }
 
+    // Rows are kept in the order in which they are inserted. Ordering and limiting the rows
+    // of a query result is done by its operators (see Sort, TopN and Limit) before they are
+    // inserted here.
     void insert_row(Tuple const& row, Tuple const& sort_key);
-    void limit(size_t offset, size_t limit);
 
 private:
-    size_t binary_search(Tuple const& sort_key, size_t low, size_t high);
-
     SQLCommand m_command { SQLCommand::Unknown };
     Vector<DeprecatedString> m_column_names;
 };
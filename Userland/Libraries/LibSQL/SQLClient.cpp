@@ -185,6 +185,9 @@ void SQLClient::execution_success(u64 statement_id, u64 execution_id, Vector<Dep
 
 void SQLClient::execution_error(u64 statement_id, u64 execution_id, SQLErrorCode const& code, DeprecatedString const& message)
 {
+    if (forget_failed_execution(statement_id, execution_id))
+        return;
+
     if (!on_execution_error) {
         warnln("Execution error for statement_id {}: {} ({})", statement_id, message, to_underlying(code));
         return;
@@ -200,26 +203,47 @@ void SQLClient::execution_error(u64 statement_id, u64 execution_id, SQLErrorCode
     on_execution_error(move(error));
 }
 
-void SQLClient::next_result(u64 statement_id, u64 execution_id, Vector<Value> const& row)
+void SQLClient::next_results(u64 statement_id, u64 execution_id, size_t row_count, Vector<Value> const& values)
 {
-    if (!on_next_result) {
-        StringBuilder builder;
-        builder.join(", "sv, row, "\"{}\""sv);
-        outln("{}", builder.string_view());
+    if (has_failed_execution(statement_id, execution_id))
+        return;
+
+    // The values of all rows of the batch are sent one after another.
+    if (row_count == 0 || values.size() % row_count != 0) {
+        fail_execution(statement_id, execution_id, DeprecatedString::formatted("Received a malformed batch of {} values for {} rows", values.size(), row_count));
         return;
     }
+    auto row_size = values.size() / row_count;
 
-    ExecutionResult result {
-        .statement_id = statement_id,
-        .execution_id = execution_id,
-        .values = move(const_cast<Vector<Value>&>(row)),
-    };
+    for (size_t i = 0; i < row_count; ++i) {
+        auto row = values.span().slice(i * row_size, row_size);
+
+        if (!on_next_result) {
+            StringBuilder builder;
+            builder.join(", "sv, row, "\"{}\""sv);
+            outln("{}", builder.string_view());
+            continue;
+        }
 
-    on_next_result(move(result));
+        ExecutionResult result {
+            .statement_id = statement_id,
+            .execution_id = execution_id,
+            .values = {},
+        };
+
+        result.values.ensure_capacity(row_size);
+        for (auto& value : row)
+            result.values.unchecked_append(move(const_cast<Value&>(value)));
+
+        on_next_result(move(result));
+    }
 }
 
 void SQLClient::results_exhausted(u64 statement_id, u64 execution_id, size_t total_rows)
 {
+    if (forget_failed_execution(statement_id, execution_id))
+        return;
+
     if (!on_results_exhausted) {
         outln("{} total row(s)", total_rows);
         return;
@@ -234,4 +258,27 @@ void SQLClient::results_exhausted(u64 statement_id, u64 execution_id, size_t tot
     on_results_exhausted(move(success));
 }
 
+void SQLClient::fail_execution(u64 statement_id, u64 execution_id, DeprecatedString const& message)
+{
+    execution_error(statement_id, execution_id, SQLErrorCode::InternalError, message);
+    m_failed_executions.ensure(statement_id).set(execution_id);
+}
+
+bool SQLClient::has_failed_execution(u64 statement_id, u64 execution_id) const
+{
+    auto executions = m_failed_executions.find(statement_id);
+    return executions != m_failed_executions.end() && executions->value.contains(execution_id);
+}
+
+bool SQLClient::forget_failed_execution(u64 statement_id, u64 execution_id)
+{
+    auto executions = m_failed_executions.find(statement_id);
+    if (executions == m_failed_executions.end() || !executions->value.remove(execution_id))
+        return false;
+
+    if (executions->value.is_empty())
+        m_failed_executions.remove(executions);
+    return true;
+}
+
 }
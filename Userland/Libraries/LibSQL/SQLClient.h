@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Platform.h>
 #include <LibIPC/ConnectionToServer.h>
 #include <LibSQL/Result.h>
@@ -60,6 +62,13 @@ public:
 
     virtual ~SQLClient() = default;
 
+    // Every execution of a statement ends with exactly one of these:
+    //  - on_execution_success without has_results, for a statement which does not produce any rows,
+    //  - on_results_exhausted, once all rows produced by the statement have been received, or
+    //  - on_execution_error.
+    // An on_execution_success with has_results only announces the column names of the rows which are about to be
+    // streamed. If the execution fails after that, on_execution_error ends it, and the rows which were already
+    // received are not the complete result of the statement.
     Function<void(ExecutionSuccess)> on_execution_success;
     Function<void(ExecutionError)> on_execution_error;
     Function<void(ExecutionResult)> on_next_result;
@@ -73,8 +82,16 @@ private:
 
     virtual void execution_success(u64 statement_id, u64 execution_id, Vector<DeprecatedString> const& column_names, bool has_results, size_t created, size_t updated, size_t deleted) override;
     virtual void execution_error(u64 statement_id, u64 execution_id, SQLErrorCode const& code, DeprecatedString const& message) override;
-    virtual void next_result(u64 statement_id, u64 execution_id, Vector<SQL::Value> const&) override;
+    virtual void next_results(u64 statement_id, u64 execution_id, size_t row_count, Vector<SQL::Value> const&) override;
     virtual void results_exhausted(u64 statement_id, u64 execution_id, size_t total_rows) override;
+
+    void fail_execution(u64 statement_id, u64 execution_id, DeprecatedString const& message);
+    bool has_failed_execution(u64 statement_id, u64 execution_id) const;
+    bool forget_failed_execution(u64 statement_id, u64 execution_id);
+
+    // Executions which were ended early because of a malformed message. The remaining messages the server sends for
+    // them are dropped, up to and including the one which ends the execution on its side.
+    HashMap<u64, HashTable<u64>> m_failed_executions;
 };
 
 }
@@ -41,6 +41,17 @@ public:
         m_current_offset = 0;
     }
 
+    // Resizes and rewinds the buffer, so that data which was serialized to somewhere other
+    // than the heap can be read into the returned bytes and deserialized from there.
+    ErrorOr<Bytes> prepare_for_reading(size_t size)
+    {
+        TRY(m_buffer.try_resize(size));
+        m_current_offset = 0;
+        return m_buffer.bytes();
+    }
+
+    ReadonlyBytes bytes() const { return m_buffer.bytes(); }
+
     template<typename T, typename... Args>
     T deserialize_block(Block::Index block_index, Args&&... args)
     {
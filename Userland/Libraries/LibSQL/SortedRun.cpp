@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/System.h>
+#include <LibSQL/SortedRun.h>
+
+namespace SQL {
+
+static void serialize_values(Serializer& serializer, Tuple const& tuple)
+{
+    for (size_t i = 0; i < tuple.size(); ++i)
+        serializer.serialize<Value>(tuple[i]);
+}
+
+static void deserialize_values(Serializer& serializer, Tuple& tuple)
+{
+    for (size_t i = 0; i < tuple.size(); ++i)
+        tuple[i] = serializer.deserialize<Value>();
+}
+
+ErrorOr<NonnullOwnPtr<SortedRun>> SortedRun::create(Vector<ResultRow> const& rows, Vector<size_t> const& order)
+{
+    auto pattern = DeprecatedString::formatted("{}/sql-sort.XXXXXX", Core::StandardPaths::tempfile_directory());
+
+    Vector<char> path;
+    TRY(path.try_append(pattern.characters(), pattern.length() + 1));
+
+    auto fd = TRY(Core::System::mkstemp(path));
+    ScopeGuard remove_file = [&] { (void)Core::System::unlink({ path.data(), pattern.length() }); };
+
+    {
+        auto file = TRY(Core::File::adopt_fd(fd, Core::File::OpenMode::Write));
+        auto stream = TRY(Core::OutputBufferedFile::create(move(file)));
+
+        // Each row is written as its length in bytes, followed by its block index, the
+        // values of the row, and the values of its sort key.
+        Serializer serializer;
+        for (auto index : order) {
+            auto const& row = rows[index];
+
+            serializer.reset();
+            serializer.serialize<u32>(row.row.block_index());
+            serialize_values(serializer, row.row);
+            serialize_values(serializer, row.sort_key);
+
+            TRY(stream->write_value<u32>(serializer.bytes().size()));
+            TRY(stream->write_until_depleted(serializer.bytes()));
+        }
+
+        TRY(stream->flush_buffer());
+    }
+
+    auto file = TRY(Core::File::open({ path.data(), pattern.length() }, Core::File::OpenMode::Read));
+    auto stream = TRY(Core::InputBufferedFile::create(move(file)));
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) SortedRun(move(stream), order.size()));
+}
+
+ErrorOr<bool> SortedRun::read_next(ResultRow& row)
+{
+    if (m_remaining_rows == 0)
+        return false;
+    --m_remaining_rows;
+
+    auto length = TRY(m_file->read_value<u32>());
+    TRY(m_file->read_until_filled(TRY(m_serializer.prepare_for_reading(length))));
+
+    row.row.set_block_index(m_serializer.deserialize<u32>());
+    deserialize_values(m_serializer, row.row);
+    deserialize_values(m_serializer, row.sort_key);
+
+    return true;
+}
+
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibCore/File.h>
+#include <LibSQL/ResultSet.h>
+#include <LibSQL/Serializer.h>
+
+namespace SQL {
+
+/**
+ * A SortedRun is a sequence of rows which were sorted in memory and then written to a
+ * temporary file, so that sorting a result does not need to hold all of its rows in
+ * memory at once. The file is removed as soon as it is created, so it disappears once
+ * the run is destroyed. Only the values of the rows are written; the descriptors of the
+ * rows which are read back are taken from the rows passed to read_next().
+ */
+class SortedRun {
+public:
+    // Writes rows[order[0]], rows[order[1]], ... to a new temporary file.
+    static ErrorOr<NonnullOwnPtr<SortedRun>> create(Vector<ResultRow> const& rows, Vector<size_t> const& order);
+
+    // Reads the values of the next row of the run into `row`, which must already have the
+    // shape of the rows of the run. Returns false once the run is exhausted.
+    ErrorOr<bool> read_next(ResultRow& row);
+
+private:
+    SortedRun(NonnullOwnPtr<Core::InputBufferedFile> file, size_t row_count)
+        : m_file(move(file))
+        , m_remaining_rows(row_count)
+    {
+    }
+
+    NonnullOwnPtr<Core::InputBufferedFile> m_file;
+    size_t m_remaining_rows { 0 };
+    Serializer m_serializer;
+};
+
+}
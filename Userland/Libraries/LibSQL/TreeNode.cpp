@@ -106,6 +106,8 @@ void TreeNode::deserialize(Serializer& serializer)
     auto nodes = serializer.deserialize<u32>();
     dbgln_if(SQL_DEBUG, "Deserializing node. Size {}", nodes);
     if (nodes > 0) {
+        // Nodes which are loaded through a DownPointer start out as an empty leaf.
+        m_down.clear();
         for (u32 i = 0; i < nodes; i++) {
             auto left = serializer.deserialize<u32>();
             dbgln_if(SQL_DEBUG, "Down[{}] {}", i, left);
@@ -160,9 +162,9 @@ bool TreeNode::insert(Key const& key)
 bool TreeNode::update_key_pointer(Key const& key)
 {
     dbgln_if(SQL_DEBUG, "[#{}] UPDATE({}, {})", block_index(), key.to_deprecated_string(), key.block_index());
-    if (!is_leaf())
-        return node_for(key)->update_key_pointer(key);
 
+    // A key which was moved up during a split lives in a non-leaf node, so every node
+    // on the path down to the leaf has to be checked.
     for (auto ix = 0u; ix < size(); ix++) {
         if (key == m_entries[ix]) {
             dbgln_if(SQL_DEBUG, "[#{}] {} == {}",
@@ -174,7 +176,11 @@ bool TreeNode::update_key_pointer(Key const& key)
             }
             return true;
         }
+        if (!is_leaf() && key < m_entries[ix])
+            return down_node(ix)->update_key_pointer(key);
     }
+    if (!is_leaf())
+        return down_node(size())->update_key_pointer(key);
     return false;
 }
 
@@ -312,11 +318,12 @@ void TreeNode::split()
         auto entry = m_entries.take(median_index);
         auto down = m_down.take(median_index);
 
-        // Reparent to new right node:
+        // Reparent to new right node. Nodes which are not loaded yet get the new node as
+        // their parent once they are loaded through the down pointer:
         if (down.m_node != nullptr)
             down.m_node->m_up = new_node;
         new_node->m_entries.append(entry);
-        new_node->m_down.append(move(down));
+        new_node->m_down.append(DownPointer(new_node, down));
     }
 
     // Move the median key in the node one level up. Its right node will
@@ -94,6 +94,8 @@ int main(int argc, char** argv)
     bool print_json = false;
     bool per_file = false;
     bool use_bytecode = false;
+    bool use_jit = false;
+    bool optimize_bytecode = false;
     StringView specified_test_root;
     DeprecatedString common_path;
     DeprecatedString test_glob;
@@ -120,6 +122,8 @@ int main(int argc, char** argv)
     args_parser.add_option(per_file, "Show detailed per-file results as JSON (implies -j)", "per-file", 0);
     args_parser.add_option(g_collect_on_every_allocation, "Collect garbage after every allocation", "collect-often", 'g');
     args_parser.add_option(use_bytecode, "Use the bytecode interpreter", "run-bytecode", 'b');
+    args_parser.add_option(use_jit, "Compile the bytecode to machine code (implies --run-bytecode)", "jit", 0);
+    args_parser.add_option(optimize_bytecode, "Optimize the bytecode", "optimize-bytecode", 0);
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
     args_parser.add_option(test_glob, "Only run tests matching the given glob", "filter", 'f', "glob");
     for (auto& entry : g_extra_args)
@@ -137,12 +141,17 @@ int main(int argc, char** argv)
         AK::set_debug_enabled(false);
     }
 
+    if (use_jit)
+        use_bytecode = true;
+
     if (JS::Bytecode::g_dump_bytecode && !use_bytecode) {
         warnln("--dump-bytecode can only be used when --run-bytecode is specified.");
         return 1;
     }
 
     JS::Bytecode::Interpreter::set_enabled(use_bytecode);
+    JS::Bytecode::Interpreter::set_jit_enabled(use_jit);
+    JS::Bytecode::Interpreter::set_optimizations_enabled(optimize_bytecode);
 
     DeprecatedString test_root;
 
@@ -5,6 +5,7 @@
  */
 
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/BytecodeCompiler.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Interpreter.h>
@@ -135,6 +136,7 @@ ErrorOr<void, ValidationError> AbstractMachine::validate(Module& module)
         return result.release_error();
     }
 
+    BytecodeCompiler::compile(module);
     return {};
 }
 
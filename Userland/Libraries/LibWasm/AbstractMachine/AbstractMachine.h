@@ -67,49 +67,87 @@ private:
     RefType m_ref;
 };
 
+// Values are stored as their raw bits along with their type, so they can be copied around (e.g. on the stack)
+// without going through a variant.
 class Value {
 public:
     Value()
         : m_value(0)
+        , m_type(ValueType::I32)
     {
     }
 
     using AnyValueType = Variant<i32, i64, float, double, Reference>;
     explicit Value(AnyValueType value)
-        : m_value(move(value))
+        : m_value(0)
+        , m_type(ValueType::I32)
+    {
+        value.visit(
+            [&](i32 value) { *this = Value(value); },
+            [&](i64 value) { *this = Value(value); },
+            [&](float value) { *this = Value(value); },
+            [&](double value) { *this = Value(value); },
+            [&](Reference const& reference) {
+                reference.ref().visit(
+                    [&](Reference::Func const& func) {
+                        m_value = func.address.value();
+                        m_type = ValueType::FunctionReference;
+                    },
+                    [&](Reference::Extern const& extern_) {
+                        m_value = extern_.address.value();
+                        m_type = ValueType::ExternReference;
+                    },
+                    [&](Reference::Null const& null) {
+                        m_type = null.type.kind() == ValueType::ExternReference ? ValueType::NullExternReference : ValueType::NullFunctionReference;
+                    });
+            });
+    }
+
+    explicit Value(i32 value)
+        : m_value(bit_cast<u32>(value))
+        , m_type(ValueType::I32)
+    {
+    }
+
+    explicit Value(i64 value)
+        : m_value(bit_cast<u64>(value))
+        , m_type(ValueType::I64)
+    {
+    }
+
+    explicit Value(float value)
+        : m_value(bit_cast<u32>(value))
+        , m_type(ValueType::F32)
+    {
+    }
+
+    explicit Value(double value)
+        : m_value(bit_cast<u64>(value))
+        , m_type(ValueType::F64)
     {
     }
 
     template<typename T>
     requires(sizeof(T) == sizeof(u64)) explicit Value(ValueType type, T raw_value)
         : m_value(0)
+        , m_type(type.kind())
     {
         switch (type.kind()) {
         case ValueType::Kind::ExternReference:
-            m_value = Reference { Reference::Extern { { bit_cast<u64>(raw_value) } } };
-            break;
         case ValueType::Kind::FunctionReference:
-            m_value = Reference { Reference::Func { { bit_cast<u64>(raw_value) } } };
+        case ValueType::Kind::I64:
+        case ValueType::Kind::F64:
+            m_value = bit_cast<u64>(raw_value);
             break;
         case ValueType::Kind::I32:
-            m_value = static_cast<i32>(bit_cast<i64>(raw_value));
-            break;
-        case ValueType::Kind::I64:
-            m_value = static_cast<i64>(bit_cast<u64>(raw_value));
+            m_value = bit_cast<u32>(static_cast<i32>(bit_cast<i64>(raw_value)));
             break;
         case ValueType::Kind::F32:
-            m_value = static_cast<float>(bit_cast<double>(raw_value));
-            break;
-        case ValueType::Kind::F64:
-            m_value = bit_cast<double>(raw_value);
+            m_value = bit_cast<u32>(static_cast<float>(bit_cast<double>(raw_value)));
             break;
         case ValueType::Kind::NullFunctionReference:
-            VERIFY(raw_value == 0);
-            m_value = Reference { Reference::Null { ValueType(ValueType::Kind::FunctionReference) } };
-            break;
         case ValueType::Kind::NullExternReference:
             VERIFY(raw_value == 0);
-            m_value = Reference { Reference::Null { ValueType(ValueType::Kind::ExternReference) } };
             break;
         default:
             VERIFY_NOT_REACHED();
@@ -124,8 +162,23 @@ public:
     template<typename T>
     ALWAYS_INLINE Optional<T> to() const
     {
+        // Reading a value as (the unsigned variant of) its own type is what the interpreter does most of the time.
+        if constexpr (IsOneOf<T, i32, u32>) {
+            if (m_type == ValueType::I32)
+                return static_cast<T>(static_cast<u32>(m_value));
+        } else if constexpr (IsOneOf<T, i64, u64>) {
+            if (m_type == ValueType::I64)
+                return static_cast<T>(m_value);
+        } else if constexpr (IsSame<T, float>) {
+            if (m_type == ValueType::F32)
+                return bit_cast<float>(static_cast<u32>(m_value));
+        } else if constexpr (IsSame<T, double>) {
+            if (m_type == ValueType::F64)
+                return bit_cast<double>(m_value);
+        }
+
         Optional<T> result;
-        m_value.visit(
+        value().visit(
             [&](auto value) {
                 if constexpr (IsSame<T, decltype(value)> || (!IsFloatingPoint<T> && IsSame<decltype(value), MakeSigned<T>>)) {
                     result = static_cast<T>(value);
@@ -151,26 +204,34 @@ public:
         return result;
     }
 
-    ValueType type() const
+    ValueType type() const { return ValueType(m_type); }
+
+    AnyValueType value() const
     {
-        return ValueType(m_value.visit(
-            [](i32) { return ValueType::Kind::I32; },
-            [](i64) { return ValueType::Kind::I64; },
-            [](float) { return ValueType::Kind::F32; },
-            [](double) { return ValueType::Kind::F64; },
-            [&](Reference const& type) {
-                return type.ref().visit(
-                    [](Reference::Func const&) { return ValueType::Kind::FunctionReference; },
-                    [](Reference::Null const& null_type) {
-                        return null_type.type.kind() == ValueType::ExternReference ? ValueType::Kind::NullExternReference : ValueType::Kind::NullFunctionReference;
-                    },
-                    [](Reference::Extern const&) { return ValueType::Kind::ExternReference; });
-            }));
+        switch (m_type) {
+        case ValueType::I32:
+            return bit_cast<i32>(static_cast<u32>(m_value));
+        case ValueType::I64:
+            return bit_cast<i64>(m_value);
+        case ValueType::F32:
+            return bit_cast<float>(static_cast<u32>(m_value));
+        case ValueType::F64:
+            return bit_cast<double>(m_value);
+        case ValueType::FunctionReference:
+            return Reference { Reference::Func { FunctionAddress { m_value } } };
+        case ValueType::ExternReference:
+            return Reference { Reference::Extern { ExternAddress { m_value } } };
+        case ValueType::NullFunctionReference:
+            return Reference { Reference::Null { ValueType(ValueType::FunctionReference) } };
+        case ValueType::NullExternReference:
+            return Reference { Reference::Null { ValueType(ValueType::ExternReference) } };
+        }
+        VERIFY_NOT_REACHED();
     }
-    auto& value() const { return m_value; }
 
 private:
-    AnyValueType m_value;
+    u64 m_value;
+    ValueType::Kind m_type;
 };
 
 struct Trap {
@@ -530,18 +591,23 @@ private:
 
 class Label {
 public:
-    explicit Label(size_t arity, InstructionPointer continuation)
+    explicit Label(size_t arity, InstructionPointer continuation, size_t stack_height)
         : m_arity(arity)
         , m_continuation(continuation)
+        , m_stack_height(stack_height)
     {
     }
 
     auto continuation() const { return m_continuation; }
     auto arity() const { return m_arity; }
 
+    // The size of the value stack when the label was entered, branching to the label drops all values above it.
+    auto stack_height() const { return m_stack_height; }
+
 private:
     size_t m_arity { 0 };
     InstructionPointer m_continuation { 0 };
+    size_t m_stack_height { 0 };
 };
 
 class Frame {
@@ -560,20 +626,26 @@ public:
     auto& expression() const { return m_expression; }
     auto arity() const { return m_arity; }
 
+    // The index of the frame's own label on the label stack.
+    auto label_index() const { return m_label_index; }
+    void set_label_index(size_t index) { m_label_index = index; }
+
 private:
     ModuleInstance const& m_module;
     Vector<Value> m_locals;
     Expression const& m_expression;
     size_t m_arity { 0 };
+    size_t m_label_index { 0 };
 };
 
+// Values, labels and frames live on separate stacks, so the values are contiguous and pushing or popping one
+// doesn't go through a variant. push(), pop() and peek() operate on the value stack.
 class Stack {
 public:
-    using EntryType = Variant<Value, Label, Frame>;
     Stack() = default;
 
     [[nodiscard]] ALWAYS_INLINE bool is_empty() const { return m_data.is_empty(); }
-    ALWAYS_INLINE void push(EntryType entry) { m_data.append(move(entry)); }
+    ALWAYS_INLINE void push(Value value) { m_data.append(move(value)); }
     ALWAYS_INLINE auto pop() { return m_data.take_last(); }
     ALWAYS_INLINE auto& peek() const { return m_data.last(); }
     ALWAYS_INLINE auto& peek() { return m_data.last(); }
@@ -582,8 +654,15 @@ public:
     ALWAYS_INLINE auto& entries() const { return m_data; }
     ALWAYS_INLINE auto& entries() { return m_data; }
 
+    ALWAYS_INLINE auto& labels() const { return m_labels; }
+    ALWAYS_INLINE auto& labels() { return m_labels; }
+    ALWAYS_INLINE auto& frames() const { return m_frames; }
+    ALWAYS_INLINE auto& frames() { return m_frames; }
+
 private:
-    Vector<EntryType, 1024> m_data;
+    Vector<Value, 1024> m_data;
+    Vector<Label, 64> m_labels;
+    Vector<Frame, 16> m_frames;
 };
 
 using InstantiationResult = AK::Result<NonnullOwnPtr<ModuleInstance>, InstantiationError>;
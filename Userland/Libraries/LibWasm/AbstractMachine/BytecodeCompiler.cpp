@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Optional.h>
+#include <LibWasm/AbstractMachine/BytecodeCompiler.h>
+#include <LibWasm/Opcode.h>
+
+namespace Wasm {
+
+static Optional<OpCode> compare_and_branch_opcode_for(OpCode compare)
+{
+    switch (compare.value()) {
+    case Instructions::i32_eqz.value():
+        return Instructions::synthetic_i32_eqz_br_if;
+    case Instructions::i32_eq.value():
+        return Instructions::synthetic_i32_eq_br_if;
+    case Instructions::i32_ne.value():
+        return Instructions::synthetic_i32_ne_br_if;
+    case Instructions::i32_lts.value():
+        return Instructions::synthetic_i32_lts_br_if;
+    case Instructions::i32_ltu.value():
+        return Instructions::synthetic_i32_ltu_br_if;
+    case Instructions::i32_gts.value():
+        return Instructions::synthetic_i32_gts_br_if;
+    case Instructions::i32_gtu.value():
+        return Instructions::synthetic_i32_gtu_br_if;
+    case Instructions::i32_les.value():
+        return Instructions::synthetic_i32_les_br_if;
+    case Instructions::i32_leu.value():
+        return Instructions::synthetic_i32_leu_br_if;
+    case Instructions::i32_ges.value():
+        return Instructions::synthetic_i32_ges_br_if;
+    case Instructions::i32_geu.value():
+        return Instructions::synthetic_i32_geu_br_if;
+    default:
+        return {};
+    }
+}
+
+struct FusedInstruction {
+    Instruction instruction;
+    size_t length { 0 };
+};
+
+// NOTE: Only the first instruction of a fused sequence can be the target of a jump, as the others all follow an
+//       instruction that neither starts nor ends a block.
+static Optional<FusedInstruction> fuse(Vector<Instruction> const& instructions, size_t ip)
+{
+    auto opcode_at = [&](size_t offset) {
+        return ip + offset < instructions.size() ? instructions[ip + offset].opcode() : OpCode {};
+    };
+
+    // local.get a, local.get b, i32.add -> synthetic:i32.add2local(a, b)
+    if (opcode_at(0) == Instructions::local_get && opcode_at(1) == Instructions::local_get && opcode_at(2) == Instructions::i32_add) {
+        auto lhs = instructions[ip].arguments().get<LocalIndex>();
+        auto rhs = instructions[ip + 1].arguments().get<LocalIndex>();
+        return FusedInstruction { Instruction { Instructions::synthetic_i32_add2local, Instruction::LocalLocalArgs { lhs, rhs } }, 3 };
+    }
+
+    // i32.<compare>, br_if label -> synthetic:i32.<compare>_br_if(label)
+    if (opcode_at(1) == Instructions::br_if) {
+        if (auto opcode = compare_and_branch_opcode_for(opcode_at(0)); opcode.has_value())
+            return FusedInstruction { Instruction { *opcode, instructions[ip + 1].arguments().get<LabelIndex>() }, 2 };
+    }
+
+    return {};
+}
+
+void BytecodeCompiler::compile(Module& module)
+{
+    VERIFY(module.validation_status() == Module::ValidationStatus::Valid);
+
+    for (auto& function : module.functions({}))
+        function.set_body(compile(function.body()), {});
+}
+
+Expression BytecodeCompiler::compile(Expression const& expression)
+{
+    auto& instructions = expression.instructions();
+
+    Vector<Instruction> compiled;
+    compiled.ensure_capacity(instructions.size());
+
+    // Maps the index of each instruction (and the end of the expression) to the index it has after compilation.
+    Vector<size_t> compiled_ips;
+    compiled_ips.resize(instructions.size() + 1);
+
+    Vector<size_t> structured_instructions;
+
+    for (size_t ip = 0; ip < instructions.size();) {
+        compiled_ips[ip] = compiled.size();
+
+        if (auto fused = fuse(instructions, ip); fused.has_value()) {
+            compiled.append(move(fused->instruction));
+            ip += fused->length;
+            continue;
+        }
+
+        auto& instruction = instructions[ip];
+        if (instruction.arguments().has<Instruction::StructuredInstructionArgs>())
+            structured_instructions.append(compiled.size());
+
+        compiled.append(instruction);
+        ++ip;
+    }
+    compiled_ips[instructions.size()] = compiled.size();
+
+    for (auto ip : structured_instructions) {
+        auto& instruction = compiled[ip];
+        auto& args = instruction.arguments().get<Instruction::StructuredInstructionArgs>();
+
+        Optional<InstructionPointer> else_ip;
+        if (args.else_ip.has_value())
+            else_ip = compiled_ips[args.else_ip->value()];
+
+        instruction = Instruction {
+            instruction.opcode(),
+            Instruction::StructuredInstructionArgs { args.block_type, compiled_ips[args.end_ip.value()], else_ip },
+        };
+    }
+
+    return Expression { move(compiled) };
+}
+
+}
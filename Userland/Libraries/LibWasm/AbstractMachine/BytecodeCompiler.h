@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Vector.h>
+#include <LibWasm/Types.h>
+
+namespace Wasm {
+
+// Lowers the function bodies of a validated module into the form that the BytecodeInterpreter runs.
+// Common instruction sequences are fused into synthetic instructions that carry the immediates of the whole sequence,
+// so that they only go through the interpreter's dispatch once. The end and else targets of structured instructions
+// are remapped to the lowered instructions.
+// NOTE: This is only a peephole pass. Instructions keep their Variant arguments, and branches still find their label
+//       and the stack height to unwind to on the label stack at run time.
+// NOTE: The lowered bodies are no longer valid wasm, so this must only run once the module has been validated.
+class BytecodeCompiler {
+public:
+    static void compile(Module&);
+
+private:
+    static Expression compile(Expression const&);
+};
+
+}
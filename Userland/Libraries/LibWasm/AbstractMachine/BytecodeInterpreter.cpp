@@ -25,13 +25,6 @@ namespace Wasm {
         }                                                                                      \
     } while (false)
 
-#define TRAP_IF_NOT_NORETURN(x)                                                                \
-    do {                                                                                       \
-        if (trap_if_not(x, #x##sv)) {                                                          \
-            dbgln_if(WASM_TRACE_DEBUG, "Trapped because {} failed, at line {}", #x, __LINE__); \
-        }                                                                                      \
-    } while (false)
-
 void BytecodeInterpreter::interpret(Configuration& configuration)
 {
     m_trap = Empty {};
@@ -61,24 +54,24 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
 void BytecodeInterpreter::branch_to_label(Configuration& configuration, LabelIndex index)
 {
     dbgln_if(WASM_TRACE_DEBUG, "Branch to label with index {}...", index.value());
-    auto label = configuration.nth_label(index.value());
-    dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label->continuation().value(), label->arity());
-    auto results = pop_values(configuration, label->arity());
+    auto label_index = configuration.nth_label_index(index.value());
+    TRAP_IF_NOT(label_index.has_value());
+    auto label = configuration.stack().labels()[*label_index];
+    dbgln_if(WASM_TRACE_DEBUG, "...which is actually IP {}, and has {} result(s)", label.continuation().value(), label.arity());
 
-    size_t drop_count = index.value() + 1;
-    for (; !configuration.stack().is_empty();) {
-        auto& entry = configuration.stack().peek();
-        if (entry.has<Label>()) {
-            if (--drop_count == 0)
-                break;
-        }
-        configuration.stack().pop();
+    // Move the results down to where the label was entered, dropping everything in between, along with the labels
+    // of the blocks that are left.
+    auto& values = configuration.stack().entries();
+    TRAP_IF_NOT(values.size() >= label.stack_height() + label.arity());
+    auto results_start = values.size() - label.arity();
+    if (results_start != label.stack_height()) {
+        for (size_t i = 0; i < label.arity(); ++i)
+            values[label.stack_height() + i] = move(values[results_start + i]);
+        values.shrink(label.stack_height() + label.arity());
     }
+    configuration.stack().labels().shrink(*label_index + 1);
 
-    for (auto& result : results)
-        configuration.stack().push(move(result));
-
-    configuration.ip() = label->continuation();
+    configuration.ip() = label.continuation();
 }
 
 template<typename ReadType, typename PushType>
@@ -91,8 +84,7 @@ void BytecodeInterpreter::load_and_push(Configuration& configuration, Instructio
         return;
     }
     auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
-    auto& entry = configuration.stack().peek();
-    auto base = entry.get<Value>().to<i32>();
+    auto base = configuration.stack().peek().to<i32>();
     if (!base.has_value()) {
         m_trap = Trap { "Memory access out of bounds" };
         return;
@@ -117,17 +109,14 @@ void BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
     auto instance = configuration.store().get(address);
     FunctionType const* type { nullptr };
     instance->visit([&](auto const& function) { type = &function.type(); });
-    TRAP_IF_NOT(configuration.stack().entries().size() > type->parameters().size());
+    TRAP_IF_NOT(configuration.stack().size() >= type->parameters().size());
     Vector<Value> args;
     args.ensure_capacity(type->parameters().size());
     auto span = configuration.stack().entries().span().slice_from_end(type->parameters().size());
-    for (auto& entry : span) {
-        auto* call_argument = entry.get_pointer<Value>();
-        TRAP_IF_NOT(call_argument);
-        args.unchecked_append(move(*call_argument));
-    }
+    for (auto& value : span)
+        args.unchecked_append(move(value));
 
-    configuration.stack().entries().remove(configuration.stack().size() - span.size(), span.size());
+    configuration.stack().entries().shrink(configuration.stack().size() - span.size());
 
     Result result { Trap { ""sv } };
     {
@@ -153,12 +142,9 @@ void BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
 template<typename PopType, typename PushType, typename Operator>
 void BytecodeInterpreter::binary_numeric_operation(Configuration& configuration)
 {
-    auto rhs_entry = configuration.stack().pop();
+    auto rhs = configuration.stack().pop().to<PopType>();
     auto& lhs_entry = configuration.stack().peek();
-    auto rhs_ptr = rhs_entry.get_pointer<Value>();
-    auto lhs_ptr = lhs_entry.get_pointer<Value>();
-    auto rhs = rhs_ptr->to<PopType>();
-    auto lhs = lhs_ptr->to<PopType>();
+    auto lhs = lhs_entry.to<PopType>();
     PushType result;
     auto call_result = Operator {}(lhs.value(), rhs.value());
     if constexpr (IsSpecializationOf<decltype(call_result), AK::Result>) {
@@ -178,8 +164,7 @@ template<typename PopType, typename PushType, typename Operator>
 void BytecodeInterpreter::unary_operation(Configuration& configuration)
 {
     auto& entry = configuration.stack().peek();
-    auto entry_ptr = entry.get_pointer<Value>();
-    auto value = entry_ptr->to<PopType>();
+    auto value = entry.to<PopType>();
     auto call_result = Operator {}(*value);
     PushType result;
     if constexpr (IsSpecializationOf<decltype(call_result), AK::Result>) {
@@ -195,6 +180,18 @@ void BytecodeInterpreter::unary_operation(Configuration& configuration)
     entry = Value(result);
 }
 
+template<typename PopType, typename Operator>
+void BytecodeInterpreter::compare_and_branch(Configuration& configuration, LabelIndex label)
+{
+    auto rhs = configuration.stack().pop().to<PopType>();
+    auto lhs = configuration.stack().pop().to<PopType>();
+    auto result = Operator {}(lhs.value(), rhs.value());
+    dbgln_if(WASM_TRACE_DEBUG, "{} {} {} = {}, branch to label {} if true", lhs.value(), Operator::name(), rhs.value(), result, label.value());
+    if (!result)
+        return;
+    branch_to_label(configuration, label);
+}
+
 template<typename T>
 struct ConvertToRaw {
     T operator()(T value)
@@ -228,11 +225,9 @@ struct ConvertToRaw<double> {
 template<typename PopT, typename StoreT>
 void BytecodeInterpreter::pop_and_store(Configuration& configuration, Instruction const& instruction)
 {
-    auto entry = configuration.stack().pop();
-    auto value = ConvertToRaw<StoreT> {}(*entry.get<Value>().to<PopT>());
+    auto value = ConvertToRaw<StoreT> {}(*configuration.stack().pop().to<PopT>());
     dbgln_if(WASM_TRACE_DEBUG, "stack({}) -> temporary({}b)", value, sizeof(StoreT));
-    auto base_entry = configuration.stack().pop();
-    auto base = base_entry.get<Value>().to<i32>();
+    auto base = configuration.stack().pop().to<i32>();
     store_to_memory(configuration, instruction, { &value, sizeof(StoreT) }, *base);
 }
 
@@ -332,21 +327,6 @@ MakeUnsigned<T> BytecodeInterpreter::checked_unsigned_truncate(V value)
     return true;
 }
 
-Vector<Value> BytecodeInterpreter::pop_values(Configuration& configuration, size_t count)
-{
-    Vector<Value> results;
-    results.resize(count);
-
-    for (size_t i = 0; i < count; ++i) {
-        auto top_of_stack = configuration.stack().pop();
-        if (auto value = top_of_stack.get_pointer<Value>())
-            results[i] = move(*value);
-        else
-            TRAP_IF_NOT_NORETURN(value);
-    }
-    return results;
-}
-
 void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction)
 {
     dbgln_if(WASM_TRACE_DEBUG, "Executing instruction {} at ip {}", instruction_name(instruction.opcode()), ip.value());
@@ -360,11 +340,9 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::local_get.value():
         configuration.stack().push(Value(configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()]));
         return;
-    case Instructions::local_set.value(): {
-        auto entry = configuration.stack().pop();
-        configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()] = move(entry.get<Value>());
+    case Instructions::local_set.value():
+        configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()] = configuration.stack().pop();
         return;
-    }
     case Instructions::i32_const.value():
         configuration.stack().push(Value(ValueType { ValueType::I32 }, static_cast<i64>(instruction.arguments().get<i32>())));
         return;
@@ -394,27 +372,19 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         }
         }
 
-        configuration.stack().entries().insert(configuration.stack().size() - parameter_count, Label(arity, args.end_ip));
+        configuration.stack().labels().append(Label(arity, args.end_ip, configuration.stack().size() - parameter_count));
         return;
     }
     case Instructions::loop.value(): {
-        size_t arity = 0;
+        // Branching to a loop starts its next iteration, so its label takes the loop's parameters rather than its results.
         size_t parameter_count = 0;
         auto& args = instruction.arguments().get<Instruction::StructuredInstructionArgs>();
-        switch (args.block_type.kind()) {
-        case BlockType::Empty:
-            break;
-        case BlockType::Type:
-            arity = 1;
-            break;
-        case BlockType::Index: {
+        if (args.block_type.kind() == BlockType::Index) {
             auto& type = configuration.frame().module().types()[args.block_type.type_index().value()];
-            arity = type.results().size();
             parameter_count = type.parameters().size();
         }
-        }
 
-        configuration.stack().entries().insert(configuration.stack().size() - parameter_count, Label(arity, ip.value() + 1));
+        configuration.stack().labels().append(Label(parameter_count, ip.value() + 1, configuration.stack().size() - parameter_count));
         return;
     }
     case Instructions::if_.value(): {
@@ -434,51 +404,49 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         }
         }
 
-        auto entry = configuration.stack().pop();
-        auto value = entry.get<Value>().to<i32>();
-        auto end_label = Label(arity, args.end_ip.value());
+        auto value = configuration.stack().pop().to<i32>();
+        auto end_label = Label(arity, args.end_ip.value(), configuration.stack().size() - parameter_count);
         if (value.value() == 0) {
             if (args.else_ip.has_value()) {
                 configuration.ip() = args.else_ip.value();
-                configuration.stack().entries().insert(configuration.stack().size() - parameter_count, end_label);
+                configuration.stack().labels().append(end_label);
             } else {
                 configuration.ip() = args.end_ip.value() + 1;
             }
         } else {
-            configuration.stack().entries().insert(configuration.stack().size() - parameter_count, end_label);
+            configuration.stack().labels().append(end_label);
         }
         return;
     }
     case Instructions::structured_end.value():
     case Instructions::structured_else.value(): {
-        auto index = configuration.nth_label_index(0);
-        auto label = configuration.stack().entries()[*index].get<Label>();
-        configuration.stack().entries().remove(*index, 1);
+        auto label = configuration.stack().labels().take_last();
 
         if (instruction.opcode() == Instructions::structured_end)
             return;
 
-        // Jump to the end label
-        configuration.ip() = label.continuation();
+        // Jump past the end, as the label it would take off is already gone.
+        configuration.ip() = label.continuation().value() + 1;
         return;
     }
     case Instructions::return_.value(): {
+        // Drop everything but the results down to the frame's own label, it is taken off by the caller.
         auto& frame = configuration.frame();
+        auto frame_label_index = frame.label_index();
+        auto& frame_label = configuration.stack().labels()[frame_label_index];
         Checked checked_index { configuration.stack().size() };
         checked_index -= frame.arity();
         VERIFY(!checked_index.has_overflow());
+        VERIFY(checked_index.value() >= frame_label.stack_height());
 
+        auto& values = configuration.stack().entries();
         auto index = checked_index.value();
-        size_t i = 1;
-        for (; i <= index; ++i) {
-            auto& entry = configuration.stack().entries()[index - i];
-            if (entry.has<Label>()) {
-                if (configuration.stack().entries()[index - i - 1].has<Frame>())
-                    break;
-            }
+        if (index != frame_label.stack_height()) {
+            for (size_t i = 0; i < frame.arity(); ++i)
+                values[frame_label.stack_height() + i] = move(values[index + i]);
+            values.shrink(frame_label.stack_height() + frame.arity());
         }
-
-        configuration.stack().entries().remove(index - i + 1, i - 1);
+        configuration.stack().labels().shrink(frame_label_index + 1);
 
         // Jump past the call/indirect instruction
         configuration.ip() = configuration.frame().expression().instructions().size();
@@ -487,15 +455,13 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::br.value():
         return branch_to_label(configuration, instruction.arguments().get<LabelIndex>());
     case Instructions::br_if.value(): {
-        auto entry = configuration.stack().pop();
-        if (entry.get<Value>().to<i32>().value_or(0) == 0)
+        if (configuration.stack().pop().to<i32>().value_or(0) == 0)
             return;
         return branch_to_label(configuration, instruction.arguments().get<LabelIndex>());
     }
     case Instructions::br_table.value(): {
         auto& arguments = instruction.arguments().get<Instruction::TableBranchArgs>();
-        auto entry = configuration.stack().pop();
-        auto maybe_i = entry.get<Value>().to<i32>();
+        auto maybe_i = configuration.stack().pop().to<i32>();
         if (0 <= *maybe_i) {
             size_t i = *maybe_i;
             if (i < arguments.labels.size())
@@ -514,8 +480,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         auto& args = instruction.arguments().get<Instruction::IndirectCallArgs>();
         auto table_address = configuration.frame().module().tables()[args.table.value()];
         auto table_instance = configuration.store().get(table_address);
-        auto entry = configuration.stack().pop();
-        auto index = entry.get<Value>().to<i32>();
+        auto index = configuration.stack().pop().to<i32>();
         TRAP_IF_NOT(index.value() >= 0);
         TRAP_IF_NOT(static_cast<size_t>(index.value()) < table_instance->elements().size());
         auto element = table_instance->elements()[index.value()];
@@ -573,8 +538,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::i64_store32.value():
         return pop_and_store<i64, i32>(configuration, instruction);
     case Instructions::local_tee.value(): {
-        auto& entry = configuration.stack().peek();
-        auto value = entry.get<Value>();
+        auto value = configuration.stack().peek();
         auto local_index = instruction.arguments().get<LocalIndex>();
         dbgln_if(WASM_TRACE_DEBUG, "stack:peek -> locals({})", local_index.value());
         configuration.frame().locals()[local_index.value()] = move(value);
@@ -591,8 +555,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::global_set.value(): {
         auto global_index = instruction.arguments().get<GlobalIndex>();
         auto address = configuration.frame().module().globals()[global_index.value()];
-        auto entry = configuration.stack().pop();
-        auto value = entry.get<Value>();
+        auto value = configuration.stack().pop();
         dbgln_if(WASM_TRACE_DEBUG, "stack -> global({})", address.value());
         auto global = configuration.store().get(address);
         global->set_value(move(value));
@@ -610,8 +573,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         auto address = configuration.frame().module().memories()[0];
         auto instance = configuration.store().get(address);
         i32 old_pages = instance->size() / Constants::page_size;
-        auto& entry = configuration.stack().peek();
-        auto new_pages = entry.get<Value>().to<i32>();
+        auto new_pages = configuration.stack().peek().to<i32>();
         dbgln_if(WASM_TRACE_DEBUG, "memory.grow({}), previously {} pages...", *new_pages, old_pages);
         if (instance->grow(new_pages.value() * Constants::page_size))
             configuration.stack().peek() = Value((i32)old_pages);
@@ -623,9 +585,9 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::memory_fill.value(): {
         auto address = configuration.frame().module().memories()[0];
         auto instance = configuration.store().get(address);
-        auto count = configuration.stack().pop().get<Value>().to<i32>().value();
-        auto value = configuration.stack().pop().get<Value>().to<i32>().value();
-        auto destination_offset = configuration.stack().pop().get<Value>().to<i32>().value();
+        auto count = configuration.stack().pop().to<i32>().value();
+        auto value = configuration.stack().pop().to<i32>().value();
+        auto destination_offset = configuration.stack().pop().to<i32>().value();
 
         TRAP_IF_NOT(static_cast<size_t>(destination_offset + count) <= instance->data().size());
 
@@ -646,9 +608,9 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::memory_copy.value(): {
         auto address = configuration.frame().module().memories()[0];
         auto instance = configuration.store().get(address);
-        auto count = configuration.stack().pop().get<Value>().to<i32>().value();
-        auto source_offset = configuration.stack().pop().get<Value>().to<i32>().value();
-        auto destination_offset = configuration.stack().pop().get<Value>().to<i32>().value();
+        auto count = configuration.stack().pop().to<i32>().value();
+        auto source_offset = configuration.stack().pop().to<i32>().value();
+        auto destination_offset = configuration.stack().pop().to<i32>().value();
 
         TRAP_IF_NOT(static_cast<size_t>(source_offset + count) <= instance->data().size());
         TRAP_IF_NOT(static_cast<size_t>(destination_offset + count) <= instance->data().size());
@@ -680,9 +642,9 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         auto data_index = instruction.arguments().get<DataIndex>();
         auto& data_address = configuration.frame().module().datas()[data_index.value()];
         auto& data = *configuration.store().get(data_address);
-        auto count = *configuration.stack().pop().get<Value>().to<i32>();
-        auto source_offset = *configuration.stack().pop().get<Value>().to<i32>();
-        auto destination_offset = *configuration.stack().pop().get<Value>().to<i32>();
+        auto count = *configuration.stack().pop().to<i32>();
+        auto source_offset = *configuration.stack().pop().to<i32>();
+        auto destination_offset = *configuration.stack().pop().to<i32>();
 
         TRAP_IF_NOT(count > 0);
         TRAP_IF_NOT(source_offset + count > 0);
@@ -722,9 +684,9 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         return;
     }
     case Instructions::ref_is_null.value(): {
-        auto top = configuration.stack().peek().get_pointer<Value>();
-        TRAP_IF_NOT(top->type().is_reference());
-        auto is_null = top->to<Reference::Null>().has_value();
+        auto& top = configuration.stack().peek();
+        TRAP_IF_NOT(top.type().is_reference());
+        auto is_null = top.to<Reference::Null>().has_value();
         configuration.stack().peek() = Value(ValueType(ValueType::I32), static_cast<u64>(is_null ? 1 : 0));
         return;
     }
@@ -734,14 +696,11 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
     case Instructions::select.value():
     case Instructions::select_typed.value(): {
         // Note: The type seems to only be used for validation.
-        auto entry = configuration.stack().pop();
-        auto value = entry.get<Value>().to<i32>();
+        auto value = configuration.stack().pop().to<i32>();
         dbgln_if(WASM_TRACE_DEBUG, "select({})", value.value());
-        auto rhs_entry = configuration.stack().pop();
-        auto& lhs_entry = configuration.stack().peek();
-        auto rhs = move(rhs_entry.get<Value>());
-        auto lhs = move(lhs_entry.get<Value>());
-        configuration.stack().peek() = value.value() != 0 ? move(lhs) : move(rhs);
+        auto rhs = configuration.stack().pop();
+        if (value.value() == 0)
+            configuration.stack().peek() = move(rhs);
         return;
     }
     case Instructions::i32_eqz.value():
@@ -1016,6 +975,39 @@ void BytecodeInterpreter::interpret(Configuration& configuration, InstructionPoi
         return unary_operation<double, i64, Operators::SaturatingTruncate<i64>>(configuration);
     case Instructions::i64_trunc_sat_f64_u.value():
         return unary_operation<double, i64, Operators::SaturatingTruncate<u64>>(configuration);
+    case Instructions::synthetic_i32_add2local.value(): {
+        auto& args = instruction.arguments().get<Instruction::LocalLocalArgs>();
+        auto& locals = configuration.frame().locals();
+        auto lhs = locals[args.lhs.value()].to<u32>();
+        auto rhs = locals[args.rhs.value()].to<u32>();
+        configuration.stack().push(Value(static_cast<i32>(Operators::Add {}(lhs.value(), rhs.value()))));
+        return;
+    }
+    case Instructions::synthetic_i32_eqz_br_if.value(): {
+        if (configuration.stack().pop().to<i32>().value() != 0)
+            return;
+        return branch_to_label(configuration, instruction.arguments().get<LabelIndex>());
+    }
+    case Instructions::synthetic_i32_eq_br_if.value():
+        return compare_and_branch<i32, Operators::Equals>(configuration, instruction.arguments().get<LabelIndex>());
+    case Instructions::synthetic_i32_ne_br_if.value():
+        return compare_and_branch<i32, Operators::NotEquals>(configuration, instruction.arguments().get<LabelIndex>());
+    case Instructions::synthetic_i32_lts_br_if.value():
+        return compare_and_branch<i32, Operators::LessThan>(configuration, instruction.arguments().get<LabelIndex>());
+    case Instructions::synthetic_i32_ltu_br_if.value():
+        return compare_and_branch<u32, Operators::LessThan>(configuration, instruction.arguments().get<LabelIndex>());
+    case Instructions::synthetic_i32_gts_br_if.value():
+        return compare_and_branch<i32, Operators::GreaterThan>(configuration, instruction.arguments().get<LabelIndex>());
+    case Instructions::synthetic_i32_gtu_br_if.value():
+        return compare_and_branch<u32, Operators::GreaterThan>(configuration, instruction.arguments().get<LabelIndex>());
+    case Instructions::synthetic_i32_les_br_if.value():
+        return compare_and_branch<i32, Operators::LessThanOrEquals>(configuration, instruction.arguments().get<LabelIndex>());
+    case Instructions::synthetic_i32_leu_br_if.value():
+        return compare_and_branch<u32, Operators::LessThanOrEquals>(configuration, instruction.arguments().get<LabelIndex>());
+    case Instructions::synthetic_i32_ges_br_if.value():
+        return compare_and_branch<i32, Operators::GreaterThanOrEquals>(configuration, instruction.arguments().get<LabelIndex>());
+    case Instructions::synthetic_i32_geu_br_if.value():
+        return compare_and_branch<u32, Operators::GreaterThanOrEquals>(configuration, instruction.arguments().get<LabelIndex>());
     case Instructions::table_init.value():
     case Instructions::elem_drop.value():
     case Instructions::table_copy.value():
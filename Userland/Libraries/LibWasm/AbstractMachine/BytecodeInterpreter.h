@@ -59,6 +59,9 @@ protected:
     template<typename PopType, typename PushType, typename Operator>
     void unary_operation(Configuration&);
 
+    template<typename PopType, typename Operator>
+    void compare_and_branch(Configuration&, LabelIndex);
+
     template<typename V, typename T>
     MakeUnsigned<T> checked_unsigned_truncate(V);
 
@@ -68,7 +71,6 @@ protected:
     template<typename T>
     T read_value(ReadonlyBytes data);
 
-    Vector<Value> pop_values(Configuration& configuration, size_t count);
     ALWAYS_INLINE bool trap_if_not(bool value, StringView reason)
     {
         if (!value)
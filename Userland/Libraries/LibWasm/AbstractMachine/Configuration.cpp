@@ -11,30 +11,19 @@
 
 namespace Wasm {
 
-Optional<size_t> Configuration::nth_label_index(size_t i)
-{
-    for (size_t index = m_stack.size(); index > 0; --index) {
-        auto& entry = m_stack.entries()[index - 1];
-        if (entry.has<Label>()) {
-            if (i == 0)
-                return index - 1;
-            --i;
-        }
-    }
-    return {};
-}
-
 void Configuration::unwind(Badge<CallFrameHandle>, CallFrameHandle const& frame_handle)
 {
-    if (m_stack.size() == frame_handle.stack_size && frame_handle.frame_index == m_current_frame_index)
+    if (m_stack.size() == frame_handle.stack_size && m_stack.labels().size() == frame_handle.label_count && m_stack.frames().size() == frame_handle.frame_count)
         return;
 
-    VERIFY(m_stack.size() > frame_handle.stack_size);
-    m_stack.entries().remove(frame_handle.stack_size, m_stack.size() - frame_handle.stack_size);
-    m_current_frame_index = frame_handle.frame_index;
+    VERIFY(m_stack.size() >= frame_handle.stack_size);
+    VERIFY(m_stack.labels().size() >= frame_handle.label_count);
+    VERIFY(m_stack.frames().size() >= frame_handle.frame_count);
+    m_stack.entries().shrink(frame_handle.stack_size);
+    m_stack.labels().shrink(frame_handle.label_count);
+    m_stack.frames().shrink(frame_handle.frame_count);
     m_depth--;
     m_ip = frame_handle.ip;
-    VERIFY(m_stack.size() == frame_handle.stack_size);
 }
 
 Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Vector<Value> arguments)
@@ -69,17 +58,17 @@ Result Configuration::execute(Interpreter& interpreter)
     if (interpreter.did_trap())
         return Trap { interpreter.trap_reason() };
 
-    if (stack().size() <= frame().arity() + 1)
+    // ASSERT: The only label left is the one of the current frame.
+    if (stack().labels().size() != frame().label_index() + 1)
+        return Trap { "Invalid stack configuration" };
+    if (stack().size() < stack().labels().last().stack_height() + frame().arity())
         return Trap { "Not enough values to return from call" };
 
     Vector<Value> results;
     results.ensure_capacity(frame().arity());
     for (size_t i = 0; i < frame().arity(); ++i)
-        results.append(move(stack().pop().get<Value>()));
-    auto label = stack().pop();
-    // ASSERT: label == current frame
-    if (!label.has<Label>())
-        return Trap { "Invalid stack configuration" };
+        results.append(stack().pop());
+    stack().labels().take_last();
     return Result { move(results) };
 }
 
@@ -92,21 +81,30 @@ void Configuration::dump_stack()
         memory_stream.read_until_filled(buffer).release_value_but_fixme_should_propagate_errors();
         dbgln(format.view(), StringView(buffer).trim_whitespace());
     };
-    for (auto const& entry : stack().entries()) {
-        entry.visit(
-            [&](Value const& v) {
-                print_value("    {}", v);
-            },
-            [&](Frame const& f) {
-                dbgln("    frame({})", f.arity());
-                for (auto& local : f.locals()) {
-                    print_value("        {}", local);
-                }
-            },
-            [](Label const& l) {
-                dbgln("    label({}) -> {}", l.arity(), l.continuation());
-            });
+    // Walk the three stacks in the order their entries were pushed, using the label indices of the frames and the
+    // value stack heights of the labels.
+    size_t label_index = 0;
+    size_t value_index = 0;
+    auto print_values_until = [&](size_t stack_height) {
+        for (; value_index < stack_height && value_index < stack().size(); ++value_index)
+            print_value("    {}", stack().entries()[value_index]);
+    };
+    auto print_labels_until = [&](size_t label_count) {
+        for (; label_index < label_count; ++label_index) {
+            auto& label = stack().labels()[label_index];
+            print_values_until(label.stack_height());
+            dbgln("    label({}) -> {}", label.arity(), label.continuation());
+        }
+    };
+    for (auto const& frame : stack().frames()) {
+        print_labels_until(frame.label_index());
+        dbgln("    frame({})", frame.arity());
+        for (auto& local : frame.locals()) {
+            print_value("        {}", local);
+        }
     }
+    print_labels_until(stack().labels().size());
+    print_values_until(stack().size());
 }
 
 }
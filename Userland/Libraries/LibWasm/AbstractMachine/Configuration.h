@@ -21,19 +21,24 @@ public:
     {
         auto index = nth_label_index(label);
         if (index.has_value())
-            return m_stack.entries()[index.value()].get<Label>();
+            return m_stack.labels()[index.value()];
         return {};
     }
-    Optional<size_t> nth_label_index(size_t);
+    ALWAYS_INLINE Optional<size_t> nth_label_index(size_t label) const
+    {
+        if (label >= m_stack.labels().size())
+            return {};
+        return m_stack.labels().size() - label - 1;
+    }
     void set_frame(Frame&& frame)
     {
-        m_current_frame_index = m_stack.size();
-        Label label(frame.arity(), frame.expression().instructions().size());
-        m_stack.push(move(frame));
-        m_stack.push(label);
+        Label label(frame.arity(), frame.expression().instructions().size(), m_stack.size());
+        frame.set_label_index(m_stack.labels().size());
+        m_stack.frames().append(move(frame));
+        m_stack.labels().append(label);
     }
-    ALWAYS_INLINE auto& frame() const { return m_stack.entries()[m_current_frame_index].get<Frame>(); }
-    ALWAYS_INLINE auto& frame() { return m_stack.entries()[m_current_frame_index].get<Frame>(); }
+    ALWAYS_INLINE auto& frame() const { return m_stack.frames().last(); }
+    ALWAYS_INLINE auto& frame() { return m_stack.frames().last(); }
     ALWAYS_INLINE auto& ip() const { return m_ip; }
     ALWAYS_INLINE auto& ip() { return m_ip; }
     ALWAYS_INLINE auto& depth() const { return m_depth; }
@@ -45,7 +50,8 @@ public:
 
     struct CallFrameHandle {
         explicit CallFrameHandle(Configuration& configuration)
-            : frame_index(configuration.m_current_frame_index)
+            : frame_count(configuration.m_stack.frames().size())
+            , label_count(configuration.m_stack.labels().size())
             , stack_size(configuration.m_stack.size())
             , ip(configuration.ip())
             , configuration(configuration)
@@ -58,7 +64,8 @@ public:
             configuration.unwind({}, *this);
         }
 
-        size_t frame_index { 0 };
+        size_t frame_count { 0 };
+        size_t label_count { 0 };
         size_t stack_size { 0 };
         InstructionPointer ip { 0 };
         Configuration& configuration;
@@ -75,7 +82,6 @@ public:
 
 private:
     Store& m_store;
-    size_t m_current_frame_index { 0 };
     Stack m_stack;
     size_t m_depth { 0 };
     InstructionPointer m_ip;
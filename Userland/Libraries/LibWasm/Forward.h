@@ -9,6 +9,7 @@
 namespace Wasm {
 
 class AbstractMachine;
+class BytecodeCompiler;
 class Validator;
 struct ValidationError;
 struct Interpreter;
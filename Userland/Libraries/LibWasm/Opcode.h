@@ -218,7 +218,19 @@ namespace Instructions {
     M(table_size, 0xfc10)                    \
     M(table_fill, 0xfc11)                    \
     M(structured_else, 0xff00)               \
-    M(structured_end, 0xff01)
+    M(structured_end, 0xff01)                \
+    M(synthetic_i32_add2local, 0xff02)       \
+    M(synthetic_i32_eqz_br_if, 0xff03)       \
+    M(synthetic_i32_eq_br_if, 0xff04)        \
+    M(synthetic_i32_ne_br_if, 0xff05)        \
+    M(synthetic_i32_lts_br_if, 0xff06)       \
+    M(synthetic_i32_ltu_br_if, 0xff07)       \
+    M(synthetic_i32_gts_br_if, 0xff08)       \
+    M(synthetic_i32_gtu_br_if, 0xff09)       \
+    M(synthetic_i32_les_br_if, 0xff0a)       \
+    M(synthetic_i32_leu_br_if, 0xff0b)       \
+    M(synthetic_i32_ges_br_if, 0xff0c)       \
+    M(synthetic_i32_geu_br_if, 0xff0d)
 
 #define ENUMERATE_WASM_OPCODES(M)         \
     ENUMERATE_SINGLE_BYTE_WASM_OPCODES(M) \
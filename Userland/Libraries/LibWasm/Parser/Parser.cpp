@@ -270,7 +270,7 @@ ParseResult<BlockType> BlockType::parse(Stream& stream)
     ReconsumableStream new_stream { stream };
     new_stream.unread({ &kind, 1 });
 
-    auto index_value_or_error = stream.read_value<LEB128<ssize_t>>();
+    auto index_value_or_error = new_stream.read_value<LEB128<ssize_t>>();
     if (index_value_or_error.is_error())
         return with_eof_check(stream, ParseError::ExpectedIndex);
     ssize_t index_value = index_value_or_error.release_value();
@@ -307,7 +307,7 @@ ParseResult<Vector<Instruction>> Instruction::parse(Stream& stream, InstructionP
             auto& nested_structure = nested_instructions.last();
             if (byte == 0x0b) {
                 // block/loop/if end
-                nested_structure.end_ip = ip + (nested_structure.else_ip.has_value() ? 1 : 0);
+                nested_structure.end_ip = ip;
                 ++ip;
 
                 // Transform op(..., instr*) -> op(...) instr* op(end(ip))
@@ -431,6 +431,7 @@ void Printer::print(Wasm::Instruction const& instruction)
             [&](LocalIndex const& index) { print("(local index {})", index.value()); },
             [&](TableIndex const& index) { print("(table index {})", index.value()); },
             [&](Instruction::IndirectCallArgs const& args) { print("(indirect (type index {}) (table index {}))", args.type.value(), args.table.value()); },
+            [&](Instruction::LocalLocalArgs const& args) { print("(local_local (local index {}) (local index {}))", args.lhs.value(), args.rhs.value()); },
             [&](Instruction::MemoryArgument const& args) { print("(memory (align {}) (offset {}))", args.align, args.offset); },
             [&](Instruction::StructuredInstructionArgs const& args) {
                 print("(structured\n");
@@ -862,5 +863,17 @@ HashMap<Wasm::OpCode, DeprecatedString> Wasm::Names::instruction_names {
     { Instructions::table_fill, "table.fill" },
     { Instructions::structured_else, "synthetic:else" },
     { Instructions::structured_end, "synthetic:end" },
+    { Instructions::synthetic_i32_add2local, "synthetic:i32.add2local" },
+    { Instructions::synthetic_i32_eqz_br_if, "synthetic:i32.eqz_br_if" },
+    { Instructions::synthetic_i32_eq_br_if, "synthetic:i32.eq_br_if" },
+    { Instructions::synthetic_i32_ne_br_if, "synthetic:i32.ne_br_if" },
+    { Instructions::synthetic_i32_lts_br_if, "synthetic:i32.lts_br_if" },
+    { Instructions::synthetic_i32_ltu_br_if, "synthetic:i32.ltu_br_if" },
+    { Instructions::synthetic_i32_gts_br_if, "synthetic:i32.gts_br_if" },
+    { Instructions::synthetic_i32_gtu_br_if, "synthetic:i32.gtu_br_if" },
+    { Instructions::synthetic_i32_les_br_if, "synthetic:i32.les_br_if" },
+    { Instructions::synthetic_i32_leu_br_if, "synthetic:i32.leu_br_if" },
+    { Instructions::synthetic_i32_ges_br_if, "synthetic:i32.ges_br_if" },
+    { Instructions::synthetic_i32_geu_br_if, "synthetic:i32.geu_br_if" },
 };
 HashMap<DeprecatedString, Wasm::OpCode> Wasm::Names::instructions_by_name;
@@ -0,0 +1,136 @@
+// The module exports small functions that branch and return out of nested blocks and loops, or work on values of
+// different types, e.g.
+// (func $br_drops (param i32) (result i32)
+//     local.get 0
+//     (block (result i32) i32.const 5 i32.const 9 br 0)
+//     i32.add)
+// prettier-ignore
+const binary = new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x24, 0x07, 0x60, 0x01, 0x7f, 0x01, 0x7f,
+    0x60, 0x00, 0x02, 0x7f, 0x7f, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x60, 0x00, 0x01, 0x7f, 0x60,
+    0x01, 0x7f, 0x01, 0x7d, 0x60, 0x01, 0x7f, 0x01, 0x7c, 0x60, 0x01, 0x7f, 0x01, 0x7e, 0x03, 0x17,
+    0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0x04, 0x05,
+    0x06, 0x03, 0x00, 0x00, 0x00, 0x02, 0x02, 0x07, 0xf7, 0x01, 0x15, 0x03, 0x66, 0x69, 0x62, 0x00,
+    0x00, 0x08, 0x6c, 0x6f, 0x6f, 0x70, 0x5f, 0x73, 0x75, 0x6d, 0x00, 0x01, 0x0c, 0x62, 0x6c, 0x6f,
+    0x63, 0x6b, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x00, 0x02, 0x05, 0x74, 0x61, 0x62, 0x6c,
+    0x65, 0x00, 0x03, 0x0d, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6e, 0x00, 0x04, 0x08, 0x62, 0x72, 0x5f, 0x64, 0x72, 0x6f, 0x70, 0x73, 0x00, 0x05, 0x0b, 0x6d,
+    0x75, 0x6c, 0x74, 0x69, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x00, 0x06, 0x04, 0x70, 0x61, 0x69,
+    0x72, 0x00, 0x07, 0x0a, 0x63, 0x61, 0x6c, 0x6c, 0x5f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x00, 0x08,
+    0x0b, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0x5f, 0x6c, 0x6f, 0x6f, 0x70, 0x00, 0x09, 0x0b, 0x6c,
+    0x6f, 0x6f, 0x70, 0x5f, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x00, 0x0a, 0x05, 0x69, 0x66, 0x5f,
+    0x62, 0x72, 0x00, 0x0b, 0x08, 0x66, 0x33, 0x32, 0x5f, 0x6d, 0x61, 0x74, 0x68, 0x00, 0x0d, 0x08,
+    0x66, 0x36, 0x34, 0x5f, 0x6d, 0x61, 0x74, 0x68, 0x00, 0x0e, 0x08, 0x69, 0x36, 0x34, 0x5f, 0x6d,
+    0x61, 0x74, 0x68, 0x00, 0x0f, 0x07, 0x69, 0x73, 0x5f, 0x6e, 0x75, 0x6c, 0x6c, 0x00, 0x10, 0x08,
+    0x74, 0x72, 0x75, 0x6e, 0x63, 0x61, 0x74, 0x65, 0x00, 0x11, 0x0a, 0x69, 0x66, 0x5f, 0x65, 0x6c,
+    0x73, 0x65, 0x5f, 0x62, 0x72, 0x00, 0x12, 0x07, 0x65, 0x6c, 0x73, 0x65, 0x5f, 0x62, 0x72, 0x00,
+    0x13, 0x10, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x5f, 0x62, 0x72, 0x61, 0x6e, 0x63, 0x68,
+    0x65, 0x73, 0x00, 0x14, 0x0a, 0x61, 0x64, 0x64, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x73, 0x00,
+    0x15, 0x0a, 0xe5, 0x04, 0x16, 0x1c, 0x00, 0x20, 0x00, 0x41, 0x02, 0x48, 0x04, 0x7f, 0x20, 0x00,
+    0x05, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x10, 0x00, 0x20, 0x00, 0x41, 0x02, 0x6b, 0x10, 0x00, 0x6a,
+    0x0b, 0x0b, 0x23, 0x01, 0x02, 0x7f, 0x02, 0x40, 0x03, 0x40, 0x20, 0x01, 0x20, 0x00, 0x4e, 0x0d,
+    0x01, 0x20, 0x02, 0x20, 0x01, 0x6a, 0x21, 0x02, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x21, 0x01, 0x0c,
+    0x00, 0x0b, 0x0b, 0x20, 0x02, 0x0b, 0x0e, 0x00, 0x02, 0x7f, 0x41, 0x01, 0x20, 0x00, 0x0d, 0x00,
+    0x1a, 0x41, 0x02, 0x0b, 0x0b, 0x1a, 0x00, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x20, 0x00, 0x0e,
+    0x02, 0x00, 0x01, 0x02, 0x0b, 0x41, 0x0a, 0x0f, 0x0b, 0x41, 0x14, 0x0f, 0x0b, 0x41, 0x1e, 0x0b,
+    0x12, 0x00, 0x02, 0x40, 0x02, 0x40, 0x20, 0x00, 0x04, 0x40, 0x41, 0x2a, 0x0f, 0x0b, 0x0b, 0x0b,
+    0x41, 0x07, 0x0b, 0x0e, 0x00, 0x20, 0x00, 0x02, 0x7f, 0x41, 0x05, 0x41, 0x09, 0x0c, 0x00, 0x0b,
+    0x6a, 0x0b, 0x05, 0x00, 0x10, 0x0c, 0x6b, 0x0b, 0x06, 0x00, 0x41, 0x0a, 0x41, 0x03, 0x0b, 0x05,
+    0x00, 0x10, 0x07, 0x6b, 0x0b, 0x2b, 0x01, 0x02, 0x7f, 0x02, 0x40, 0x03, 0x40, 0x20, 0x01, 0x20,
+    0x00, 0x4e, 0x0d, 0x01, 0x20, 0x02, 0x20, 0x01, 0x41, 0x05, 0x20, 0x01, 0x41, 0x05, 0x4a, 0x1b,
+    0x6a, 0x21, 0x02, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x21, 0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x20, 0x02,
+    0x0b, 0x24, 0x01, 0x01, 0x7f, 0x41, 0xe8, 0x07, 0x02, 0x40, 0x03, 0x40, 0x20, 0x01, 0x20, 0x00,
+    0x46, 0x04, 0x40, 0x20, 0x01, 0x41, 0x02, 0x6c, 0x0f, 0x0b, 0x20, 0x01, 0x41, 0x01, 0x6a, 0x21,
+    0x01, 0x0c, 0x00, 0x0b, 0x0b, 0x0b, 0x15, 0x00, 0x02, 0x7f, 0x20, 0x00, 0x04, 0x40, 0x41, 0xe4,
+    0x00, 0x0c, 0x01, 0x0b, 0x41, 0xc8, 0x01, 0x0b, 0x41, 0x01, 0x6a, 0x0b, 0x0a, 0x00, 0x41, 0x01,
+    0x41, 0x0a, 0x41, 0x03, 0x0c, 0x00, 0x0b, 0x0b, 0x00, 0x20, 0x00, 0xb2, 0x43, 0x00, 0x00, 0x00,
+    0x3f, 0x94, 0x0b, 0x0f, 0x00, 0x20, 0x00, 0xb7, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+    0x3f, 0xa0, 0x0b, 0x0d, 0x00, 0x20, 0x00, 0xac, 0x42, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x7e,
+    0x0b, 0x05, 0x00, 0xd0, 0x70, 0xd1, 0x0b, 0x0f, 0x00, 0x44, 0x9a, 0x99, 0x99, 0x99, 0x99, 0x99,
+    0x1f, 0xc0, 0xaa, 0x20, 0x00, 0x6a, 0x0b, 0x18, 0x00, 0x20, 0x00, 0x04, 0x7f, 0x41, 0x0a, 0x0c,
+    0x00, 0x05, 0x41, 0x14, 0x0b, 0x02, 0x7f, 0x41, 0x01, 0x41, 0x02, 0x0c, 0x00, 0x0b, 0x6a, 0x0b,
+    0x16, 0x00, 0x20, 0x00, 0x04, 0x7f, 0x41, 0x0a, 0x05, 0x02, 0x40, 0x41, 0x14, 0x0c, 0x01, 0x0b,
+    0x41, 0x1e, 0x0b, 0x41, 0x01, 0x6a, 0x0b, 0xc4, 0x01, 0x01, 0x01, 0x7f, 0x02, 0x40, 0x20, 0x00,
+    0x20, 0x01, 0x46, 0x0d, 0x00, 0x20, 0x02, 0x41, 0x01, 0x72, 0x21, 0x02, 0x0b, 0x02, 0x40, 0x20,
+    0x00, 0x20, 0x01, 0x47, 0x0d, 0x00, 0x20, 0x02, 0x41, 0x02, 0x72, 0x21, 0x02, 0x0b, 0x02, 0x40,
+    0x20, 0x00, 0x20, 0x01, 0x48, 0x0d, 0x00, 0x20, 0x02, 0x41, 0x04, 0x72, 0x21, 0x02, 0x0b, 0x02,
+    0x40, 0x20, 0x00, 0x20, 0x01, 0x49, 0x0d, 0x00, 0x20, 0x02, 0x41, 0x08, 0x72, 0x21, 0x02, 0x0b,
+    0x02, 0x40, 0x20, 0x00, 0x20, 0x01, 0x4a, 0x0d, 0x00, 0x20, 0x02, 0x41, 0x10, 0x72, 0x21, 0x02,
+    0x0b, 0x02, 0x40, 0x20, 0x00, 0x20, 0x01, 0x4b, 0x0d, 0x00, 0x20, 0x02, 0x41, 0x20, 0x72, 0x21,
+    0x02, 0x0b, 0x02, 0x40, 0x20, 0x00, 0x20, 0x01, 0x4c, 0x0d, 0x00, 0x20, 0x02, 0x41, 0xc0, 0x00,
+    0x72, 0x21, 0x02, 0x0b, 0x02, 0x40, 0x20, 0x00, 0x20, 0x01, 0x4d, 0x0d, 0x00, 0x20, 0x02, 0x41,
+    0x80, 0x01, 0x72, 0x21, 0x02, 0x0b, 0x02, 0x40, 0x20, 0x00, 0x20, 0x01, 0x4e, 0x0d, 0x00, 0x20,
+    0x02, 0x41, 0x80, 0x02, 0x72, 0x21, 0x02, 0x0b, 0x02, 0x40, 0x20, 0x00, 0x20, 0x01, 0x4f, 0x0d,
+    0x00, 0x20, 0x02, 0x41, 0x80, 0x04, 0x72, 0x21, 0x02, 0x0b, 0x02, 0x40, 0x20, 0x00, 0x45, 0x0d,
+    0x00, 0x20, 0x02, 0x41, 0x80, 0x08, 0x72, 0x21, 0x02, 0x0b, 0x20, 0x02, 0x0b, 0x1b, 0x00, 0x20,
+    0x00, 0x20, 0x01, 0x48, 0x04, 0x7f, 0x20, 0x00, 0x20, 0x01, 0x6a, 0x05, 0x20, 0x01, 0x20, 0x01,
+    0x6a, 0x0b, 0x20, 0x00, 0x20, 0x00, 0x6a, 0x6a, 0x0b,
+]);
+
+const module = parseWebAssemblyModule(binary);
+const invoke = (name, ...args) => module.invoke(module.getExport(name), ...args);
+
+test("calls", () => {
+    expect(invoke("fib", 20)).toBe(6765);
+});
+
+test("loops", () => {
+    expect(invoke("loop_sum", 100)).toBe(4950);
+    expect(invoke("select_loop", 10)).toBe(60);
+    expect(invoke("loop_return", 21)).toBe(42);
+});
+
+test("branches carry their results", () => {
+    expect(invoke("block_result", 1)).toBe(1);
+    expect(invoke("block_result", 0)).toBe(2);
+    expect(invoke("br_drops", 1)).toBe(10);
+    expect(invoke("if_br", 1)).toBe(101);
+    expect(invoke("if_br", 0)).toBe(201);
+});
+
+test("branches out of either arm of an if", () => {
+    expect(invoke("if_else_br", 1)).toBe(12);
+    expect(invoke("if_else_br", 0)).toBe(22);
+    expect(invoke("else_br", 1)).toBe(11);
+    expect(invoke("else_br", 0)).toBe(21);
+});
+
+test("br_table", () => {
+    expect(invoke("table", 0)).toBe(10);
+    expect(invoke("table", 1)).toBe(20);
+    expect(invoke("table", 5)).toBe(30);
+    expect(invoke("table", -1)).toBe(30);
+});
+
+test("return from nested blocks", () => {
+    expect(invoke("nested_return", 1)).toBe(42);
+    expect(invoke("nested_return", 0)).toBe(7);
+});
+
+test("multiple results keep their order", () => {
+    expect(invoke("multi_value")).toBe(7);
+    expect(invoke("call_multi")).toBe(7);
+});
+
+test("comparisons followed by br_if", () => {
+    expect(invoke("compare_branches", 1, 2)).toBe(1841);
+    expect(invoke("compare_branches", 2, 1)).toBe(1229);
+    expect(invoke("compare_branches", 3, 3)).toBe(1086);
+    expect(invoke("compare_branches", -1, 1)).toBe(1433);
+    expect(invoke("compare_branches", 0, -5)).toBe(613);
+});
+
+test("adding locals", () => {
+    expect(invoke("add_locals", 1, 2)).toBe(5);
+    expect(invoke("add_locals", 5, 3)).toBe(16);
+    expect(invoke("add_locals", 0x7fffffff, 0x7fffffff)).toBe(-4);
+});
+
+test("values of other types", () => {
+    expect(invoke("f32_math", 3)).toBe(1.5);
+    expect(invoke("f64_math", 3)).toBe(3.25);
+    expect(invoke("i64_math", 3)).toBe(3298534883328n);
+    expect(invoke("i64_math", -2)).toBe(-2199023255552n);
+    expect(invoke("is_null")).toBe(1);
+    expect(invoke("truncate", 1)).toBe(-6);
+});
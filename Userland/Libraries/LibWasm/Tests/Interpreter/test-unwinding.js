@@ -0,0 +1,61 @@
+// The module exports functions that trap several frames deep, with values and labels left on the stacks of every
+// frame, and functions with blocks and loops that take parameters or have several results, e.g.
+// (func $nested (param $n i32) (result i32)
+//     (if (i32.eqz (local.get $n)) (then unreachable))
+//     i32.const 1
+//     (block (result i32) (call $nested (i32.sub (local.get $n) (i32.const 1))))
+//     i32.add)
+// prettier-ignore
+const binary = new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x05, 0x60, 0x01, 0x7f, 0x01, 0x7f,
+    0x60, 0x00, 0x02, 0x7f, 0x7f, 0x60, 0x02, 0x7f, 0x7f, 0x02, 0x7f, 0x7f, 0x60, 0x02, 0x7f, 0x7f,
+    0x01, 0x7f, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f, 0x03, 0x08, 0x07, 0x00, 0x03, 0x04, 0x03, 0x00,
+    0x00, 0x00, 0x07, 0x57, 0x07, 0x06, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x00, 0x00, 0x06, 0x64,
+    0x69, 0x76, 0x69, 0x64, 0x65, 0x00, 0x01, 0x0d, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x5f, 0x6e,
+    0x65, 0x73, 0x74, 0x65, 0x64, 0x00, 0x02, 0x0a, 0x73, 0x77, 0x61, 0x70, 0x5f, 0x62, 0x6c, 0x6f,
+    0x63, 0x6b, 0x00, 0x03, 0x08, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x5f, 0x62, 0x72, 0x00, 0x04, 0x0b,
+    0x6c, 0x6f, 0x6f, 0x70, 0x5f, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x00, 0x05, 0x0b, 0x6c, 0x6f,
+    0x6f, 0x70, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x00, 0x06, 0x0a, 0xa6, 0x01, 0x07, 0x16,
+    0x00, 0x20, 0x00, 0x45, 0x04, 0x40, 0x00, 0x0b, 0x41, 0x01, 0x02, 0x7f, 0x20, 0x00, 0x41, 0x01,
+    0x6b, 0x10, 0x00, 0x0b, 0x6a, 0x0b, 0x10, 0x00, 0x41, 0x01, 0x02, 0x7f, 0x03, 0x7f, 0x20, 0x00,
+    0x20, 0x01, 0x6d, 0x0b, 0x0b, 0x6a, 0x0b, 0x1c, 0x00, 0x20, 0x00, 0x45, 0x04, 0x7f, 0x41, 0xe4,
+    0x00, 0x20, 0x01, 0x10, 0x01, 0x05, 0x41, 0x01, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x20, 0x01, 0x10,
+    0x02, 0x6a, 0x0b, 0x0b, 0x14, 0x01, 0x02, 0x7f, 0x20, 0x00, 0x20, 0x01, 0x02, 0x02, 0x21, 0x02,
+    0x21, 0x03, 0x20, 0x02, 0x20, 0x03, 0x0b, 0x6b, 0x0b, 0x14, 0x00, 0x02, 0x01, 0x41, 0x0a, 0x41,
+    0x03, 0x20, 0x00, 0x0d, 0x00, 0x1a, 0x1a, 0x41, 0x05, 0x41, 0x14, 0x0b, 0x6b, 0x0b, 0x20, 0x01,
+    0x02, 0x7f, 0x41, 0x00, 0x20, 0x00, 0x03, 0x03, 0x21, 0x01, 0x21, 0x02, 0x20, 0x02, 0x20, 0x01,
+    0x6a, 0x20, 0x01, 0x41, 0x01, 0x6b, 0x22, 0x01, 0x20, 0x01, 0x0d, 0x00, 0x1a, 0x0b, 0x0b, 0x14,
+    0x00, 0x41, 0xe4, 0x00, 0x03, 0x7f, 0x41, 0x07, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x22, 0x00, 0x0d,
+    0x00, 0x0b, 0x6a, 0x0b,
+
+]);
+
+const module = parseWebAssemblyModule(binary);
+const invoke = (name, ...args) => module.invoke(module.getExport(name), ...args);
+
+test("traps unwind every frame", () => {
+    expect(() => invoke("nested", 0)).toThrowWithMessage(TypeError, "Execution trapped: Unreachable");
+    expect(() => invoke("nested", 5)).toThrowWithMessage(TypeError, "Execution trapped: Unreachable");
+    expect(() => invoke("divide_nested", 5, 0)).toThrow(TypeError);
+});
+
+test("calls work after a trap", () => {
+    expect(() => invoke("divide", 7, 0)).toThrow(TypeError);
+    expect(invoke("divide", 7, 2)).toBe(4);
+    expect(() => invoke("divide_nested", 5, 0)).toThrow(TypeError);
+    expect(invoke("divide_nested", 5, 4)).toBe(31);
+    expect(invoke("divide_nested", 0, 5)).toBe(21);
+});
+
+test("blocks with parameters and several results", () => {
+    expect(invoke("swap_block", 10, 3)).toBe(-7);
+    expect(invoke("multi_br", 1)).toBe(7);
+    expect(invoke("multi_br", 0)).toBe(-15);
+});
+
+test("branches to loops take their parameters", () => {
+    expect(invoke("loop_params", 10)).toBe(55);
+    expect(invoke("loop_params", 1)).toBe(1);
+    expect(invoke("loop_result", 5)).toBe(107);
+    expect(invoke("loop_result", 1)).toBe(107);
+});
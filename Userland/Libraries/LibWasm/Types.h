@@ -373,6 +373,11 @@ public:
         TableIndex rhs;
     };
 
+    struct LocalLocalArgs {
+        LocalIndex lhs;
+        LocalIndex rhs;
+    };
+
     struct StructuredInstructionArgs {
         BlockType block_type;
         InstructionPointer end_ip;
@@ -418,6 +423,7 @@ private:
         IndirectCallArgs,
         LabelIndex,
         LocalIndex,
+        LocalLocalArgs,
         MemoryArgument,
         StructuredInstructionArgs,
         TableBranchArgs,
@@ -947,6 +953,7 @@ public:
         auto& type() const { return m_type; }
         auto& locals() const { return m_local_types; }
         auto& body() const { return m_body; }
+        void set_body(Expression body, Badge<BytecodeCompiler>) { m_body = move(body); }
 
     private:
         TypeIndex m_type;
@@ -983,6 +990,7 @@ public:
 
     auto& sections() const { return m_sections; }
     auto& functions() const { return m_functions; }
+    auto& functions(Badge<BytecodeCompiler>) { return m_functions; }
     auto& type(TypeIndex index) const
     {
         FunctionType const* type = nullptr;
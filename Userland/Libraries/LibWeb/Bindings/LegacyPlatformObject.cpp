@@ -14,6 +14,7 @@ namespace Web::Bindings {
 LegacyPlatformObject::LegacyPlatformObject(JS::Realm& realm)
     : PlatformObject(realm)
 {
+    m_may_interfere_with_property_lookup_caches = true;
 }
 
 LegacyPlatformObject::~LegacyPlatformObject() = default;
@@ -202,7 +203,7 @@ JS::ThrowCompletionOr<Optional<JS::PropertyDescriptor>> LegacyPlatformObject::in
 }
 
 // https://webidl.spec.whatwg.org/#legacy-platform-object-set
-JS::ThrowCompletionOr<bool> LegacyPlatformObject::internal_set(JS::PropertyKey const& property_name, JS::Value value, JS::Value receiver)
+JS::ThrowCompletionOr<bool> LegacyPlatformObject::internal_set(JS::PropertyKey const& property_name, JS::Value value, JS::Value receiver, JS::CacheablePropertyMetadata*)
 {
     auto& vm = this->vm();
 
@@ -23,6 +23,12 @@ PlatformObject::PlatformObject(JS::Object& prototype)
 
 PlatformObject::~PlatformObject() = default;
 
+void PlatformObject::finalize()
+{
+    Base::finalize();
+    revoke_weak_ptrs();
+}
+
 JS::Realm& PlatformObject::realm() const
 {
     return shape().realm();
@@ -48,6 +48,12 @@ JS::ThrowCompletionOr<void> CSSImportRule::initialize(JS::Realm& realm)
     return {};
 }
 
+void CSSImportRule::finalize()
+{
+    Base::finalize();
+    detach_from_resource();
+}
+
 void CSSImportRule::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
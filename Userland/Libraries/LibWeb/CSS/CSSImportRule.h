@@ -40,6 +40,7 @@ private:
     CSSImportRule(AK::URL, DOM::Document&);
 
     virtual JS::ThrowCompletionOr<void> initialize(JS::Realm&) override;
+    virtual void finalize() override;
     virtual void visit_edges(Cell::Visitor&) override;
 
     virtual DeprecatedString serialized() const override;
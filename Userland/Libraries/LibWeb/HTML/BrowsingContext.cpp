@@ -452,6 +452,12 @@ BrowsingContext::BrowsingContext(Page& page, HTML::NavigableContainer* container
 
 BrowsingContext::~BrowsingContext() = default;
 
+void BrowsingContext::finalize()
+{
+    Base::finalize();
+    revoke_weak_ptrs();
+}
+
 void BrowsingContext::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -42,6 +42,12 @@ JS::ThrowCompletionOr<void> HTMLLinkElement::initialize(JS::Realm& realm)
     return {};
 }
 
+void HTMLLinkElement::finalize()
+{
+    Base::finalize();
+    detach_from_resource();
+}
+
 void HTMLLinkElement::inserted()
 {
     HTMLElement::inserted();
@@ -39,6 +39,7 @@ private:
     HTMLLinkElement(DOM::Document&, DOM::QualifiedName);
 
     virtual JS::ThrowCompletionOr<void> initialize(JS::Realm&) override;
+    virtual void finalize() override;
     void parse_attribute(DeprecatedFlyString const&, DeprecatedString const&) override;
 
     // ^ResourceClient
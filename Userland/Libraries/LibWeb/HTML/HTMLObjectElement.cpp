@@ -41,6 +41,12 @@ JS::ThrowCompletionOr<void> HTMLObjectElement::initialize(JS::Realm& realm)
     return {};
 }
 
+void HTMLObjectElement::finalize()
+{
+    Base::finalize();
+    detach_from_resource();
+}
+
 void HTMLObjectElement::parse_attribute(DeprecatedFlyString const& name, DeprecatedString const& value)
 {
     NavigableContainer::parse_attribute(name, value);
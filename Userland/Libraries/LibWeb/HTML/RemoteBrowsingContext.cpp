@@ -27,4 +27,10 @@ HTML::WindowProxy const* RemoteBrowsingContext::window_proxy() const
 RemoteBrowsingContext::RemoteBrowsingContext(String handle)
     : m_window_handle(handle) {};
 
+void RemoteBrowsingContext::finalize()
+{
+    Base::finalize();
+    revoke_weak_ptrs();
+}
+
 }
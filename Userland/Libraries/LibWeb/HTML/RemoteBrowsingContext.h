@@ -41,6 +41,8 @@ public:
 private:
     explicit RemoteBrowsingContext(String);
 
+    virtual void finalize() override;
+
     String m_window_handle;
 };
 
@@ -44,6 +44,12 @@ Node::Node(DOM::Document& document, DOM::Node* node)
 
 Node::~Node() = default;
 
+void Node::finalize()
+{
+    Base::finalize();
+    revoke_weak_ptrs();
+}
+
 void Node::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -158,6 +158,7 @@ public:
 protected:
     Node(DOM::Document&, DOM::Node*);
 
+    virtual void finalize() override;
     virtual void visit_edges(Cell::Visitor&) override;
 
 private:
@@ -188,6 +188,12 @@ void ResourceClient::set_resource(Resource* resource)
     }
 }
 
+void ResourceClient::detach_from_resource()
+{
+    set_resource(nullptr);
+    revoke_weak_ptrs();
+}
+
 ResourceClient::~ResourceClient()
 {
     if (m_resource)
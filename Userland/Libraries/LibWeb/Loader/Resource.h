@@ -103,6 +103,9 @@ protected:
     Resource const* resource() const { return m_resource; }
     void set_resource(Resource*);
 
+    // NOTE: Clients that are garbage-collected cells must call this from finalize(), as they are destroyed lazily.
+    void detach_from_resource();
+
 private:
     RefPtr<Resource> m_resource;
 };
@@ -47,7 +47,7 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<Table>> Table::construct_impl(JS::Realm& re
     if (!address.has_value())
         return vm.throw_completion<JS::TypeError>("Wasm Table allocation failed"sv);
 
-    auto const& reference = reference_value.value().get<Wasm::Reference>();
+    auto reference = reference_value.value().get<Wasm::Reference>();
     auto& table = *Detail::s_abstract_machine.store().get(*address);
     for (auto& element : table.elements())
         element = reference;
@@ -81,7 +81,7 @@ WebIDL::ExceptionOr<u32> Table::grow(u32 delta, JS::Value value)
     auto initial_size = table->elements().size();
 
     auto reference_value = TRY(value_to_reference(vm, value, table->type().element_type()));
-    auto const& reference = reference_value.value().get<Wasm::Reference>();
+    auto reference = reference_value.value().get<Wasm::Reference>();
 
     if (!table->grow(delta, reference))
         return vm.throw_completion<JS::RangeError>("Failed to grow table"sv);
@@ -122,7 +122,7 @@ WebIDL::ExceptionOr<void> Table::set(u32 index, JS::Value value)
         return vm.throw_completion<JS::RangeError>("Table element index out of range"sv);
 
     auto reference_value = TRY(value_to_reference(vm, value, table->type().element_type()));
-    auto const& reference = reference_value.value().get<Wasm::Reference>();
+    auto reference = reference_value.value().get<Wasm::Reference>();
 
     table->elements()[index] = reference;
 
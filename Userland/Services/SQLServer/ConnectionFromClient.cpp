@@ -62,6 +62,44 @@ void ConnectionFromClient::disconnect(SQL::ConnectionID connection_id)
         dbgln("Database connection has disappeared");
 }
 
+void ConnectionFromClient::set_result_batch_size(SQL::ConnectionID connection_id, u64 batch_size)
+{
+    dbgln_if(SQLSERVER_DEBUG, "ConnectionFromClient::set_result_batch_size(connection_id: {}, batch_size: {})", connection_id, batch_size);
+    auto database_connection = DatabaseConnection::connection_for(connection_id);
+    if (database_connection)
+        database_connection->set_result_batch_size(batch_size);
+    else
+        dbgln("Database connection has disappeared");
+}
+
+Messages::SQLServer::CacheStatisticsResponse ConnectionFromClient::cache_statistics(SQL::ConnectionID connection_id)
+{
+    dbgln_if(SQLSERVER_DEBUG, "ConnectionFromClient::cache_statistics(connection_id: {})", connection_id);
+
+    auto database_connection = DatabaseConnection::connection_for(connection_id);
+    if (!database_connection) {
+        dbgln("Database connection has disappeared");
+        return { 0, 0, 0, 0 };
+    }
+
+    auto const& statistics = database_connection->database()->cache_statistics();
+    return { statistics.hits, statistics.misses, statistics.evictions, statistics.blocks_read_ahead };
+}
+
+Messages::SQLServer::StatementCacheStatisticsResponse ConnectionFromClient::statement_cache_statistics(SQL::ConnectionID connection_id)
+{
+    dbgln_if(SQLSERVER_DEBUG, "ConnectionFromClient::statement_cache_statistics(connection_id: {})", connection_id);
+
+    auto database_connection = DatabaseConnection::connection_for(connection_id);
+    if (!database_connection) {
+        dbgln("Database connection has disappeared");
+        return { 0, 0, 0 };
+    }
+
+    auto const& statistics = database_connection->statement_cache_statistics();
+    return { statistics.hits, statistics.misses, statistics.evictions };
+}
+
 Messages::SQLServer::PrepareStatementResponse ConnectionFromClient::prepare_statement(SQL::ConnectionID connection_id, DeprecatedString const& sql)
 {
     dbgln_if(SQLSERVER_DEBUG, "ConnectionFromClient::prepare_statement(connection_id: {}, sql: '{}')", connection_id, sql);
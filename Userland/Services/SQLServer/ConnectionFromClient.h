@@ -38,6 +38,9 @@ private:
     virtual Messages::SQLServer::PrepareStatementResponse prepare_statement(SQL::ConnectionID, DeprecatedString const&) override;
     virtual Messages::SQLServer::ExecuteStatementResponse execute_statement(SQL::StatementID, Vector<SQL::Value> const& placeholder_values) override;
     virtual void disconnect(SQL::ConnectionID) override;
+    virtual void set_result_batch_size(SQL::ConnectionID, u64) override;
+    virtual Messages::SQLServer::CacheStatisticsResponse cache_statistics(SQL::ConnectionID) override;
+    virtual Messages::SQLServer::StatementCacheStatisticsResponse statement_cache_statistics(SQL::ConnectionID) override;
 
     DeprecatedString m_database_path;
 };
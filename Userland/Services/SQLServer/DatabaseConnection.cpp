@@ -5,6 +5,7 @@
  */
 
 #include <AK/LexicalPath.h>
+#include <LibSQL/AST/Parser.h>
 #include <SQLServer/DatabaseConnection.h>
 #include <SQLServer/SQLStatement.h>
 
@@ -69,8 +70,40 @@ SQL::ResultOr<SQL::StatementID> DatabaseConnection::prepare_statement(StringView
 {
     dbgln_if(SQLSERVER_DEBUG, "DatabaseConnection::prepare_statement(connection_id {}, database '{}', sql '{}'", connection_id(), m_database_name, sql);
 
-    auto statement = TRY(SQLStatement::create(*this, sql));
+    auto parsed_statement = TRY(parse_statement(sql));
+    auto statement = TRY(SQLStatement::create(*this, move(parsed_statement)));
     return statement->statement_id();
 }
 
+SQL::ResultOr<NonnullRefPtr<SQL::AST::Statement>> DatabaseConnection::parse_statement(StringView sql)
+{
+    if (auto it = m_statement_cache.find(sql); it != m_statement_cache.end()) {
+        ++m_statement_cache_statistics.hits;
+        it->value.last_used = ++m_statement_cache_clock;
+        return it->value.statement;
+    }
+
+    ++m_statement_cache_statistics.misses;
+
+    auto parser = SQL::AST::Parser(SQL::AST::Lexer(sql));
+    auto statement = parser.next_statement();
+
+    if (parser.has_errors())
+        return SQL::Result { SQL::SQLCommand::Unknown, SQL::SQLErrorCode::SyntaxError, parser.errors()[0].to_deprecated_string() };
+
+    if (m_statement_cache.size() >= STATEMENT_CACHE_CAPACITY) {
+        auto least_recently_used = m_statement_cache.begin();
+        for (auto it = m_statement_cache.begin(); it != m_statement_cache.end(); ++it) {
+            if (it->value.last_used < least_recently_used->value.last_used)
+                least_recently_used = it;
+        }
+
+        m_statement_cache.remove(least_recently_used);
+        ++m_statement_cache_statistics.evictions;
+    }
+
+    m_statement_cache.set(sql, { statement, ++m_statement_cache_clock });
+    return statement;
+}
+
 }
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
 #include <LibCore/Object.h>
+#include <LibSQL/AST/AST.h>
 #include <LibSQL/Database.h>
 #include <LibSQL/Result.h>
 #include <LibSQL/Type.h>
@@ -30,13 +32,43 @@ public:
     void disconnect();
     SQL::ResultOr<SQL::StatementID> prepare_statement(StringView sql);
 
+    // The number of result rows which are sent to the client in a single message.
+    static constexpr size_t DEFAULT_RESULT_BATCH_SIZE = 256;
+    size_t result_batch_size() const { return m_result_batch_size; }
+    void set_result_batch_size(size_t batch_size) { m_result_batch_size = max<size_t>(batch_size, 1); }
+
+    // Parsed statements are cached by their SQL text, so that preparing a statement which was
+    // prepared before skips lexing and parsing it. Executing a statement does not modify its
+    // AST, so all statements prepared from the same text share the cached AST.
+    static constexpr size_t STATEMENT_CACHE_CAPACITY = 128;
+
+    struct StatementCacheStatistics {
+        u64 hits { 0 };
+        u64 misses { 0 };
+        u64 evictions { 0 };
+    };
+
+    StatementCacheStatistics const& statement_cache_statistics() const { return m_statement_cache_statistics; }
+
 private:
     DatabaseConnection(NonnullRefPtr<SQL::Database> database, DeprecatedString database_name, int client_id);
 
+    SQL::ResultOr<NonnullRefPtr<SQL::AST::Statement>> parse_statement(StringView sql);
+
+    struct CachedStatement {
+        NonnullRefPtr<SQL::AST::Statement> statement;
+        u64 last_used { 0 };
+    };
+
     NonnullRefPtr<SQL::Database> m_database;
     DeprecatedString m_database_name;
     SQL::ConnectionID m_connection_id { 0 };
     int m_client_id { 0 };
+    size_t m_result_batch_size { DEFAULT_RESULT_BATCH_SIZE };
+
+    HashMap<DeprecatedString, CachedStatement> m_statement_cache;
+    u64 m_statement_cache_clock { 0 };
+    StatementCacheStatistics m_statement_cache_statistics;
 };
 
 }
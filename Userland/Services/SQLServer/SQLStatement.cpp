@@ -5,7 +5,6 @@
  */
 
 #include <LibCore/Object.h>
-#include <LibSQL/AST/Parser.h>
 #include <SQLServer/ConnectionFromClient.h>
 #include <SQLServer/DatabaseConnection.h>
 #include <SQLServer/SQLStatement.h>
@@ -23,14 +22,8 @@ RefPtr<SQLStatement> SQLStatement::statement_for(SQL::StatementID statement_id)
     return nullptr;
 }
 
-SQL::ResultOr<NonnullRefPtr<SQLStatement>> SQLStatement::create(DatabaseConnection& connection, StringView sql)
+SQL::ResultOr<NonnullRefPtr<SQLStatement>> SQLStatement::create(DatabaseConnection& connection, NonnullRefPtr<SQL::AST::Statement> statement)
 {
-    auto parser = SQL::AST::Parser(SQL::AST::Lexer(sql));
-    auto statement = parser.next_statement();
-
-    if (parser.has_errors())
-        return SQL::Result { SQL::SQLCommand::Unknown, SQL::SQLErrorCode::SyntaxError, parser.errors()[0].to_deprecated_string() };
-
     return TRY(adopt_nonnull_ref_or_enomem(new (nothrow) SQLStatement(connection, move(statement))));
 }
 
@@ -72,7 +65,26 @@ Optional<SQL::ExecutionID> SQLStatement::execute(Vector<SQL::Value> placeholder_
     m_ongoing_executions.set(execution_id);
 
     deferred_invoke([this, placeholder_values = move(placeholder_values), execution_id] {
-        auto execution_result = m_statement->execute(connection()->database(), placeholder_values);
+        // The rows of a SELECT are sent to the client while the statement is still producing
+        // them, so the client does not have to wait for the whole result before it sees its
+        // first rows. Every execution ends with exactly one terminal message: results_exhausted once
+        // all rows were sent, or execution_error if the statement fails, even after some rows were
+        // already sent. Statements without rows end with execution_success instead.
+        size_t rows_sent = 0;
+        auto send_batch = [&](SQL::ResultSet& batch) -> ErrorOr<void> {
+            auto client_connection = ConnectionFromClient::client_connection_for(connection()->client_id());
+            if (!client_connection)
+                return Error::from_string_view("Client disconnected"sv);
+
+            if (rows_sent == 0)
+                client_connection->async_execution_success(statement_id(), execution_id, batch.column_names(), true, 0, 0, 0);
+
+            rows_sent += batch.size();
+            send_results(*client_connection, execution_id, batch);
+            return {};
+        };
+
+        auto execution_result = m_statement->execute(connection()->database(), placeholder_values, connection()->result_batch_size(), move(send_batch));
         m_ongoing_executions.remove(execution_id);
 
         if (execution_result.is_error()) {
@@ -88,11 +100,14 @@ Optional<SQL::ExecutionID> SQLStatement::execute(Vector<SQL::Value> placeholder_
 
         auto result = execution_result.release_value();
 
-        if (should_send_result_rows(result)) {
+        if (rows_sent > 0) {
+            client_connection->async_results_exhausted(statement_id(), execution_id, rows_sent);
+        } else if (should_send_result_rows(result)) {
             client_connection->async_execution_success(statement_id(), execution_id, result.column_names(), true, 0, 0, 0);
 
             auto result_size = result.size();
-            next(execution_id, move(result), result_size);
+            send_results(*client_connection, execution_id, result);
+            client_connection->async_results_exhausted(statement_id(), execution_id, result_size);
         } else {
             if (result.command() == SQL::SQLCommand::Insert)
                 client_connection->async_execution_success(statement_id(), execution_id, result.column_names(), false, result.size(), 0, 0);
@@ -115,6 +130,7 @@ bool SQLStatement::should_send_result_rows(SQL::ResultSet const& result) const
 
     switch (result.command()) {
     case SQL::SQLCommand::Describe:
+    case SQL::SQLCommand::Explain:
     case SQL::SQLCommand::Select:
         return true;
     default:
@@ -122,23 +138,20 @@ bool SQLStatement::should_send_result_rows(SQL::ResultSet const& result) const
     }
 }
 
-void SQLStatement::next(SQL::ExecutionID execution_id, SQL::ResultSet result, size_t result_size)
+// Sends the rows in messages of at most result_batch_size() rows. The values of the rows of a
+// message are sent one after another in a single vector.
+void SQLStatement::send_results(ConnectionFromClient& client_connection, SQL::ExecutionID execution_id, SQL::ResultSet& result)
 {
-    auto client_connection = ConnectionFromClient::client_connection_for(connection()->client_id());
-    if (!client_connection) {
-        warnln("Cannot yield next result. Client disconnected");
-        return;
-    }
+    auto batch_size = connection()->result_batch_size();
+
+    for (size_t first_row = 0; first_row < result.size(); first_row += batch_size) {
+        auto row_count = min(batch_size, result.size() - first_row);
 
-    if (!result.is_empty()) {
-        auto result_row = result.take_first();
-        client_connection->async_next_result(statement_id(), execution_id, result_row.row.take_data());
+        Vector<SQL::Value> values;
+        for (size_t i = first_row; i < first_row + row_count; ++i)
+            values.extend(result[i].row.take_data());
 
-        deferred_invoke([this, execution_id, result = move(result), result_size]() mutable {
-            next(execution_id, move(result), result_size);
-        });
-    } else {
-        client_connection->async_results_exhausted(statement_id(), execution_id, result_size);
+        client_connection.async_next_results(statement_id(), execution_id, row_count, move(values));
     }
 }
 
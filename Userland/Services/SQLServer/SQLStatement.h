@@ -22,7 +22,7 @@ class SQLStatement final : public Core::Object {
     C_OBJECT_ABSTRACT(SQLStatement)
 
 public:
-    static SQL::ResultOr<NonnullRefPtr<SQLStatement>> create(DatabaseConnection&, StringView sql);
+    static SQL::ResultOr<NonnullRefPtr<SQLStatement>> create(DatabaseConnection&, NonnullRefPtr<SQL::AST::Statement>);
     ~SQLStatement() override = default;
 
     static RefPtr<SQLStatement> statement_for(SQL::StatementID statement_id);
@@ -34,7 +34,7 @@ private:
     SQLStatement(DatabaseConnection&, NonnullRefPtr<SQL::AST::Statement> statement);
 
     bool should_send_result_rows(SQL::ResultSet const& result) const;
-    void next(SQL::ExecutionID execution_id, SQL::ResultSet result, size_t result_size);
+    void send_results(ConnectionFromClient&, SQL::ExecutionID, SQL::ResultSet&);
     void report_error(SQL::Result, SQL::ExecutionID execution_id);
 
     SQL::StatementID m_statement_id { 0 };
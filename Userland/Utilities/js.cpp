@@ -11,8 +11,10 @@
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibJS/Bytecode/BasicBlock.h>
+#include <LibJS/Bytecode/CodeCache.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Profiler.h>
 #include <LibJS/Console.h>
 #include <LibJS/Contrib/Test262/GlobalObject.h>
 #include <LibJS/Interpreter.h>
@@ -565,9 +567,25 @@ private:
     int m_group_stack_depth { 0 };
 };
 
+static ErrorOr<void> write_bytecode_profile(StringView samples_path)
+{
+    auto& profiler = JS::Bytecode::Profiler::the();
+    if (!profiler.is_enabled())
+        return {};
+
+    auto report_stream = TRY(Core::File::standard_error());
+    TRY(profiler.write_report(*report_stream));
+
+    if (!samples_path.is_empty()) {
+        auto samples_file = TRY(Core::File::open(samples_path, Core::File::OpenMode::Write, 0666));
+        TRY(profiler.write_folded_stacks(*samples_file));
+    }
+    return {};
+}
+
 ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
-    TRY(Core::System::pledge("stdio rpath wpath cpath tty sigaction"));
+    TRY(Core::System::pledge("stdio rpath wpath cpath tty sigaction prot_exec"));
 
     bool gc_on_every_allocation = false;
     bool disable_syntax_highlight = false;
@@ -577,6 +595,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     Vector<StringView> script_paths;
     bool use_bytecode = false;
     bool optimize_bytecode = false;
+    bool use_jit = false;
+    bool reuse_parsed_scripts = false;
+    bool profile_bytecode = false;
+    StringView profile_samples_path;
+    unsigned profile_sampling_interval_in_microseconds = 1000;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("This is a JavaScript interpreter.");
@@ -584,6 +607,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
     args_parser.add_option(use_bytecode, "Run the bytecode", "run-bytecode", 'b');
     args_parser.add_option(optimize_bytecode, "Optimize the bytecode", "optimize-bytecode", 'p');
+    args_parser.add_option(use_jit, "Compile the bytecode to machine code (implies --run-bytecode)", "jit", 'j');
+    args_parser.add_option(reuse_parsed_scripts, "Reuse the parse tree and bytecode of scripts this process already ran, kept in memory only (requires --run-bytecode)", "reuse-parsed-scripts", {});
+    args_parser.add_option(profile_bytecode, "Print how often each instruction and function ran, and how long instructions took (implies --run-bytecode)", "profile-bytecode", {});
+    args_parser.add_option(profile_samples_path, "Sample the call stack and write it to a file in the folded stacks format for flame graphs (implies --profile-bytecode)", "profile-samples", {}, "path");
+    args_parser.add_option(profile_sampling_interval_in_microseconds, "Interval between two call stack samples in microseconds (default: 1000)", "profile-sampling-interval", {}, "microseconds");
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -596,8 +624,16 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
-    JS::Bytecode::Interpreter::set_enabled(use_bytecode);
+    if (!profile_samples_path.is_empty())
+        profile_bytecode = true;
+
+    JS::Bytecode::Interpreter::set_enabled(use_bytecode || use_jit || profile_bytecode);
     JS::Bytecode::Interpreter::set_optimizations_enabled(optimize_bytecode);
+    JS::Bytecode::Interpreter::set_jit_enabled(use_jit);
+    JS::Bytecode::CodeCache::the().set_enabled(reuse_parsed_scripts);
+    JS::Bytecode::Profiler::the().set_enabled(profile_bytecode);
+    if (!profile_samples_path.is_empty())
+        JS::Bytecode::Profiler::the().set_sampling_interval(Duration::from_microseconds(profile_sampling_interval_in_microseconds));
 
     bool syntax_highlight = !disable_syntax_highlight;
 
@@ -842,6 +878,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         s_editor->on_tab_complete = move(complete);
         TRY(repl(*interpreter));
         s_editor->save_history(s_history_path.to_deprecated_string());
+        TRY(write_bytecode_profile(profile_samples_path));
     } else {
         if (use_test262_global) {
             interpreter = JS::Interpreter::create<JS::Test262::GlobalObject>(*g_vm);
@@ -889,7 +926,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(*interpreter, builder.string_view(), source_name)))
+        auto did_run_successfully = TRY(parse_and_run(*interpreter, builder.string_view(), source_name));
+        TRY(write_bytecode_profile(profile_samples_path));
+        if (!did_run_successfully)
             return 1;
     }
 
@@ -314,6 +314,14 @@ private:
             } else {
                 outln("\033[33;1mUsage: .connect <database name>\033[0m");
             }
+        } else if (command == ".stats") {
+            auto statistics = m_sql_client->cache_statistics(m_connection_id);
+            outln("Block cache: {} hits, {} misses, {} evictions, {} blocks read ahead",
+                statistics.hits(), statistics.misses(), statistics.evictions(), statistics.blocks_read_ahead());
+
+            auto statement_statistics = m_sql_client->statement_cache_statistics(m_connection_id);
+            outln("Statement cache: {} hits, {} misses, {} evictions",
+                statement_statistics.hits(), statement_statistics.misses(), statement_statistics.evictions());
         } else if (command.starts_with(".read "sv)) {
             if (!m_input_file) {
                 auto parts = command.split_view(' ');